@@ -0,0 +1,179 @@
+/**
+ * @file command-buffer.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Güncelleme sırasında yapılmak istenen yapısal değişiklikleri (nesne/bileşen ekleme ve silme) kaydedip
+ *        kare içindeki bir eşitleme noktasında toplu olarak uygulayan komut tamponu.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "component-store.h"
+#include "entity.h"
+#include "graphical-object-factory.h"
+
+class Registry;
+
+/**
+ * @brief CommandBuffer, sistemlerin gezinti sırasında doğrudan yapamayacağı değişiklikleri kaydeder.
+ *        Kayıt birden fazla iş parçacığından aynı anda yapılabilir; her iş parçacığı ayrı bir şeride (lane) yazar,
+ *        bileşen verileri ise şeride ait ve kareler arasında yeniden kullanılan bloklarda saklanır.
+ *        Apply çağrıldığında komutlar şu sırayla ve tür/nesne numarasına göre sıralanmış olarak uygulanır:
+ *        nesne oluşturma, bileşen ekleme ve silme, nesne silme. Aynı nesne ve bileşen türü için ekleme ve silme
+ *        komutları kayıt sırasıyla uygulanır; örneğin Remove ardından Add bileşeni yeni değeriyle bırakır.
+ *        Spawn ile dönen tutamaç Apply öncesinde geçicidir, yalnızca aynı tampondaki komutlarda kullanılabilir.
+ *        Apply, kayıt yapan iş parçacıkları bittikten sonra tek bir iş parçacığından çağrılmalıdır.
+ */
+class CommandBuffer {
+public:
+    /**
+     * @brief Spawn ile dönen ve henüz oluşturulmamış nesneleri gösteren tutamaçların kuşak değeridir.
+     */
+    static constexpr uint32_t kDeferredGeneration = std::numeric_limits<uint32_t>::max();
+
+    static bool IsDeferred(Entity entity) { return entity.mGeneration == kDeferredGeneration; }
+
+private:
+    enum class CommandType : uint8_t {
+        Spawn,
+        AddComponent,
+        RemoveComponent,
+        Destroy
+    };
+
+    using AddFn = void (*)(ComponentStore& store, ObjectId id, GraphicalObject* owner, void* payload);
+    using DestroyFn = void (*)(void* payload);
+
+    struct Command {
+        CommandType mType;
+        ComponentTypeId mComponent;
+        Entity mEntity;
+        uint64_t mSequence;
+        void* mPayload;
+        AddFn mAdd;
+        DestroyFn mDestroy;
+        float mX;
+        float mY;
+    };
+
+    /**
+     * @brief Bileşen verilerinin saklandığı, blokları kareler arasında yeniden kullanılan basit bir yığın ayırıcıdır.
+     */
+    class Arena {
+    private:
+        static constexpr size_t kBlockSize = 16 * 1024;
+
+        struct Block {
+            std::unique_ptr<std::byte[]> mMemory;
+            size_t mSize;
+        };
+
+        std::vector<Block> mBlocks;
+        size_t mBlockIndex = 0;
+        size_t mOffset = 0;
+
+    public:
+        void* Allocate(size_t size, size_t alignment);
+        void Reset();
+    };
+
+    struct Lane {
+        mutable std::mutex mMutex;
+        std::vector<Command> mCommands;
+        Arena mArena;
+    };
+
+    static constexpr size_t kLaneCount = 16;
+
+    std::array<Lane, kLaneCount> mLanes;
+    std::atomic<uint64_t> mNextSequence{0};
+    std::atomic<uint32_t> mNextDeferred{0};
+
+    // Apply sırasında kullanılan ve kareler arasında saklanan çalışma alanları
+    std::vector<Command> mMerged;
+    std::vector<Entity> mSpawned;
+    std::vector<ObjectId> mTouched;
+
+    Lane& CurrentLane();
+
+    template<typename T>
+    static void AddThunk(ComponentStore& store, ObjectId id, GraphicalObject* owner, void* payload) {
+        store.Add<T>(id, std::move(*static_cast<T*>(payload)))->mOwner = owner;
+    }
+
+    template<typename T>
+    static void DestroyThunk(void* payload) {
+        static_cast<T*>(payload)->~T();
+    }
+
+    template<typename T, typename... Args>
+    void Record(CommandType type, ComponentTypeId component, Entity entity, AddFn add, float x, float y,
+                Args&&... args) {
+        const uint64_t sequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+        Lane& lane = CurrentLane();
+        std::lock_guard<std::mutex> lock(lane.mMutex);
+
+        Command command{type, component, entity, sequence, nullptr, add, nullptr, x, y};
+        if constexpr (!std::is_void_v<T>) {
+            command.mPayload = ::new (lane.mArena.Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+            command.mDestroy = &DestroyThunk<T>;
+        }
+        lane.mCommands.push_back(command);
+    }
+
+    void ReleasePayloads();
+
+public:
+    CommandBuffer() = default;
+    ~CommandBuffer();
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    /**
+     * @brief Boş bir nesne oluşturma komutu kaydeder ve geçici bir tutamaç döner.
+     */
+    Entity Spawn();
+
+    /**
+     * @brief Prefab'dan verilen konumda nesne oluşturma komutu kaydeder. Prefab kopyalanır.
+     */
+    Entity Spawn(const Prefab& prefab, float x, float y);
+
+    void Destroy(Entity entity);
+
+    template<typename T, typename... Args>
+    void AddComponent(Entity entity, Args&&... args) {
+        Record<T>(CommandType::AddComponent, ComponentTypeOf<T>(), entity, &AddThunk<T>, 0.0f, 0.0f,
+                  std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void RemoveComponent(Entity entity) {
+        Record<void>(CommandType::RemoveComponent, ComponentTypeOf<T>(), entity, nullptr, 0.0f, 0.0f);
+    }
+
+    /**
+     * @brief Kaydedilen tüm komutları uygular ve tamponu boşaltır. Silinmiş nesnelere ait komutlar yok sayılır.
+     */
+    void Apply(Registry& registry);
+
+    /**
+     * @brief Komutları uygulamadan tamponu boşaltır.
+     */
+    void Clear();
+
+    size_t Size() const;
+};
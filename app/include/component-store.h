@@ -0,0 +1,641 @@
+/**
+ * @file component-store.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Bileşenleri tür bazında bitişik bellekte tutan havuz tabanlı depo.
+ *        Her bileşen türü kendi havuzunda (ComponentPool) yoğun (dense) bir dizi olarak saklanır.
+ *        Böylece örneğin tüm Transform nesneleri yan yana durur ve sistemler bu diziler üzerinde
+ *        önbellek dostu bir şekilde gezinebilir. Nesne numarasından bileşene erişim için
+ *        seyrek (sparse) bir indeks dizisi kullanılır.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "components.h"
+#include "pool-allocator.h"
+
+using ObjectId = uint32_t;
+using ComponentTypeId = uint32_t;
+
+constexpr ObjectId kInvalidObjectId = std::numeric_limits<ObjectId>::max();
+
+/**
+ * @brief Her nesnenin sahip olduğu bileşen türlerini bit olarak tutan maskedir.
+ *        Bir nesnede en fazla kMaxComponentTypes farklı bileşen türü bulunabilir. Maskenin son kResourceMaskBits
+ *        biti hiçbir bileşen türüne verilmez; sistemler bu bitlerle bileşen olmayan paylaşılan yapıları bildirir.
+ */
+using ComponentMask = uint64_t;
+constexpr uint32_t kResourceMaskBits = 8;
+constexpr uint32_t kMaxComponentTypes = 64 - kResourceMaskBits;
+
+ComponentTypeId NextComponentTypeId();
+
+/**
+ * @brief Her bileşen türü için sabit bir numara döner. Numara türün ilk kullanımında bir kez atanır,
+ *        sonrasında RTTI ya da dynamic_cast gerektirmeden dizi indeksi olarak kullanılabilir.
+ */
+template<typename T>
+ComponentTypeId ComponentTypeOf() {
+    static const ComponentTypeId sId = NextComponentTypeId();
+    return sId;
+}
+
+template<typename T>
+ComponentMask ComponentMaskOf() {
+    return ComponentMask{1} << ComponentTypeOf<T>();
+}
+
+class IComponentPool;
+
+/**
+ * @brief Bir bileşen havuzunda değişen nesnelerin listesidir. İzlenen havuz; bileşen eklendiğinde, silindiğinde ya da
+ *        MarkChanged ile yazıldığı bildirildiğinde nesneyi listeye ekler. Liste her nesneyi Clear çağrılana kadar
+ *        bir kez tutar, böylece değişiklikleri işleyen alt sistemler havuzun tamamını taramak yerine yalnızca değişen
+ *        nesneleri gezer. Her tüketici kendi listesini tuttuğundan farklı sıklıkta çalışan tüketiciler birbirinin
+ *        değişikliklerini silmez.
+ */
+class ChangeList {
+private:
+    friend class IComponentPool;
+
+    IComponentPool* mPool = nullptr;
+    std::vector<uint8_t> mQueued;
+    std::vector<ObjectId> mIds;
+    std::atomic<uint32_t> mCount{0};
+
+    /**
+     * @brief objectCount numarasına kadar olan nesneler için yer ayırır; yalnızca havuz tarafından, işaretleme ile
+     *        aynı anda olmayacak şekilde çağrılır.
+     */
+    void Grow(size_t objectCount) {
+        if (objectCount > mQueued.size()) {
+            mQueued.resize(objectCount, 0);
+            mIds.resize(objectCount);
+        }
+    }
+
+public:
+    ChangeList() = default;
+    ~ChangeList();
+    ChangeList(const ChangeList&) = delete;
+    ChangeList& operator=(const ChangeList&) = delete;
+
+    bool IsTracking() const { return mPool != nullptr; }
+
+    /**
+     * @brief Nesneyi listeye ekler; zaten listede ise hiçbir şey yapmaz. Sistemlerin paralel parçalarından aynı anda
+     *        çağrılabilir.
+     */
+    void Mark(ObjectId id) {
+        if (id >= mQueued.size()) {
+            return;
+        }
+
+        std::atomic_ref<uint8_t> queued(mQueued[id]);
+        if (queued.load(std::memory_order_relaxed) == 0 && queued.exchange(1, std::memory_order_relaxed) == 0) {
+            mIds[mCount.fetch_add(1, std::memory_order_relaxed)] = id;
+        }
+    }
+
+    /**
+     * @brief Son Clear çağrısından beri değişen nesneler. Silinen bileşenlerin sahipleri de listede yer alır.
+     */
+    std::span<const ObjectId> Ids() const {
+        return {mIds.data(), mCount.load(std::memory_order_relaxed)};
+    }
+
+    void Clear() {
+        for (ObjectId id : Ids()) {
+            mQueued[id] = 0;
+        }
+        mCount.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Farklı türdeki havuzları ortak bir arayüz üzerinden yönetebilmek için kullanılan soyut sınıftır.
+ *        Havuzu izleyen değişiklik listeleri de burada tutulur.
+ */
+class IComponentPool {
+protected:
+    std::vector<ChangeList*> mTrackers;
+
+    void GrowTrackers(size_t objectCount) {
+        for (ChangeList* list : mTrackers) {
+            list->Grow(objectCount);
+        }
+    }
+
+    void Track(ChangeList& list, size_t objectCount) {
+        if (list.mPool) {
+            list.mPool->Untrack(list);
+        }
+        list.mPool = this;
+        list.Grow(objectCount);
+        mTrackers.push_back(&list);
+    }
+
+public:
+    IComponentPool() = default;
+    IComponentPool(const IComponentPool&) = delete;
+    IComponentPool& operator=(const IComponentPool&) = delete;
+
+    virtual ~IComponentPool() {
+        for (ChangeList* list : mTrackers) {
+            list->mPool = nullptr;
+        }
+    }
+
+    void Untrack(ChangeList& list) {
+        std::erase(mTrackers, &list);
+        list.mPool = nullptr;
+    }
+
+    bool IsTracked() const { return !mTrackers.empty(); }
+
+    /**
+     * @brief Nesnenin bileşeninin yazıldığını izleyen tüm listelere bildirir. Sistemlerin paralel parçalarından
+     *        aynı anda çağrılabilir; bileşen ekleyen ya da silen çağrılarla aynı anda çağrılmamalıdır.
+     */
+    void MarkChanged(ObjectId id) {
+        for (ChangeList* list : mTrackers) {
+            list->Mark(id);
+        }
+    }
+
+    virtual bool Contains(ObjectId id) const = 0;
+    virtual Component* GetBase(ObjectId id) = 0;
+    /**
+     * @brief Bileşeni siler. Boşluğu doldurmak için taşınan bileşenin sahibini, taşınma olmadıysa kInvalidObjectId döner.
+     */
+    virtual ObjectId Remove(ObjectId id) = 0;
+    virtual size_t Size() const = 0;
+    virtual PoolStats GetStats() const = 0;
+};
+
+/**
+ * @brief Tek bir bileşen türünü sayfalar halinde bitişik olarak saklayan havuzdur.
+ *        Sayfalar sabit boyutlu olduğundan havuz büyüdükçe mevcut bileşenlerin adresi değişmez.
+ *        Silme işleminde son eleman boşalan yere taşınır (swap & pop), bu sayede dizi boşluksuz kalır.
+ *        Bu nedenle Add/Get ile alınan işaretçiler, aynı türden bir bileşen silinene kadar geçerlidir.
+ *        Sayfalar bir FixedBlockPool üzerinden alınır; istenirse büyük sayfalar (huge pages) ile desteklenir.
+ */
+template<typename T>
+class ComponentPool : public IComponentPool {
+public:
+    static constexpr uint32_t kPageSize = 1024;
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+private:
+    struct Page {
+        alignas(T) unsigned char mBytes[sizeof(T) * kPageSize];
+    };
+
+    FixedBlockPool mPageBlocks;
+    std::vector<Page*> mPages;
+    std::vector<ObjectId> mDense;
+    std::vector<uint32_t> mSparse;
+    size_t mPeakSize = 0;
+
+    T* Slot(uint32_t denseIndex) const {
+        auto* bytes = mPages[denseIndex / kPageSize]->mBytes;
+        return std::launder(reinterpret_cast<T*>(bytes) + (denseIndex % kPageSize));
+    }
+
+public:
+    explicit ComponentPool(PoolBacking backing = PoolBacking::Heap)
+        : mPageBlocks(sizeof(Page), alignof(Page), 1, backing) {}
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+
+    ~ComponentPool() override {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(mDense.size()); i++) {
+            Slot(i)->~T();
+        }
+    }
+
+    /**
+     * @brief Nesneye yeni bir bileşen ekler. Nesnede bu türden bir bileşen varsa yerinde yeniden oluşturulur.
+     */
+    template<typename... Args>
+    T* Add(ObjectId id, Args&&... args) {
+        if (id >= mSparse.size()) {
+            mSparse.resize(static_cast<size_t>(id) + 1, kInvalidIndex);
+            GrowTrackers(mSparse.size());
+        }
+        MarkChanged(id);
+
+        if (mSparse[id] != kInvalidIndex) {
+            T* existing = Slot(mSparse[id]);
+            existing->~T();
+            return ::new (existing) T(std::forward<Args>(args)...);
+        }
+
+        auto denseIndex = static_cast<uint32_t>(mDense.size());
+        if (denseIndex / kPageSize >= mPages.size()) {
+            mPages.push_back(static_cast<Page*>(mPageBlocks.Allocate()));
+        }
+
+        T* ptr = ::new (Slot(denseIndex)) T(std::forward<Args>(args)...);
+        mDense.push_back(id);
+        mSparse[id] = denseIndex;
+        mPeakSize = std::max(mPeakSize, mDense.size());
+        return ptr;
+    }
+
+    /**
+     * @brief ids dizisindeki nesnelere tek geçişte bileşen ekler; i. nesnenin bileşeni make(i) ile oluşturulur.
+     *        Seyrek dizi ve sayfalar bir kez büyütülür ve bileşenler sayfalara art arda kurulur.
+     *        Bu türden bileşeni zaten olan nesnelerde bileşen Add'de olduğu gibi yerinde yeniden oluşturulur.
+     */
+    template<typename Make>
+    void AddMany(std::span<const ObjectId> ids, Make&& make) {
+        ObjectId maxId = 0;
+        for (ObjectId id : ids) {
+            maxId = std::max(maxId, id);
+        }
+        if (!ids.empty() && maxId >= mSparse.size()) {
+            mSparse.resize(static_cast<size_t>(maxId) + 1, kInvalidIndex);
+            GrowTrackers(mSparse.size());
+        }
+        Reserve(mDense.size() + ids.size());
+
+        for (size_t i = 0; i < ids.size(); i++) {
+            const ObjectId id = ids[i];
+            MarkChanged(id);
+            if (mSparse[id] != kInvalidIndex) {
+                T* existing = Slot(mSparse[id]);
+                existing->~T();
+                ::new (existing) T(make(i));
+                continue;
+            }
+
+            const auto denseIndex = static_cast<uint32_t>(mDense.size());
+            ::new (Slot(denseIndex)) T(make(i));
+            mDense.push_back(id);
+            mSparse[id] = denseIndex;
+        }
+        mPeakSize = std::max(mPeakSize, mDense.size());
+    }
+
+    /**
+     * @brief En az count bileşen için sayfa ayırır, böylece toplu eklemelerde ekleme sırasında bellek ayrılmaz.
+     */
+    void Reserve(size_t count) {
+        while (mPages.size() * kPageSize < count) {
+            mPages.push_back(static_cast<Page*>(mPageBlocks.Allocate()));
+        }
+        mDense.reserve(count);
+    }
+
+    T* Get(ObjectId id) const {
+        if (id >= mSparse.size() || mSparse[id] == kInvalidIndex) {
+            return nullptr;
+        }
+        return Slot(mSparse[id]);
+    }
+
+    /**
+     * @brief Nesnenin bu türden bileşeni olduğu biliniyorsa (ör. maske kontrol edildiyse) sınır kontrolü yapmadan erişir.
+     */
+    T* GetUnchecked(ObjectId id) const {
+        return Slot(mSparse[id]);
+    }
+
+    bool Contains(ObjectId id) const override {
+        return id < mSparse.size() && mSparse[id] != kInvalidIndex;
+    }
+
+    Component* GetBase(ObjectId id) override {
+        return Get(id);
+    }
+
+    ObjectId Remove(ObjectId id) override {
+        if (!Contains(id)) {
+            return kInvalidObjectId;
+        }
+
+        MarkChanged(id);
+        uint32_t removedIndex = mSparse[id];
+        uint32_t lastIndex = static_cast<uint32_t>(mDense.size()) - 1;
+        T* removed = Slot(removedIndex);
+        removed->~T();
+
+        ObjectId movedId = kInvalidObjectId;
+        if (removedIndex != lastIndex) {
+            T* last = Slot(lastIndex);
+            ::new (removed) T(std::move(*last));
+            last->~T();
+
+            movedId = mDense[lastIndex];
+            mDense[removedIndex] = movedId;
+            mSparse[movedId] = removedIndex;
+        }
+
+        mDense.pop_back();
+        mSparse[id] = kInvalidIndex;
+        return movedId;
+    }
+
+    size_t Size() const override {
+        return mDense.size();
+    }
+
+    /**
+     * @brief list'i bu havuzu izleyecek şekilde bağlar. Havuzdaki mevcut bileşenlerin sahipleri listeye eklenir,
+     *        böylece tüketici ilk işlemede tüm havuzu görür. Liste başka bir havuzu izliyorsa oradan ayrılır.
+     */
+    void Track(ChangeList& list) {
+        IComponentPool::Track(list, mSparse.size());
+        for (ObjectId id : mDense) {
+            list.Mark(id);
+        }
+    }
+
+    /**
+     * @brief Havuzun doluluk bilgisini bileşen sayısı cinsinden döner. Silinen bileşenlerin yeri yeniden kullanılır,
+     *        bu yüzden kapasite yalnızca eş zamanlı en yüksek bileşen sayısına göre büyür.
+     */
+    PoolStats GetStats() const override {
+        PoolStats stats;
+        stats.mBlockSize = sizeof(T);
+        stats.mCapacity = mPages.size() * kPageSize;
+        stats.mInUse = mDense.size();
+        stats.mPeakInUse = mPeakSize;
+        stats.mChunkCount = mPageBlocks.GetStats().mChunkCount;
+        return stats;
+    }
+
+    /**
+     * @brief Yoğun dizideki i. bileşene ve sahibine erişim sağlar.
+     */
+    T& At(uint32_t denseIndex) const { return *Slot(denseIndex); }
+    ObjectId OwnerAt(uint32_t denseIndex) const { return mDense[denseIndex]; }
+
+    /**
+     * @brief Havuzdaki tüm bileşenleri bellekteki sıralarıyla gezer. fn(ObjectId, T&) şeklinde çağrılır.
+     */
+    template<typename Fn>
+    void ForEach(Fn&& fn) {
+        const auto count = static_cast<uint32_t>(mDense.size());
+        for (uint32_t page = 0; page * kPageSize < count; page++) {
+            T* base = Slot(page * kPageSize);
+            uint32_t end = std::min(count - page * kPageSize, kPageSize);
+            for (uint32_t i = 0; i < end; i++) {
+                fn(mDense[page * kPageSize + i], base[i]);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Belirli bir bileşen maskesinin tamamına sahip olan ve dışlama maskesindeki türlerin hiçbirine sahip
+ *        olmayan nesnelerin listesidir. Liste, ComponentStore tarafından nesnelerin maskesi değiştikçe güncellenir ve tekrar tekrar
+ *        hesaplanmaz. Ekleme ve çıkarma seyrek küme (sparse set) sayesinde O(1)'dir.
+ */
+class MatchList {
+private:
+    ComponentMask mMask;
+    ComponentMask mExclude;
+    std::vector<ObjectId> mDense;
+    std::vector<uint32_t> mSparse;
+
+public:
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    explicit MatchList(ComponentMask mask, ComponentMask exclude = 0) : mMask(mask), mExclude(exclude) {}
+
+    ComponentMask Mask() const { return mMask; }
+    ComponentMask Exclude() const { return mExclude; }
+    bool Matches(ComponentMask mask) const { return (mask & mMask) == mMask && (mask & mExclude) == 0; }
+
+    bool Contains(ObjectId id) const {
+        return id < mSparse.size() && mSparse[id] != kInvalidIndex;
+    }
+
+    void Insert(ObjectId id) {
+        if (id >= mSparse.size()) {
+            mSparse.resize(static_cast<size_t>(id) + 1, kInvalidIndex);
+        }
+        mSparse[id] = static_cast<uint32_t>(mDense.size());
+        mDense.push_back(id);
+    }
+
+    void Erase(ObjectId id) {
+        uint32_t index = mSparse[id];
+        ObjectId last = mDense.back();
+        mDense[index] = last;
+        mSparse[last] = index;
+        mDense.pop_back();
+        mSparse[id] = kInvalidIndex;
+    }
+
+    size_t Size() const { return mDense.size(); }
+    ObjectId IdAt(size_t index) const { return mDense[index]; }
+    const ObjectId* Data() const { return mDense.data(); }
+};
+
+/**
+ * @brief Tüm bileşen havuzlarını barındıran ve nesne numaralarını yöneten depodur.
+ *        GraphicalObject sınıfı bu depo üzerinde hafif bir görünüm (view) olarak çalışır.
+ *        Havuzlar tür numarası ile indekslenir, her nesnenin bileşen maskesi de ayrıca tutulur.
+ *        Böylece GetComponent, maskede tek bit kontrolü ve havuzun seyrek dizisine tek erişim ile O(1) olur.
+ */
+class ComponentStore {
+private:
+    std::array<std::unique_ptr<IComponentPool>, kMaxComponentTypes> mPools;
+    std::vector<ComponentMask> mMasks;
+    std::vector<ObjectId> mFreeIds;
+    ObjectId mNextId = 0;
+    PoolBacking mBacking;
+
+    // View sorguları için önbelleğe alınmış eşleşme listeleri; adresleri sabit kalsın diye ayrı ayrı ayrılır.
+    // Paralel sistemler View oluşturabildiğinden Match bu kilitle korunur
+    std::vector<std::unique_ptr<MatchList>> mMatchLists;
+    std::mutex mMatchMutex;
+
+    /**
+     * @brief Nesnenin maskesi değiştiğinde eşleşme listelerini günceller.
+     */
+    void UpdateMatches(ObjectId id, ComponentMask before, ComponentMask after) {
+        for (auto& list : mMatchLists) {
+            bool matchedBefore = list->Matches(before);
+            bool matchesAfter = list->Matches(after);
+            if (matchedBefore != matchesAfter) {
+                matchesAfter ? list->Insert(id) : list->Erase(id);
+            }
+        }
+    }
+
+public:
+    explicit ComponentStore(PoolBacking backing = PoolBacking::Heap)
+        : mBacking(backing) {}
+    ComponentStore(const ComponentStore&) = delete;
+    ComponentStore& operator=(const ComponentStore&) = delete;
+
+    ObjectId CreateObject();
+    void DestroyObject(ObjectId id);
+
+    /**
+     * @brief En az count nesne için yer ayırır.
+     */
+    void Reserve(size_t count) { mMasks.reserve(count); }
+
+    ComponentMask GetMask(ObjectId id) const {
+        return id < mMasks.size() ? mMasks[id] : 0;
+    }
+
+    /**
+     * @brief T havuzunu döner, yoksa oluşturur. Oluşturma depoyu değiştirdiğinden paralel aşamalarda çalışan
+     *        sistemler bunun yerine FindPool kullanmalıdır.
+     */
+    template<typename T>
+    ComponentPool<T>& Pool() {
+        auto& pool = mPools[ComponentTypeOf<T>()];
+        if (!pool) {
+            pool = std::make_unique<ComponentPool<T>>(mBacking);
+        }
+        return static_cast<ComponentPool<T>&>(*pool);
+    }
+
+    /**
+     * @brief T havuzunu döner; havuz henüz oluşturulmamışsa hiçbir şey oluşturmadan nullptr döner.
+     */
+    template<typename T>
+    ComponentPool<T>* FindPool() const {
+        return static_cast<ComponentPool<T>*>(mPools[ComponentTypeOf<T>()].get());
+    }
+
+    /**
+     * @brief list'i T havuzundaki değişiklikleri izleyecek şekilde bağlar; havuz yoksa oluşturulur.
+     */
+    template<typename T>
+    void Track(ChangeList& list) {
+        Pool<T>().Track(list);
+    }
+
+    /**
+     * @brief Nesnenin T bileşenine doğrudan yazıldığını havuzu izleyen listelere bildirir. Bileşen ekleme ve silme
+     *        kendiliğinden bildirilir; yalnızca yerinde yapılan yazmalar için çağrılır. Sistemlerin paralel
+     *        parçalarından aynı anda çağrılabilir.
+     */
+    template<typename T>
+    void MarkChanged(ObjectId id) const {
+        if (auto* pool = FindPool<T>()) {
+            pool->MarkChanged(id);
+        }
+    }
+
+    template<typename T, typename... Args>
+    T* Add(ObjectId id, Args&&... args) {
+        T* ptr = Pool<T>().Add(id, std::forward<Args>(args)...);
+        const ComponentMask before = mMasks[id];
+        mMasks[id] |= ComponentMaskOf<T>();
+        if (before != mMasks[id]) {
+            UpdateMatches(id, before, mMasks[id]);
+        }
+        return ptr;
+    }
+
+    /**
+     * @brief ids dizisindeki nesnelere T bileşenini toplu olarak ekler; i. bileşen make(i) ile oluşturulur.
+     *        Bileşenlerin Resolve çağrısı yapılmaz; tüm türler eklendikten sonra ResolvePool ile yapılmalıdır.
+     */
+    template<typename T, typename Make>
+    void AddMany(std::span<const ObjectId> ids, Make&& make) {
+        Pool<T>().AddMany(ids, std::forward<Make>(make));
+        const ComponentMask bit = ComponentMaskOf<T>();
+        for (ObjectId id : ids) {
+            const ComponentMask before = mMasks[id];
+            mMasks[id] |= bit;
+            if (before != mMasks[id] && !mMatchLists.empty()) {
+                UpdateMatches(id, before, mMasks[id]);
+            }
+        }
+    }
+
+    /**
+     * @brief T havuzundaki tüm bileşenlerde Resolve çağırır. Toplu eklemelerde nesne nesne ResolveObject çağırmak
+     *        yerine kullanılır; havuzda yalnızca T nesneleri bulunduğundan çağrı sanal tablo üzerinden yapılmaz.
+     */
+    template<typename T>
+    void ResolvePool() {
+        Pool<T>().ForEach([](ObjectId, T& component) {
+            component.T::Resolve();
+        });
+    }
+
+    template<typename T>
+    T* Get(ObjectId id) const {
+        const ComponentTypeId type = ComponentTypeOf<T>();
+        if (id >= mMasks.size() || (mMasks[id] & (ComponentMask{1} << type)) == 0) {
+            return nullptr;
+        }
+        return static_cast<const ComponentPool<T>*>(mPools[type].get())->GetUnchecked(id);
+    }
+
+    /**
+     * @brief Bileşeni siler; hem bileşeni silinen nesnenin hem de bileşeni taşınan nesnenin bağlarını yeniler.
+     */
+    template<typename T>
+    void Remove(ObjectId id) {
+        Remove(id, ComponentTypeOf<T>());
+    }
+
+    /**
+     * @brief Tür numarası ile bileşen siler; türün derleme zamanında bilinmediği yerler (ör. komut tamponu) içindir.
+     */
+    void Remove(ObjectId id, ComponentTypeId type) {
+        if (id < mMasks.size() && (mMasks[id] & (ComponentMask{1} << type)) != 0) {
+            ObjectId movedId = mPools[type]->Remove(id);
+            const ComponentMask before = mMasks[id];
+            mMasks[id] &= ~(ComponentMask{1} << type);
+            UpdateMatches(id, before, mMasks[id]);
+
+            ResolveObject(id);
+            if (movedId != kInvalidObjectId) {
+                ResolveObject(movedId);
+            }
+        }
+    }
+
+    /**
+     * @brief Maskenin tamamına sahip olan ve exclude maskesindeki türlerin hiçbirine sahip olmayan nesnelerin
+     *        listesini döner. Liste ilk istendiğinde bir kez oluşturulur, sonrasında bileşen ekleme ve silme
+     *        işlemleriyle birlikte güncel tutulur. Aynı aşamada paralel çalışan sistemlerden aynı anda çağrılabilir;
+     *        bileşen ekleyen ya da silen çağrılarla aynı anda çağrılmamalıdır.
+     */
+    const MatchList& Match(ComponentMask mask, ComponentMask exclude = 0);
+
+    /**
+     * @brief Nesnenin tüm bileşenlerinde Resolve çağırır.
+     */
+    void ResolveObject(ObjectId id) {
+        ForEachComponent(id, [](Component& component) {
+            component.Resolve();
+        });
+    }
+
+    /**
+     * @brief Verilen nesneye ait tüm bileşenleri tür numarası sırasıyla gezer. fn(Component&) şeklinde çağrılır.
+     */
+    template<typename Fn>
+    void ForEachComponent(ObjectId id, Fn&& fn) {
+        for (ComponentMask mask = GetMask(id); mask != 0; mask &= mask - 1) {
+            auto type = static_cast<ComponentTypeId>(std::countr_zero(mask));
+            fn(*mPools[type]->GetBase(id));
+        }
+    }
+};
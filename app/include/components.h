@@ -11,6 +11,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,12 @@ public:
     virtual ~Component() = default;
     virtual void Update(float deltaTime) {}
     virtual void Render(Renderer& renderer) {}
+
+    /**
+     * @brief Bileşen bir nesneye eklendiğinde ve nesnenin bileşenleri değiştiğinde (ekleme, silme ya da
+     *        havuz içinde taşınma) çağrılır. Diğer bileşenlere işaretçi tutan bileşenler bunları burada bağlar.
+     */
+    virtual void Resolve() {}
 };
 
 /** 
@@ -39,8 +46,51 @@ public:
     float mRotation = 0.0F;
     float mScaleX = 1.0F;
     float mScaleY = 1.0F;
+
+    // Bir önceki simülasyon adımındaki değerler; çizim, iki adım arasındaki ara konumu bunlarla hesaplar
+    float mPrevX = 0.0F;
+    float mPrevY = 0.0F;
+    float mPrevRotation = 0.0F;
+
+    // Teleport ile kurulur; SceneGraph çocukların dünya dönüşümüne ara değer uygulamamak için okur ve temizler
+    bool mTeleported = false;
     
-    Transform(float x = 0, float y = 0) : mX(x), mY(y) {}
+    Transform(float x = 0, float y = 0) : mX(x), mY(y), mPrevX(x), mPrevY(y) {}
+
+    /**
+     * @brief Güncel değerleri önceki adım olarak saklar. Her simülasyon adımının başında çağrılır.
+     */
+    void SnapshotPrevious() {
+        mPrevX = mX;
+        mPrevY = mY;
+        mPrevRotation = mRotation;
+    }
+
+    /**
+     * @brief Nesnenin ışınlandığını (ör. ekran kenarından sarılması) bildirir, böylece ara değer hesaplanmaz.
+     *        Bileşenin sahibi varsa değişiklik Transform havuzunu izleyenlere (ör. SceneGraph) de bildirilir.
+     */
+    void Teleport();
+
+    /**
+     * @brief Önceki ve güncel adım arasında alpha (0..1) oranında ara değer alınmış bir kopya döner.
+     */
+    Transform Interpolated(float alpha) const {
+        Transform result = *this;
+        result.mX = mPrevX + (mX - mPrevX) * alpha;
+        result.mY = mPrevY + (mY - mPrevY) * alpha;
+        result.mRotation = mPrevRotation + (mRotation - mPrevRotation) * alpha;
+        return result;
+    }
+};
+
+/**
+ * @brief Sahne ağacında bir ebeveyne bağlı nesnenin dünya koordinatlarındaki dönüşümüdür.
+ *        SceneGraph tarafından yazılır; nesnenin Transform bileşeni ise ebeveyne göre yerel dönüşüm olarak kalır.
+ */
+class WorldTransform : public Transform {
+public:
+    using Transform::Transform;
 };
 
 /** 
@@ -63,10 +113,24 @@ class RenderStrategy;
 class RenderComponent 
     : public Component {
 private:
-    std::unique_ptr<RenderStrategy> mStrategy;
+    // Aynı prefab'dan oluşturulan nesneler tek bir strateji nesnesini paylaşır
+    std::shared_ptr<RenderStrategy> mStrategy;
+
+    // Sahip nesnenin dönüşüm bileşeni, her karede aranmaması için Resolve ile bağlanır
+    Transform* mTransform = nullptr;
+
+    // Çizim kuyruğundaki katman: küçük katman altta çizilir
+    uint8_t mLayer = 0;
 
 public:
-    RenderComponent(std::unique_ptr<RenderStrategy> strategy);    
-    void SetStrategy(std::unique_ptr<RenderStrategy> strategy);    
+    RenderComponent(std::shared_ptr<RenderStrategy> strategy);    
+    void SetStrategy(std::shared_ptr<RenderStrategy> strategy);    
     void Render(Renderer& renderer) override;
+    void Resolve() override;
+
+    const Transform* GetBoundTransform() const { return mTransform; }
+    const std::shared_ptr<RenderStrategy>& GetStrategy() const { return mStrategy; }
+
+    void SetLayer(uint8_t layer) { mLayer = layer; }
+    uint8_t GetLayer() const { return mLayer; }
 };
@@ -0,0 +1,137 @@
+/**
+ * @file dynamic-aabb-tree.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Hareketli nesnelerin eksene hizalı sınır kutularını tutan dinamik sınır hacmi hiyerarşisi (BVH).
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Eksene hizalı sınır kutusudur (AABB).
+ */
+struct Aabb {
+    float mMinX = 0.0f;
+    float mMinY = 0.0f;
+    float mMaxX = 0.0f;
+    float mMaxY = 0.0f;
+
+    bool Overlaps(const Aabb& other) const {
+        return mMinX <= other.mMaxX && other.mMinX <= mMaxX && mMinY <= other.mMaxY && other.mMinY <= mMaxY;
+    }
+
+    bool Contains(const Aabb& other) const {
+        return mMinX <= other.mMinX && mMinY <= other.mMinY && other.mMaxX <= mMaxX && other.mMaxY <= mMaxY;
+    }
+
+    float Perimeter() const {
+        return 2.0f * ((mMaxX - mMinX) + (mMaxY - mMinY));
+    }
+
+    Aabb Expanded(float margin) const {
+        return Aabb{mMinX - margin, mMinY - margin, mMaxX + margin, mMaxY + margin};
+    }
+
+    static Aabb Union(const Aabb& first, const Aabb& second) {
+        return Aabb{std::min(first.mMinX, second.mMinX), std::min(first.mMinY, second.mMinY),
+                    std::max(first.mMaxX, second.mMaxX), std::max(first.mMaxY, second.mMaxY)};
+    }
+};
+
+/**
+ * @brief DynamicAabbTree, her yaprağında bir nesnenin genişletilmiş (fat) sınır kutusu bulunan ikili ağaçtır.
+ *        Yaprak kutuları margin kadar geniş tutulduğundan nesne bu kutunun içinde kaldığı sürece ağaç değişmez;
+ *        yalnızca kutusundan çıkan nesneler çıkarılıp yeniden eklenir. Ekleme, kutuların çevre uzunluğu üzerinden
+ *        en ucuz kardeşi seçer ve ağaç AVL dönmeleri ile dengede tutulur. Böylece bir bölge sorgusu yalnızca o bölgeyle
+ *        kesişen dalları gezer ve maliyeti toplam nesne sayısına değil bulunan nesne sayısına bağlı olur.
+ *        Düğümler tek bir dizide tutulur ve silinen düğümler serbest listeden yeniden kullanılır.
+ */
+class DynamicAabbTree {
+public:
+    static constexpr int32_t kNullNode = -1;
+
+private:
+    struct Node {
+        Aabb mBox;
+        // Serbest düğümlerde bir sonraki serbest düğümü gösterir
+        int32_t mParent = kNullNode;
+        int32_t mChild1 = kNullNode;
+        int32_t mChild2 = kNullNode;
+        // Yapraklar için 0, serbest düğümler için -1
+        int32_t mHeight = -1;
+        uint32_t mUserData = 0;
+
+        bool IsLeaf() const { return mChild1 == kNullNode; }
+    };
+
+    std::vector<Node> mNodes;
+    int32_t mRoot = kNullNode;
+    int32_t mFreeList = kNullNode;
+    size_t mProxyCount = 0;
+    float mMargin;
+
+    // Sorgu sırasında kullanılan yığın, her sorguda bellek ayırmamak için saklanır
+    mutable std::vector<int32_t> mStack;
+
+    int32_t AllocateNode();
+    void FreeNode(int32_t node);
+    void InsertLeaf(int32_t leaf);
+    void RemoveLeaf(int32_t leaf);
+    int32_t Balance(int32_t node);
+    void ReplaceChild(int32_t parent, int32_t oldChild, int32_t newChild);
+
+public:
+    explicit DynamicAabbTree(float margin = 8.0f);
+
+    /**
+     * @brief box kutusu için yeni bir yaprak oluşturur ve numarasını döner. userData sorgularda geri verilir.
+     */
+    int32_t CreateProxy(const Aabb& box, uint32_t userData);
+    void DestroyProxy(int32_t proxy);
+
+    /**
+     * @brief Yaprağın kutusunu günceller. Yeni kutu genişletilmiş kutunun içinde kalıyorsa ağaç değişmez ve false döner.
+     */
+    bool MoveProxy(int32_t proxy, const Aabb& box);
+
+    uint32_t GetUserData(int32_t proxy) const { return mNodes[proxy].mUserData; }
+    const Aabb& GetFatBox(int32_t proxy) const { return mNodes[proxy].mBox; }
+
+    /**
+     * @brief box ile kesişen tüm yapraklar için fn(userData) çağırır.
+     */
+    template<typename Fn>
+    void Query(const Aabb& box, Fn&& fn) const {
+        if (mRoot == kNullNode) {
+            return;
+        }
+
+        mStack.clear();
+        mStack.push_back(mRoot);
+        while (!mStack.empty()) {
+            const Node& node = mNodes[mStack.back()];
+            mStack.pop_back();
+            if (!node.mBox.Overlaps(box)) {
+                continue;
+            }
+            if (node.IsLeaf()) {
+                fn(node.mUserData);
+            } else {
+                mStack.push_back(node.mChild1);
+                mStack.push_back(node.mChild2);
+            }
+        }
+    }
+
+    size_t ProxyCount() const { return mProxyCount; }
+    int32_t Height() const { return mRoot == kNullNode ? 0 : mNodes[mRoot].mHeight; }
+
+    /**
+     * @brief Ebeveyn bağlantılarını, yükseklikleri ve kutuların çocuklarını kapsadığını doğrular. Testler içindir.
+     */
+    bool Validate() const;
+};
@@ -0,0 +1,26 @@
+/**
+ * @file entity.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Nesnelere dışarıdan güvenli şekilde erişmek için kullanılan kuşak (generation) bilgili tutamaç.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Entity, bir nesnenin depodaki indeksini ve o indeksin kaçıncı kez kullanıldığını tutar.
+ *        Nesne silinip indeks yeniden kullanıldığında kuşak numarası artar,
+ *        böylece eski tutamaçlar geçersiz (stale) olarak tespit edilebilir.
+ */
+struct Entity {
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    uint32_t mIndex = kInvalidIndex;
+    uint32_t mGeneration = 0;
+
+    bool IsNull() const { return mIndex == kInvalidIndex; }
+
+    bool operator==(const Entity& other) const = default;
+};
@@ -0,0 +1,39 @@
+/**
+ * @file fixed-timestep.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Simülasyonu kare hızından bağımsız, sabit adım süresiyle ilerletmek için kullanılan biriktirici.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief FixedTimestep, her karede geçen gerçek süreyi biriktirir ve bunu sabit uzunluktaki adımlara böler.
+ *        Böylece simülasyon her makinede aynı adım süresiyle çalışır ve sonuçlar tekrarlanabilir olur.
+ *        Takılan bir karenin ardından yapılacak adım sayısı sınırlandırılır; sınırı aşan süre atılır,
+ *        aksi halde yavaş makinelerde adımlar birikerek simülasyon hiç yetişemez hale gelir (spiral of death).
+ *        Alpha, biriktiricide kalan sürenin adım süresine oranıdır ve çizimde ara değer almak için kullanılır.
+ */
+class FixedTimestep {
+private:
+    double mStepSeconds;
+    uint32_t mMaxStepsPerFrame;
+    double mAccumulator = 0.0;
+    uint64_t mTickCount = 0;
+
+public:
+    explicit FixedTimestep(double ticksPerSecond = 60.0, uint32_t maxStepsPerFrame = 5);
+
+    void SetTickRate(double ticksPerSecond);
+    void SetMaxStepsPerFrame(uint32_t maxStepsPerFrame) { mMaxStepsPerFrame = maxStepsPerFrame; }
+
+    /**
+     * @brief Kare süresini biriktiriciye ekler ve bu karede çalıştırılması gereken adım sayısını döner.
+     */
+    uint32_t Advance(double frameSeconds);
+
+    float StepSeconds() const { return static_cast<float>(mStepSeconds); }
+    float Alpha() const { return static_cast<float>(mAccumulator / mStepSeconds); }
+    uint64_t TickCount() const { return mTickCount; }
+};
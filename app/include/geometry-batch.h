@@ -0,0 +1,79 @@
+/**
+ * @file geometry-batch.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Bir kare boyunca çizilen tüm şekilleri tek bir köşe/indeks akışında toplayan çizim toplayıcı.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "sdl-resource.h"
+
+/**
+ * @brief GeometryBatch, şekilleri renkleri köşelerde olan üçgenler olarak biriktirir ve Flush ile gönderir.
+ *        Köşeler ve indeksler kare boyunca büyüyen tek bir dizide tutulur; her şekil kendi köşelerini
+ *        AppendVertices, üçgenlerini AppendIndices ile ekler. Ardışık eklemeler aynı dokuyu kullandığı sürece
+ *        aynı parçaya eklenir; Flush her parça için tek bir SDL_RenderGeometry çağrısı yapar. Dokusuz bir karede
+ *        bu tek bir çağrı demektir. Çizim sırası korunur, dokular arasında gidip gelmek yeni parça açar.
+ *        Diziler Flush sonrasında boşaltılır ama kapasiteleri korunur, böylece kararlı durumda bellek ayrılmaz.
+ */
+class GeometryBatch {
+private:
+    struct Segment {
+        SDL_Texture* mTexture;
+        size_t mFirstIndex;
+        size_t mIndexCount;
+    };
+
+    std::vector<SDL_Vertex> mVertices;
+    std::vector<int> mIndices;
+    std::vector<Segment> mSegments;
+
+    void AddQuad(const SDL_FRect& rect, SDL_FColor color, SDL_Texture* texture);
+
+public:
+    /**
+     * @brief count köşelik yer açar ve ilk köşenin adresini döner. Köşelerin akıştaki numaraları
+     *        çağrıdan önceki VertexCount değerinden başlar. Adres bir sonraki eklemeye kadar geçerlidir.
+     */
+    SDL_Vertex* AppendVertices(size_t count);
+
+    /**
+     * @brief texture ile çizilecek count indekslik yer açar ve ilk indeksin adresini döner. İndeksler akıştaki
+     *        köşe numaralarıdır. Adres bir sonraki eklemeye kadar geçerlidir.
+     */
+    int* AppendIndices(size_t count, SDL_Texture* texture = nullptr);
+
+    /**
+     * @brief Eksenlere hizalı, tek renkli bir dikdörtgen ekler.
+     */
+    void AddRect(const SDL_FRect& rect, SDL_FColor color);
+
+    /**
+     * @brief texture dokusunun tamamını rect dörtgenine gerilmiş olarak ekler; doku renkleri tint ile çarpılır.
+     */
+    void AddTexturedRect(const SDL_FRect& rect, SDL_Texture* texture, SDL_FColor tint = {1.0f, 1.0f, 1.0f, 1.0f});
+
+    /**
+     * @brief Tek renkli bir üçgen ekler.
+     */
+    void AddTriangle(SDL_FPoint first, SDL_FPoint second, SDL_FPoint third, SDL_FColor color);
+
+    /**
+     * @brief Biriken tüm şekilleri doku başına bir SDL_RenderGeometry çağrısı ile çizer, akışı boşaltır ve
+     *        yapılan çağrı sayısını döner.
+     */
+    size_t Flush(SDL_Renderer* renderer);
+
+    /**
+     * @brief Biriken şekilleri çizmeden atar.
+     */
+    void Clear();
+
+    bool Empty() const { return mIndices.empty(); }
+    size_t VertexCount() const { return mVertices.size(); }
+    size_t IndexCount() const { return mIndices.size(); }
+    size_t SegmentCount() const { return mSegments.size(); }
+};
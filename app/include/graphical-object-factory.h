@@ -7,49 +7,105 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "components.h"
+#include "component-store.h"
+#include "entity.h"
 #include "sdl-renderer.h"
 
 /** 
  * @brief GraphicalObject, oyun nesnelerini temsil eden ve bileşenleri yöneten sınıftır.
+ *        Bileşenler nesnenin içinde değil, ComponentStore içerisindeki tür bazlı havuzlarda tutulur.
+ *        Bu sınıf ise depo ve Entity tutamacından oluşan hafif bir görünümdür, nesnelerin sahibi Registry'dir.
  */
 class GraphicalObject {
 private:
-    std::vector<std::unique_ptr<Component>> mComponents;
+    friend class Registry;
+
+    ComponentStore* mStore;
+    Entity mEntity;
+
+    void Rebind(Entity entity) { mEntity = entity; }
     
 public:
+    GraphicalObject(ComponentStore& store, Entity entity);
+
+    GraphicalObject(const GraphicalObject&) = delete;
+    GraphicalObject& operator=(const GraphicalObject&) = delete;
+
+    Entity GetEntity() const { return mEntity; }
+    ObjectId GetId() const { return mEntity.mIndex; }
+
     template<typename T, typename... Args>
     T* AddComponent(Args&&... args) {
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
-        T* ptr = component.get();
+        T* ptr = mStore->Add<T>(mEntity.mIndex, std::forward<Args>(args)...);
         ptr->mOwner = this;
-        mComponents.push_back(std::move(component));
+        mStore->ResolveObject(mEntity.mIndex);
         return ptr;
     }
     
     template<typename T>
     T* GetComponent() const {
-        for (const auto& component : mComponents) {
-            if (auto* ptr = dynamic_cast<T*>(component.get())) {
-                return ptr;
-            }
-        }
-        return nullptr;
+        return mStore->Get<T>(mEntity.mIndex);
+    }
+
+    template<typename T>
+    void RemoveComponent() {
+        mStore->Remove<T>(mEntity.mIndex);
+    }
+
+    /**
+     * @brief T bileşenine doğrudan yazıldığını havuzu izleyenlere bildirir (bkz. ComponentStore::MarkChanged).
+     */
+    template<typename T>
+    void MarkChanged() const {
+        mStore->MarkChanged<T>(mEntity.mIndex);
     }
     
     void Update(float deltaTime);    
     void Render(Renderer& renderer);
 };
 
+class Registry;
+class RenderStrategy;
+
+/**
+ * @brief Prefab, aynı türden çok sayıda nesne oluşturmak için kullanılan şablondur.
+ *        Render stratejisi bu prefab'dan oluşturulan tüm nesneler (tüm Registry'ler dahil) arasında paylaşılır;
+ *        bu yüzden stratejiler nesneye özgü durum tutmamalıdır.
+ */
+struct Prefab {
+    Velocity mVelocity;
+    std::shared_ptr<RenderStrategy> mStrategy;
+};
+
 /** 
  * @brief GraphicalObjectFactory, grafiksek nesneleri oluşturan fabrika sınıfıdır.
  *        Bu sınıf, farklı türdeki grafik nesnelerini (örneğin, dikdortgen ve daire) oluşturmak için kullanılabilir.
  */
 class GraphicalObjectFactory {
 public:
-    static std::unique_ptr<GraphicalObject> CreateRectangle(float x, float y);
-    static std::unique_ptr<GraphicalObject> CreateCircle(float x, float y);
-    static std::unique_ptr<GraphicalObject> CreateTriangle(float x, float y);
+    static Entity CreateRectangle(Registry& registry, float x, float y);
+    static Entity CreateCircle(Registry& registry, float x, float y);
+    static Entity CreateTriangle(Registry& registry, float x, float y);
+
+    /**
+     * @brief Hazır şekiller için varsayılan prefab'lar.
+     */
+    static const Prefab& RectanglePrefab();
+    static const Prefab& CirclePrefab();
+    static const Prefab& TrianglePrefab();
+
+    static Entity Spawn(Registry& registry, const Prefab& prefab, float x, float y);
+
+    /**
+     * @brief Prefab'dan tek geçişte count adet nesne oluşturur ve tutamaçlarını döner.
+     *        Kayıt ve bileşen havuzlarında önce toplu yer ayrılır, böylece aynı türdeki bileşenler bellekte
+     *        art arda dizilir ve oluşturma sırasında bellek ayrılmaz. positions boşsa nesneler orijinde oluşturulur,
+     *        aksi halde en az count eleman içermelidir.
+     */
+    static std::vector<Entity> SpawnMany(Registry& registry, const Prefab& prefab, size_t count,
+                                         std::span<const SDL_FPoint> positions = {});
 };
\ No newline at end of file
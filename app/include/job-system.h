@@ -0,0 +1,144 @@
+/**
+ * @file job-system.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief İşleri çekirdeklere dağıtan, iş çalma (work stealing) yöntemini kullanan iş parçacığı havuzu.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Bir grup işin tamamlanmasını beklemek için kullanılan sayaçtır.
+ *        Gruptaki bir iş istisna fırlatırsa ilk istisna saklanır ve Wait tarafından yeniden fırlatılır.
+ */
+class WaitGroup {
+private:
+    friend class JobSystem;
+    std::atomic<uint32_t> mPending{0};
+    std::mutex mErrorMutex;
+    std::exception_ptr mError;
+
+    void Fail(std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(mErrorMutex);
+        if (!mError) {
+            mError = std::move(error);
+        }
+    }
+
+public:
+    bool IsDone() const { return mPending.load(std::memory_order_acquire) == 0; }
+};
+
+/**
+ * @brief JobSystem, her iş parçacığı için ayrı bir iş kuyruğu tutar.
+ *        İş parçacığı kendi kuyruğunun sonundan iş alır, kuyruğu boşaldığında diğer kuyrukların
+ *        başından iş çalar. Böylece yük kendiliğinden dengelenir.
+ *        Wait çağıran iş parçacığı da beklerken bekleyen işleri çalıştırır; bu sayede ana iş parçacığı
+ *        boşta kalmaz ve hiç yardımcı iş parçacığı olmayan makinelerde de sistem çalışmaya devam eder.
+ *        Çalıştıracak iş kalmadığında Wait, grubun son işi bitene ya da yeni iş gelene kadar uyur.
+ */
+class JobSystem {
+private:
+    struct Job {
+        std::function<void()> mTask;
+        WaitGroup* mGroup = nullptr;
+    };
+
+    struct WorkQueue {
+        std::mutex mMutex;
+        std::deque<Job> mJobs;
+    };
+
+    // Son kuyruk, havuz dışındaki iş parçacıklarının (ör. ana iş parçacığı) gönderdiği işler içindir
+    std::vector<std::unique_ptr<WorkQueue>> mQueues;
+    std::vector<std::thread> mWorkers;
+    std::atomic<uint32_t> mQueuedJobs{0};
+    std::atomic<uint32_t> mNextQueue{0};
+    std::atomic<bool> mStopping{false};
+    std::mutex mSleepMutex;
+    std::condition_variable mWake;
+
+    // Wait içinde uyuyan iş parçacıkları; sayaç mSleepMutex ile korunur
+    std::condition_variable mFinished;
+    uint32_t mWaiters = 0;
+
+    uint32_t HomeQueue() const;
+    bool TryPop(uint32_t queueIndex, bool fromBack, Job& job);
+    bool TryRunOne(uint32_t homeQueue);
+    void WorkerLoop(uint32_t workerIndex);
+
+public:
+    /**
+     * @brief Varsayılan olarak donanımdaki çekirdek sayısından bir eksik yardımcı iş parçacığı oluşturur,
+     *        kalan çekirdeği Wait ile işlere katılan ana iş parçacığı kullanır.
+     */
+    JobSystem();
+    explicit JobSystem(uint32_t workerCount);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    uint32_t WorkerCount() const { return static_cast<uint32_t>(mWorkers.size()); }
+
+    /**
+     * @brief İşi kuyruğa ekler. İş tamamlandığında group sayacı azaltılır.
+     *        Bir iş çalışırken yeni işler göndermesi desteklenir.
+     */
+    void Submit(WaitGroup& group, std::function<void()> task);
+
+    /**
+     * @brief Gruptaki tüm işler bitene kadar bekler, beklerken kuyruktaki işleri çalıştırır.
+     *        İşlerden biri istisna fırlattıysa tüm işler bittikten sonra ilk istisnayı yeniden fırlatır.
+     */
+    void Wait(WaitGroup& group);
+
+    /**
+     * @brief [0, count) aralığını en az grainSize büyüklüğünde parçalara bölerek paralel çalıştırır.
+     *        fn(begin, end) şeklinde çağrılır ve tüm parçalar bitince döner. Bir parça istisna fırlatırsa,
+     *        fn'e başvuran işler yığındaki grupla birlikte yok olmasın diye önce tüm parçalar beklenir, ardından ilk
+     *        istisna yeniden fırlatılır.
+     */
+    template<typename Fn>
+    void ParallelFor(size_t count, size_t grainSize, Fn&& fn) {
+        if (count == 0) {
+            return;
+        }
+
+        const size_t threadCount = static_cast<size_t>(WorkerCount()) + 1;
+        grainSize = std::max<size_t>(grainSize, 1);
+
+        if (threadCount == 1 || count <= grainSize) {
+            fn(size_t{0}, count);
+            return;
+        }
+
+        // Yük dengesi için iş parçacığı başına birkaç parça oluşturulur
+        const size_t chunkCount = std::min((count + grainSize - 1) / grainSize, threadCount * 4);
+        const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+        WaitGroup group;
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+            const size_t end = std::min(begin + chunkSize, count);
+            Submit(group, [&fn, begin, end]() { fn(begin, end); });
+        }
+
+        try {
+            fn(size_t{0}, std::min(chunkSize, count));
+        } catch (...) {
+            group.Fail(std::current_exception());
+        }
+        Wait(group);
+    }
+};
@@ -0,0 +1,69 @@
+/**
+ * @file movement-system.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Transform/Velocity çiftlerini toplu halde ve SIMD komutları ile güncelleyen hareket sistemi.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "component-store.h"
+#include "job-system.h"
+#include "system-scheduler.h"
+
+/**
+ * @brief Kullanılabilecek vektör komut seti seviyeleridir.
+ */
+enum class SimdLevel {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+/**
+ * @brief MovementSystem, tüm hız bileşenlerini tek geçişte konumlara uygular.
+ *        Asıl hesap, konum ve hızların ayrı diziler (SoA) halinde verildiği çekirdek fonksiyonlarda yapılır.
+ *        Not: 1M nesne için tek çekirdekte 1 ms hedefini yalnızca çekirdek karşılar; toplama ve geri yazma dahil
+ *        Update yaklaşık 4.8 ms sürer ve hedefin altında kalmaz.
+ *        Çekirdek AVX2 ile 8, SSE2 ile 4 nesneyi aynı anda işler ve pencere sınırlarındaki sarmalamayı (wrap)
+ *        dallanma olmadan maskeler ile yapar. İşlemci AVX2 desteklemiyorsa SSE2, x86 dışında ise skaler yol seçilir.
+ *        Nesneler View<Transform, Velocity> ile bulunur; RigidBody taşıyanlar PhysicsSystem'e ait olduğundan
+ *        atlanır. JobSystem verildiğinde eşleşme listesi parçalara
+ *        bölünür ve her parça ayrı bir çekirdekte işlenir. Parçalar da kBlockSize nesnelik bloklar halinde
+ *        toplanıp işlenir ve geri yazılır; SoA ara dizileri yığında durduğundan birinci seviye önbellekten çıkmaz.
+ */
+class MovementSystem : public System {
+private:
+    static constexpr size_t kGrainSize = 16384;
+    static constexpr size_t kBlockSize = 512;
+
+    float mWidth;
+    float mHeight;
+
+public:
+    MovementSystem(float width, float height);
+
+    /**
+     * @brief Depodaki hız bileşeni olan ve dönüşümü bulunan, RigidBody taşımayan tüm nesneleri deltaTime kadar ilerletir.
+     *        Yalnızca konumu gerçekten değişen (hızı sıfırdan farklı ya da kenardan sarılan) nesneler Transform
+     *        havuzunu izleyenlere bildirilir.
+     */
+    void Update(ComponentStore& store, float deltaTime, JobSystem* jobs = nullptr);
+
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+
+    /**
+     * @brief x += vx * dt, y += vy * dt uygular; 0'ın altına inen konumu sınıra, sınırı aşanı 0'a sarar.
+     *        Çalışılan makinede desteklenen en geniş komut seti kullanılır.
+     */
+    static void Integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+                          float deltaTime, float width, float height);
+    static void Integrate(SimdLevel level, float* x, float* y, const float* vx, const float* vy, size_t count,
+                          float deltaTime, float width, float height);
+
+    static SimdLevel DetectSimdLevel();
+};
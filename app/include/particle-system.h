@@ -0,0 +1,149 @@
+/**
+ * @file particle-system.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Parçacıkları ayrı diziler (SoA) halinde tutan yayıcı bileşeni ve onları SIMD ile güncelleyen sistem.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "components.h"
+#include "movement-system.h"
+#include "sdl-resource.h"
+#include "system-scheduler.h"
+
+/**
+ * @brief Bir yayıcının parçacık üretme ayarlarıdır. Açılar radyan, süreler saniye, hızlar piksel/saniye cinsindendir.
+ */
+struct ParticleEmitterSettings {
+    // Saniyede üretilen parçacık sayısı ve aynı anda yaşayabilecek en fazla parçacık
+    float mRate = 100.0f;
+    uint32_t mMaxParticles = 1024;
+
+    float mMinLifetime = 1.0f;
+    float mMaxLifetime = 2.0f;
+
+    // Parçacıklar mDirection etrafında mSpread genişliğindeki açıdan rastgele bir yönde çıkar
+    float mDirection = 0.0f;
+    float mSpread = 6.2831853f;
+    float mMinSpeed = 50.0f;
+    float mMaxSpeed = 100.0f;
+
+    float mGravityX = 0.0f;
+    float mGravityY = 0.0f;
+
+    float mSize = 2.0f;
+    SDL_FColor mStartColor{1.0f, 1.0f, 1.0f, 1.0f};
+    SDL_FColor mEndColor{1.0f, 1.0f, 1.0f, 0.0f};
+};
+
+/**
+ * @brief ParticleEmitter, sahip nesnenin konumundan parçacık üreten bileşendir.
+ *        Parçacıklar birer GraphicalObject değildir; konum, hız, yaş ve ömür değerleri ayrı dizilerde, canlılar
+ *        dizilerin başında bitişik olarak tutulur. Diziler oluşturulurken mMaxParticles boyutuna ayrılır, böylece
+ *        güncelleme ve üretim sırasında bellek ayrılmaz. Yaş, ömre bölünmüş (0..1) olarak saklanır; renk bu orana
+ *        göre başlangıç ve bitiş renkleri arasında ara değer alır.
+ *        Güncelleme bileşenin sanal Update fonksiyonu ile değil ParticleSystem ile yapılır.
+ */
+class ParticleEmitter : public Component {
+private:
+    ParticleEmitterSettings mSettings;
+
+    std::vector<float> mX;
+    std::vector<float> mY;
+    std::vector<float> mVx;
+    std::vector<float> mVy;
+    std::vector<float> mAge;
+    std::vector<float> mInverseLifetime;
+    size_t mCount = 0;
+
+    float mSpawnAccumulator = 0.0f;
+    float mLastStep = 0.0f;
+    uint32_t mRandomState;
+    bool mEmitting = true;
+
+    // Sahip nesnenin dönüşüm bileşeni; RenderComponent gibi Resolve ile bağlanır
+    Transform* mTransform = nullptr;
+
+    float NextRandom();
+    void Spawn(size_t count);
+
+public:
+    explicit ParticleEmitter(const ParticleEmitterSettings& settings = {}, uint32_t seed = 1);
+
+    void Resolve() override;
+
+    /**
+     * @brief Zamanla üretilecek yeni parçacıkları ekler, tüm parçacıkları deltaTime kadar ilerletir ve ömrü dolanları
+     *        siler. Yayıcı kapalıysa yalnızca mevcut parçacıklar ilerletilir.
+     */
+    void Simulate(float deltaTime);
+
+    /**
+     * @brief Yayıcının konumundan hemen count parçacık üretir; kapasiteyi aşan kısım atılır.
+     */
+    void Burst(size_t count);
+
+    /**
+     * @brief Canlı parçacıkları birer üçgen olarak out dizisine yazar; dizide VertexCount kadar yer olmalıdır.
+     *        Konumlar son adımın hızıyla alpha oranına geri çekilir, böylece çizim diğer nesnelerle aynı ara değeri
+     *        kullanır.
+     */
+    void WriteVertices(SDL_Vertex* out, float alpha) const;
+    size_t VertexCount() const { return mCount * 3; }
+
+    void SetEmitting(bool emitting) { mEmitting = emitting; }
+    bool IsEmitting() const { return mEmitting; }
+    const ParticleEmitterSettings& GetSettings() const { return mSettings; }
+
+    size_t Count() const { return mCount; }
+    size_t Capacity() const { return mX.size(); }
+    float X(size_t index) const { return mX[index]; }
+    float Y(size_t index) const { return mY[index]; }
+    float Age(size_t index) const { return mAge[index]; }
+};
+
+/**
+ * @brief ParticleSystem, depodaki tüm yayıcıları günceller. Yayıcılar birbirinden bağımsız olduğundan JobSystem
+ *        üzerinde paralel işlenir. Konumları okuduğundan dönüşümlere yazan sistemlerden sonra eklenmelidir.
+ *
+ *        Her yayıcıda önce Integrate çekirdeği hız, konum ve yaşı günceller; çekirdek MovementSystem ile aynı şekilde
+ *        AVX2 ile 8, SSE2 ile 4 parçacığı birlikte işler. Ardından Compact, ömrü dolmuş parçacıkları dallanma
+ *        olmadan siler: her parçacık yazma konumuna kopyalanır ve konum yalnızca parçacık canlıysa ilerletilir.
+ *        Sıra korunduğundan sonuç komut setinden bağımsızdır.
+ */
+class ParticleSystem : public System {
+public:
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+
+    /**
+     * @brief Tüm yayıcıların parçacıklarını tek bir köşe dizisinde toplar. Dizi parçacık sayısına göre yeniden
+     *        boyutlandırılır; kapasitesi korunduğundan kararlı durumda bellek ayrılmaz.
+     */
+    static void BuildVertices(ComponentStore& store, float alpha, std::vector<SDL_Vertex>& vertices);
+
+    /**
+     * @brief BuildVertices ile toplanan tüm parçacıkları tek bir SDL_RenderGeometry çağrısı ile çizer.
+     *        Dokusuz geometri çizim harmanlama kipiyle çizildiğinden, renklerdeki saydamlığın görünmesi için çizim
+     *        süresince SDL_BLENDMODE_BLEND kullanılır ve ardından önceki kip geri yüklenir.
+     */
+    static void Draw(SDL_Renderer* renderer, const std::vector<SDL_Vertex>& vertices);
+
+    /**
+     * @brief vx += gx * dt, vy += gy * dt, x += vx * dt, y += vy * dt ve age += inverseLifetime * dt uygular.
+     */
+    static void Integrate(float* x, float* y, float* vx, float* vy, float* age, const float* inverseLifetime,
+                          size_t count, float deltaTime, float gravityX, float gravityY);
+    static void Integrate(SimdLevel level, float* x, float* y, float* vx, float* vy, float* age,
+                          const float* inverseLifetime, size_t count, float deltaTime, float gravityX, float gravityY);
+
+    /**
+     * @brief Yaşı 1'e ulaşan parçacıkları siler, canlıları sırası bozulmadan başa toplar ve canlı sayısını döner.
+     */
+    static size_t Compact(float* x, float* y, float* vx, float* vy, float* age, float* inverseLifetime, size_t count);
+};
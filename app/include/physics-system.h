@@ -0,0 +1,108 @@
+/**
+ * @file physics-system.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Kütle, sürtünme ve kuvvet biriktiricisi taşıyan RigidBody bileşeni ve onu paralel olarak ilerleten fizik sistemi.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "component-store.h"
+#include "components.h"
+#include "job-system.h"
+#include "system-scheduler.h"
+
+/**
+ * @brief Kuvvetlerle hareket eden nesnelerin fiziksel özellikleridir. Nesnenin ayrıca Transform ve Velocity
+ *        bileşenleri olmalıdır. Kütle ters olarak saklanır; kütlesi 0 olan nesne durağandır ve hiçbir kuvvetten
+ *        (yerçekimi dahil) etkilenmez. Sürtünme, hızla orantılı bir yavaşlamadır (1/saniye).
+ *        AddForce ile eklenen kuvvetler bir sonraki fizik adımında uygulanır ve adımdan sonra sıfırlanır.
+ */
+class RigidBody : public Component {
+public:
+    float mInverseMass = 1.0F;
+    float mDrag = 0.0F;
+    float mForceX = 0.0F;
+    float mForceY = 0.0F;
+
+    RigidBody(float mass = 1.0F, float drag = 0.0F) : mDrag(drag) { SetMass(mass); }
+
+    void SetMass(float mass) { mInverseMass = mass > 0.0F ? 1.0F / mass : 0.0F; }
+    float GetMass() const { return mInverseMass > 0.0F ? 1.0F / mInverseMass : 0.0F; }
+
+    void AddForce(float fx, float fy) {
+        mForceX += fx;
+        mForceY += fy;
+    }
+
+    void ClearForces() {
+        mForceX = 0.0F;
+        mForceY = 0.0F;
+    }
+};
+
+/**
+ * @brief Fizik adımında kullanılabilecek sayısal integrasyon yöntemleridir.
+ *        SemiImplicitEuler önce hızı, sonra yeni hızla konumu günceller; ucuzdur ve enerjiyi korur.
+ *        VelocityVerlet konuma a * dt² / 2 terimini ekler ve hızı adımın başındaki ve sonundaki ivmelerin
+ *        ortalamasıyla günceller; sabit ivmede tam sonucu verir ve sürtünmede daha doğrudur.
+ */
+enum class IntegrationMethod {
+    SemiImplicitEuler,
+    VelocityVerlet
+};
+
+/**
+ * @brief PhysicsSystem, RigidBody bileşeni olan nesneleri biriken kuvvetler, yerçekimi ve sürtünme ile ilerletir.
+ *        Nesneler View<Transform, Velocity, RigidBody> ile bulunur ve MovementSystem gibi ayrı dizilere (SoA)
+ *        toplanarak bitişik veri üzerinde işlenir. Bu nesnelerin konumlarını yalnızca bu sistem günceller;
+ *        MovementSystem RigidBody taşıyan nesneleri atlar.
+ *
+ *        Eşleşme listesi iş parçacığı sayısından bağımsız olarak sabit kChunkSize büyüklüğünde parçalara
+ *        bölünür ve parçalar JobSystem üzerinde dağıtılır. Her nesnenin sonucu yalnızca kendi verisine bağlı
+ *        olduğundan ve her parça hangi iş parçacığında çalışırsa çalışsın aynı kodla işlendiğinden sonuçlar
+ *        iş parçacığı sayısından bağımsız olarak bit düzeyinde aynıdır.
+ */
+class PhysicsSystem : public System {
+private:
+    static constexpr size_t kChunkSize = 4096;
+
+    IntegrationMethod mMethod;
+    float mGravityX;
+    float mGravityY;
+
+    // Havuzlardan toplanan veriler, her adımda yeniden ayırma yapmamak için saklanır
+    std::vector<float> mX;
+    std::vector<float> mY;
+    std::vector<float> mVx;
+    std::vector<float> mVy;
+    std::vector<float> mAx;
+    std::vector<float> mAy;
+    std::vector<float> mDrag;
+
+public:
+    explicit PhysicsSystem(IntegrationMethod method = IntegrationMethod::SemiImplicitEuler,
+                           float gravityX = 0.0f, float gravityY = 0.0f);
+
+    /**
+     * @brief Depodaki tüm fizik nesnelerini deltaTime kadar ilerletir ve kuvvet biriktiricilerini sıfırlar.
+     *        Dönüşümü yazılan nesneler Transform havuzunu izleyenlere bildirilir.
+     */
+    void Update(ComponentStore& store, float deltaTime, JobSystem* jobs = nullptr);
+
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+
+    void SetMethod(IntegrationMethod method) { mMethod = method; }
+    IntegrationMethod GetMethod() const { return mMethod; }
+
+    /**
+     * @brief Ayrı dizilerdeki count nesneyi bir adım ilerletir. ax, ay kuvvet ve yerçekiminden gelen sabit ivme,
+     *        drag ise sürtünme katsayısıdır; toplam ivme a = ax - drag * v olarak hesaplanır.
+     */
+    static void Integrate(IntegrationMethod method, float* x, float* y, float* vx, float* vy,
+                          const float* ax, const float* ay, const float* drag, size_t count, float deltaTime);
+};
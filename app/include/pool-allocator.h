@@ -0,0 +1,150 @@
+/**
+ * @file pool-allocator.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Sabit boyutlu bloklar dağıtan havuz ayırıcı ve bunu kullanan tür bazlı yardımcı sınıflar.
+ *        Çok sayıda aynı boyutta nesne oluşturup silen kodun her seferinde malloc çağırmasını önler.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Havuz belleğinin işletim sisteminden nasıl alınacağını belirler.
+ *        HugePages, destekleyen sistemlerde (Linux) büyük sayfa kullanımı ister; desteklenmiyorsa normal belleğe düşülür.
+ */
+enum class PoolBacking {
+    Heap,
+    HugePages
+};
+
+/**
+ * @brief Bir havuzun doluluk bilgileridir.
+ */
+struct PoolStats {
+    size_t mBlockSize = 0;
+    size_t mCapacity = 0;
+    size_t mInUse = 0;
+    size_t mPeakInUse = 0;
+    size_t mChunkCount = 0;
+};
+
+/**
+ * @brief FixedBlockPool, bellekten büyük parçalar (chunk) alıp bunları eşit boyutlu bloklara böler.
+ *        Boşa çıkan bloklar bir serbest listeye eklenir ve sonraki ayırmalarda ilk olarak bunlar kullanılır.
+ *        Alınan parçalar havuz yok edilene kadar işletim sistemine geri verilmez.
+ */
+class FixedBlockPool {
+private:
+    struct FreeBlock {
+        FreeBlock* mNext;
+    };
+
+    struct Chunk {
+        void* mMemory;
+        size_t mBytes;
+        bool mMapped;
+    };
+
+    size_t mBlockSize;
+    size_t mAlignment;
+    size_t mBlocksPerChunk;
+    PoolBacking mBacking;
+
+    mutable std::mutex mMutex;
+    FreeBlock* mFreeList = nullptr;
+    std::vector<Chunk> mChunks;
+    PoolStats mStats;
+
+    void Grow();
+
+public:
+    FixedBlockPool(size_t blockSize, size_t alignment, size_t blocksPerChunk = 1024,
+                   PoolBacking backing = PoolBacking::Heap);
+    ~FixedBlockPool();
+
+    FixedBlockPool(const FixedBlockPool&) = delete;
+    FixedBlockPool& operator=(const FixedBlockPool&) = delete;
+
+    void* Allocate();
+    void Deallocate(void* block);
+
+    /**
+     * @brief En az blockCount blok kullanılabilir olacak şekilde önceden yer ayırır.
+     */
+    void Reserve(size_t blockCount);
+
+    size_t BlockSize() const { return mBlockSize; }
+    PoolStats GetStats() const;
+};
+
+/**
+ * @brief T türündeki nesneleri FixedBlockPool üzerinde oluşturup yok eden sınıftır.
+ */
+template<typename T>
+class TypedPool {
+private:
+    FixedBlockPool mPool;
+
+public:
+    explicit TypedPool(size_t blocksPerChunk = 1024, PoolBacking backing = PoolBacking::Heap)
+        : mPool(sizeof(T), alignof(T), blocksPerChunk, backing) {}
+
+    template<typename... Args>
+    T* Create(Args&&... args) {
+        void* memory = mPool.Allocate();
+        try {
+            return ::new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            mPool.Deallocate(memory);
+            throw;
+        }
+    }
+
+    void Destroy(T* object) {
+        if (object) {
+            object->~T();
+            mPool.Deallocate(object);
+        }
+    }
+
+    void Reserve(size_t count) { mPool.Reserve(count); }
+    PoolStats GetStats() const { return mPool.GetStats(); }
+};
+
+/**
+ * @brief Türetilen sınıfa kendine ait bir havuz üzerinden çalışan new/delete operatörleri kazandırır.
+ *        Böylece std::make_unique ve sanal yıkıcı üzerinden yapılan silmeler kod değişmeden havuzu kullanır.
+ *        std::make_shared ise nesneyi sayaçla birlikte kendi ayırdığı blokta oluşturur ve havuzu atlar;
+ *        paylaşılan nesneler std::shared_ptr<T>(new T(...)) ile oluşturulmalıdır.
+ *        Kullanım: class RectangleRenderer : public RenderStrategy, public PooledObject<RectangleRenderer>
+ *        Havuz bilerek serbest bırakılmaz; program sonunda yok edilen statik nesneler de güvenle silinebilir.
+ */
+template<typename T>
+class PooledObject {
+public:
+    static FixedBlockPool& Pool() {
+        static FixedBlockPool* sPool = new FixedBlockPool(sizeof(T), alignof(T));
+        return *sPool;
+    }
+
+    static PoolStats GetPoolStats() { return Pool().GetStats(); }
+
+    static void* operator new(size_t size) {
+        // Türetilmiş ve daha büyük bir sınıf için çağrıldıysa genel ayırıcıya düşülür
+        return size == sizeof(T) ? Pool().Allocate() : ::operator new(size);
+    }
+
+    static void operator delete(void* memory, size_t size) {
+        if (size == sizeof(T)) {
+            Pool().Deallocate(memory);
+        } else {
+            ::operator delete(memory);
+        }
+    }
+};
@@ -0,0 +1,112 @@
+/**
+ * @file registry.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Nesneleri kuşak bilgili tutamaçlar ile oluşturan, silen ve bulan kayıt sınıfı.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "command-buffer.h"
+#include "entity.h"
+#include "component-store.h"
+#include "graphical-object-factory.h"
+#include "pool-allocator.h"
+#include "scene-graph.h"
+#include "view.h"
+
+/**
+ * @brief Registry, tüm nesnelerin sahibidir ve dışarıya yalnızca Entity tutamaçları verir.
+ *        Oluşturma, silme ve tutamaçtan nesneye erişim O(1)'dir. Silinen nesnenin indeksi bir sonraki
+ *        oluşturmada yeniden kullanılır ve kuşak numarası artırılır. Nesne görünümleri bir havuzdan parça parça
+ *        ayrıldığından kayıt büyüdükçe mevcut nesnelerin adresleri değişmez ve bellek yeniden ayrılmaz.
+ *        Yaşayan nesneler ayrıca seyrek küme (sparse set) olarak tutulur, böylece hepsi boşluksuz gezilebilir.
+ */
+class Registry {
+private:
+    ComponentStore mStore;
+    TypedPool<GraphicalObject> mObjectPool;
+    std::vector<GraphicalObject*> mObjects;
+    std::vector<uint32_t> mGenerations;
+    std::vector<Entity> mAlive;
+    std::vector<uint32_t> mAliveIndex;
+    CommandBuffer mCommands;
+    SceneGraph mSceneGraph;
+    std::vector<ObjectId> mDescendants;
+
+public:
+    explicit Registry(PoolBacking backing = PoolBacking::Heap);
+    ~Registry();
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    Entity Create();
+
+    /**
+     * @brief Nesneyi siler. Nesne sahne ağacında ise tüm alt nesneleri de silinir.
+     */
+    void Destroy(Entity entity);
+    bool IsAlive(Entity entity) const;
+
+    /**
+     * @brief child nesnesini parent nesnesine bağlar. Bağlanan nesnenin Transform bileşeni ebeveyne göre yerel
+     *        dönüşüm olarak yorumlanır ve nesneye SceneGraph tarafından güncellenen bir WorldTransform eklenir.
+     */
+    void SetParent(Entity child, Entity parent);
+    void ClearParent(Entity child);
+
+    /**
+     * @brief Nesnenin ebeveynini döner, ebeveyni yoksa boş tutamaç döner.
+     */
+    Entity GetParent(Entity child) const;
+
+    /**
+     * @brief Tutamaca karşılık gelen nesneyi döner. Tutamaç silinmiş bir nesneye aitse nullptr döner.
+     */
+    GraphicalObject* Get(Entity entity);
+
+    /**
+     * @brief Nesne numarasına karşılık gelen güncel tutamacı döner. Nesne yaşamıyorsa boş tutamaç döner.
+     */
+    Entity EntityOf(ObjectId id) const;
+
+    /**
+     * @brief Beklenen nesne sayısı kadar yer ayırır, böylece ani nesne artışlarında yeniden ayırma yapılmaz.
+     */
+    void Reserve(size_t count);
+
+    size_t Size() const { return mAlive.size(); }
+    ComponentStore& Store() { return mStore; }
+
+    /**
+     * @brief Gezinti sırasında ya da iş parçacıklarından yapılacak yapısal değişikliklerin kaydedileceği tampondur.
+     *        Kaydedilen komutlar SystemScheduler::Run sonunda uygulanır.
+     */
+    CommandBuffer& Commands() { return mCommands; }
+
+    SceneGraph& Hierarchy() { return mSceneGraph; }
+
+    /**
+     * @brief Verilen bileşenlerin hepsine sahip nesneler için bir görünüm döner, ör. Query<Transform, Velocity>().
+     */
+    template<typename... Ts>
+    View<Ts...> Query() { return View<Ts...>(mStore); }
+
+    /**
+     * @brief Nesne görünümü havuzunun doluluk bilgisini döner.
+     */
+    PoolStats GetObjectPoolStats() const { return mObjectPool.GetStats(); }
+
+    /**
+     * @brief Yaşayan tüm nesneleri gezer. fn(GraphicalObject&) şeklinde çağrılır.
+     *        Gezinti sırasında nesne oluşturulmamalı ya da silinmemelidir.
+     */
+    template<typename Fn>
+    void ForEach(Fn&& fn) {
+        for (const Entity& entity : mAlive) {
+            fn(*mObjects[entity.mIndex]);
+        }
+    }
+};
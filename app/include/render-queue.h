@@ -0,0 +1,103 @@
+/**
+ * @file render-queue.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Çizim isteklerini 64 bitlik anahtarlarla katman ve çizim durumuna göre sıralayan çizim kuyruğu.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "components.h"
+#include "sdl-resource.h"
+
+class Renderer;
+class RenderStrategy;
+
+/**
+ * @brief RenderQueue, bir kare boyunca gönderilen çizim isteklerini toplar, 64 bitlik anahtarlarına göre sıralar
+ *        ve sırayla Renderer toplayıcısına ekler. Anahtar en anlamlı bitten başlayarak şu alanlardan oluşur:
+ *
+ *        katman (8 bit) | karışım modu (4 bit) | malzeme (20 bit) | renk (32 bit)
+ *
+ *        Katman çizim sırasını belirler: küçük katman önce, yani altta çizilir. Aynı katmanda istekler karışım
+ *        modu, malzeme (RenderStrategy::MaterialKey, ör. ölçeklenmiş boyut ve renge göre paylaşılan şekil dokusu)
+ *        ve renge göre gruplanır; böylece toplayıcıda doku ve karışım modu değişimleri en aza iner. Sıralama kararlı olduğundan aynı anahtarlı
+ *        istekler gönderildikleri sırada çizilir.
+ *
+ *        Sıralama 8 bitlik basamaklarla en az anlamlı basamaktan başlayan taban (radix) sıralamasıdır; tüm
+ *        anahtarlarda aynı olan basamaklar atlanır. Diziler kareler arasında yeniden kullanılır, kararlı durumda
+ *        bellek ayrılmaz.
+ */
+class RenderQueue {
+public:
+    /**
+     * @brief Sıralanan anahtar ve isteğin kuyruktaki numarasıdır; istekler yerinde kalır, yalnızca bunlar taşınır.
+     */
+    struct SortEntry {
+        uint64_t mKey;
+        uint32_t mIndex;
+    };
+
+    /**
+     * @brief Kuyruğu boşaltır; kapasite korunur.
+     */
+    void Clear();
+
+    /**
+     * @brief strategy ile transform dönüşümünde çizilecek bir istek ekler. Strateji Submit çağrılana kadar geçerli
+     *        kalmalıdır.
+     */
+    void Push(RenderStrategy* strategy, const Transform& transform, uint8_t layer = 0,
+              SDL_BlendMode blendMode = SDL_BLENDMODE_NONE);
+
+    /**
+     * @brief İstekleri anahtarlarına göre kararlı olarak sıralar.
+     */
+    void Sort();
+
+    /**
+     * @brief İstekleri sıralı olarak renderer toplayıcısına ekler. Karışım modu değiştiğinde biriken şekiller
+     *        çizilir ve yeni mod SDL_SetRenderDrawBlendMode ile ayarlanır.
+     */
+    void Submit(Renderer& renderer);
+
+    size_t Size() const { return mCommands.size(); }
+    bool Empty() const { return mCommands.empty(); }
+
+    /**
+     * @brief Sort sonrasında order numaralı sıradaki isteğin anahtarı ve gönderilme numarasıdır.
+     */
+    uint64_t KeyAt(size_t order) const { return mSorted[order].mKey; }
+    uint32_t IndexAt(size_t order) const { return mSorted[order].mIndex; }
+
+    /**
+     * @brief Katman, karışım modu, stratejinin transform ile çizimdeki malzemesi ve renginden sıralama anahtarını
+     *        oluşturur.
+     */
+    static uint64_t MakeKey(uint8_t layer, SDL_BlendMode blendMode, const RenderStrategy& strategy,
+                            const Transform& transform);
+
+    /**
+     * @brief entries dizisindeki count kaydı anahtara göre kararlı olarak sıralar. scratch en az count kayıtlık
+     *        yardımcı dizidir. Sonuç hangi dizide kaldıysa onun adresi döner.
+     */
+    static SortEntry* RadixSort(SortEntry* entries, SortEntry* scratch, size_t count);
+
+private:
+    struct Command {
+        RenderStrategy* mStrategy;
+        Transform mTransform;
+        SDL_BlendMode mBlendMode;
+        uint64_t mKey;
+    };
+
+    std::vector<Command> mCommands;
+    std::vector<SortEntry> mEntries;
+    std::vector<SortEntry> mScratch;
+
+    // Sort sonrasında mEntries ya da mScratch içindeki sıralı dizi
+    SortEntry* mSorted = nullptr;
+};
@@ -0,0 +1,74 @@
+/**
+ * @file render-snapshot.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Simülasyondan bağımsız olarak çizilebilen, bir adımdaki görünür nesnelerin kopyası.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "component-store.h"
+#include "components.h"
+#include "sdl-resource.h"
+
+class Registry;
+class Renderer;
+class RenderQueue;
+class RenderStrategy;
+
+/**
+ * @brief Çizilecek tek bir nesnedir: dönüşümün kopyası ve stratejinin snapshot içindeki numarası.
+ */
+struct RenderItem {
+    Transform mTransform;
+    uint32_t mStrategy;
+    uint8_t mLayer;
+};
+
+/**
+ * @brief RenderSnapshot, simülasyon iş parçacığında doldurulur ve TripleBuffer ile çizim iş parçacığına aktarılır.
+ *        Dönüşümler kopyalanır; stratejiler ise nesneler arasında paylaşıldığından kopyalanmaz, her biri bir kez
+ *        sahiplenilir, böylece nesneler simülasyonda silinse bile çizim sırasında geçerli kalır. Stratejilerin
+ *        nesneye özgü durum taşımaması gerekir; Submit içinde yalnızca kendi ara bellekleri değişebilir ve bunlara
+ *        yalnızca çizim iş parçacığı dokunur.
+ *        Snapshot yuvaları yeniden kullanılır; strateji dizini de dahil tüm diziler bir kez büyüdükten sonra
+ *        yakalama bellek ayırmaz.
+ */
+struct RenderSnapshot {
+    uint64_t mTick = 0;
+
+    // Yayın anındaki ara değer oranı ve zamanı; çizim, yayından bu yana geçen süreyi orana ekler
+    float mAlpha = 1.0f;
+    float mStepSeconds = 1.0f / 60.0f;
+    std::chrono::steady_clock::time_point mPublishTime;
+
+    std::vector<RenderItem> mItems;
+    std::vector<std::shared_ptr<RenderStrategy>> mStrategies;
+    // Adrese göre sıralı (strateji, mStrategies numarası) çiftleri; her yakalamada temizlenip yeniden kullanılır
+    std::vector<std::pair<const RenderStrategy*, uint32_t>> mStrategyIndex;
+
+    // Tüm parçacıklar son adımdaki konumlarıyla, tek çizim çağrısına hazır köşeler olarak kopyalanır
+    std::vector<SDL_Vertex> mParticleVertices;
+
+    /**
+     * @brief visible dizisindeki nesneleri verilen sırayla ve tüm parçacıkları kopyalar. Stratejisi ya da dönüşümü
+     *        olmayan nesneler atlanır.
+     */
+    void Capture(Registry& registry, const std::vector<ObjectId>& visible);
+
+    /**
+     * @brief Yayından now anına kadar geçen süreyle ilerletilmiş ara değer oranını döner (en fazla 1).
+     */
+    float AlphaAt(std::chrono::steady_clock::time_point now) const;
+
+    /**
+     * @brief Tüm nesneleri alpha oranında ara değer alınmış dönüşümleriyle queue kuyruğunda sıralayıp
+     *        renderer toplayıcısına ekler ve tek seferde çizer, ardından parçacıkları çizer.
+     */
+    void Draw(Renderer& renderer, float alpha, RenderQueue& queue) const;
+};
@@ -4,50 +4,184 @@
  * @brief 
  * @date 2025-05-31
  */
+#include <array>
+#include <limits>
+#include <vector>
+
 #include "sdl-resource.h"
+#include "pool-allocator.h"
 
 #pragma once
 
+class Renderer;
 class Transform;
 
+/**
+ * @brief Stratejinin çizdiği şeklin türüdür.
+ */
+enum class ShapeType : uint8_t {
+    Rectangle,
+    Circle,
+    Triangle
+};
+
+/**
+ * @brief Şeklin ölçeklenmemiş yerel boyutlarıdır. Daire için genişlik ve yükseklik çaptır,
+ *        eşkenar üçgen için genişlik kenar uzunluğu, yükseklik ise üçgenin yüksekliğidir.
+ */
+struct ShapeDesc {
+    ShapeType mType = ShapeType::Rectangle;
+    float mWidth = 0.0f;
+    float mHeight = 0.0f;
+};
+
 /** 
  * @brief RenderStrategy sınıfı, farklı render stratejilerini temsil eden soyut bir sınıftır.
+ *        Somut stratejiler PooledObject üzerinden kendi türlerine ait havuzdan ayrılır, böylece çok sayıda
+ *        nesne oluşturulup silindiğinde genel bellek ayırıcıya gidilmez.
  * @ref   https://refactoring.guru/design-patterns/strategy/cpp/example
  */
 class RenderStrategy {
 public:
     virtual ~RenderStrategy() = default;
     virtual void Render(SDL_Renderer* renderer, const Transform& transform) = 0;
+
+    /**
+     * @brief Şekli, karenin sonunda tek çağrıyla çizilmek üzere Renderer::Batch akışına ekler.
+     *        Varsayılan uygulama toplayıcıyı desteklemeyen stratejiler içindir: biriken şekilleri çizer ve
+     *        ardından Render ile doğrudan çizer, böylece çizim sırası korunur.
+     */
+    virtual void Submit(Renderer& renderer, const Transform& transform);
+
+    /**
+     * @brief Çizilen şeklin türünü ve boyutlarını döner; çarpışma ve görünürlük hesapları bunu kullanır.
+     */
+    virtual ShapeDesc GetShape() const = 0;
+
+    /**
+     * @brief Çizim rengini 0..1 aralığında döner; sahne dosyasına kaydederken stratejiyi yeniden oluşturmak için kullanılır.
+     */
+    virtual SDL_FColor GetColor() const = 0;
+
+    /**
+     * @brief Submit'in transform ile çizimde kullanacağı malzemeyi (ör. paylaşılan şekil dokusu) tanımlayan anahtardır;
+     *        RenderQueue aynı anahtarlı istekleri art arda çizer. Varsayılan uygulama doku kullanmayan stratejiler
+     *        içindir ve yalnızca şekil türünü döner.
+     */
+    virtual uint64_t MaterialKey(const Transform& transform) const;
 };
 
 /** 
  * @brief RectangleRenderer sınıfı, dikdörtgenleri çizmek için kullanılan bir render stratejisidir.
  */
-class RectangleRenderer : public RenderStrategy {
+class RectangleRenderer : public RenderStrategy, public PooledObject<RectangleRenderer> {
 private:
     SDL_Color mColor;
     int32_t mWidth, mHeight;
 public:
     RectangleRenderer(SDL_Color color, int32_t width, int32_t height);    
     void Render(SDL_Renderer* renderer, const Transform& transform) override;
+    void Submit(Renderer& renderer, const Transform& transform) override;
+    ShapeDesc GetShape() const override;
+    SDL_FColor GetColor() const override;
 };
 
 /** 
  * @brief CircleRenderer sınıfı, daireleri çizmek için kullanılan bir render stratejisidir.
+ *        Daire satır satır taranır: her satır için tek bir yatay aralık (span) hesaplanır ve tüm satırlar tek bir
+ *        SDL_RenderFillRects çağrısı ile gönderilir. Yarıçap X ekseninde mScaleX, Y ekseninde mScaleY ile
+ *        ölçeklendiğinden farklı ölçeklerde elips çizilir.
+ *        Toplayıcıya ise öncelikle Renderer::ShapeCache içinde bir kez taranmış dokusu ile tek bir dörtgen olarak
+ *        eklenir. Doku elde edilemezse üçgen yelpazesi olarak eklenir; kenar sayısı, kirişin gerçek kenardan en fazla
+ *        yarım piksel sapacağı şekilde yarıçapa göre seçilir ve kenar noktaları doğrudan toplayıcıya yazılır.
+ *        Strateji prefab örnekleri arasında paylaşıldığından yalnızca değişmez renk ve yarıçapı tutar; Render ve
+ *        Submit farklı iş parçacıklarından aynı anda çağrılabilir.
  */
-class CircleRenderer : public RenderStrategy {
+class CircleRenderer : public RenderStrategy, public PooledObject<CircleRenderer> {
 private:
     SDL_Color mColor;
     int32_t mRadius;
+
+    /**
+     * @brief scale ölçeğinde tam piksele yuvarlanmış yarıçaptır; doku boyutu ve yerleşimi bununla hesaplanır.
+     */
+    int32_t SpanRadius(float scale) const { return static_cast<int32_t>(static_cast<float>(mRadius) * scale); }
+
 public:
     CircleRenderer(SDL_Color color, int32_t radius);    
     void Render(SDL_Renderer* renderer, const Transform& transform) override;
+    void Submit(Renderer& renderer, const Transform& transform) override;
+    ShapeDesc GetShape() const override;
+    SDL_FColor GetColor() const override;
+
+    /**
+     * @brief Submit'in ShapeTextureCache'ten alacağı dokunun anahtarını, yani ölçeklenmiş boyut ve rengi döner.
+     */
+    uint64_t MaterialKey(const Transform& transform) const override;
+
+    /**
+     * @brief Merkezi (centerX, centerY), yarıçapları radiusX ve radiusY piksel olan elipsin satır aralıklarını spans
+     *        dizisine yazar. Bir piksel, merkeze göre konumu (x, y) için x²/rx² + y²/ry² <= 1 ise içeridedir;
+     *        yarıçaplar eşitken sonuç x² + y² <= r² koşuluyla aynıdır.
+     */
+    static void BuildSpans(int32_t centerX, int32_t centerY, int32_t radiusX, int32_t radiusY,
+                           std::vector<SDL_FRect>& spans);
+
+    /**
+     * @brief radius yarıçaplı çemberin kenarlarının gerçek çemberden en fazla yarım piksel sapması için
+     *        gereken kenar sayısını döner.
+     */
+    static uint32_t FanSegments(float radius);
+};
+
+/**
+ * @brief Eşkenar üçgen köşelerinin merkeze göre ofsetlerini dönüş açısı ve ölçeklenmiş kenar uzunluğuna göre saklayan
+ *        önbellektir. Ofsetler konuma bağlı olmadığından aynı açı ve ölçekteki tüm üçgenler (ör. aynı prefab'ın
+ *        dönmeyen örnekleri) tek girdiyi paylaşır. Sabit boyutlu, doğrudan eşlemeli (direct-mapped) bir tablodur;
+ *        bellek ayırmaz ve cosf/sinf yalnızca ıskalamada çağrılır. Renderer tarafından tutulur, yalnızca çizim
+ *        iş parçacığından kullanılmalıdır.
+ */
+class TriangleOffsetCache {
+public:
+    using Offsets = std::array<SDL_FPoint, 3>;
+
+    /**
+     * @brief scaledSize kenar uzunluklu, rotation radyan dönmüş üçgenin ofsetlerini döner.
+     */
+    const Offsets& Get(float scaledSize, float rotation);
+
+    /**
+     * @brief Ofsetleri önbelleğe bakmadan hesaplar; dönüş açısı 0 ise cosf/sinf çağrılmaz.
+     */
+    static Offsets Compute(float scaledSize, float rotation);
+
+    /**
+     * @brief Ofsetlerin yeniden hesaplandığı (trigonometri çağrılan) istek sayısıdır.
+     */
+    size_t Misses() const { return mMisses; }
+
+private:
+    static constexpr size_t kEntryCount = 64;
+
+    struct Entry {
+        // NaN hiçbir değere eşit olmadığından boş girdi hiçbir istekle eşleşmez
+        float mSize = std::numeric_limits<float>::quiet_NaN();
+        float mRotation = std::numeric_limits<float>::quiet_NaN();
+        Offsets mOffsets{};
+    };
+
+    std::array<Entry, kEntryCount> mEntries;
+    size_t mMisses = 0;
 };
 
 /** 
  * @brief TriangleRenderer sınıfı, üçgenleri çizmek için kullanılan bir render stratejisidir.
+ *        Strateji aynı prefab'dan oluşturulan tüm nesneler arasında paylaşıldığından yalnızca değişmez şekil ve
+ *        renk verisini tutar. Döndürülmüş köşe ofsetleri Renderer::TriangleOffsets önbelleğinde tutulur ve yalnızca
+ *        dönüş açısı ya da ölçek değiştiğinde yeniden hesaplanır; konum değişikliği yalnızca ötelemedir.
+ *        Tüm üçgenler aynı statik indeks dizisini kullandığından çizim sırasında bellek ayrılmaz.
  */
-class TriangleRenderer : public RenderStrategy {
+class TriangleRenderer : public RenderStrategy, public PooledObject<TriangleRenderer> {
 private:
     SDL_FColor mColor;
     float mEdgeLength;
@@ -55,4 +189,12 @@ private:
 public:
     TriangleRenderer(SDL_FColor color, float size);    
     void Render(SDL_Renderer* renderer, const Transform& transform) override;
-};
\ No newline at end of file
+    void Submit(Renderer& renderer, const Transform& transform) override;
+    ShapeDesc GetShape() const override;
+    SDL_FColor GetColor() const override;
+
+    /**
+     * @brief Dönüşüme ait üç köşeyi hesaplar. cache verilirse döndürülmüş ofsetler oradan alınır.
+     */
+    std::array<SDL_Vertex, 3> MakeVertices(const Transform& transform, TriangleOffsetCache* cache = nullptr) const;
+};
@@ -0,0 +1,115 @@
+/**
+ * @file replay-buffer.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Simülasyon durumunu adım adım kaydeden ve yakın geçmişteki herhangi bir adıma geri saran halka tampon.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Registry;
+
+/**
+ * @brief ReplayBuffer, her simülasyon adımının sonunda Transform ve Velocity bileşenlerini kaydeder.
+ *        Durum, bileşen havuzlarının sahip numaraları, sahiplerin kuşakları ve değerlerinden oluşan 32 bitlik
+ *        kelimelerden bir görüntüdür.
+ *        Her keyframeInterval adımda bir (ya da nesne sayısı değiştiğinde) görüntünün tamamı anahtar kare olarak,
+ *        aradaki adımlarda ise yalnızca bir önceki adıma göre XOR farkı yazılır. Fark, 32 kelimelik bloklar halinde
+ *        kodlanır: değişen her blok için blok numarası, değişen kelimelerin bit maskesi ve bu kelimelerin XOR değerleri
+ *        saklanır; hareket etmeyen nesneler yer kaplamaz.
+ *
+ *        Kareler sabit boyutlu bir bellek alanında halka düzeninde tutulur. Alan dolduğunda en eski kareler silinir
+ *        ve en eski kare her zaman bir anahtar kare olacak şekilde yarım kalan gruplar da atılır, böylece bellek
+ *        kullanımı capacityBytes ile sınırlıdır. Geri sarma en yakın anahtar kareden başlayıp en fazla
+ *        keyframeInterval - 1 fark uygular; süresi kayıt uzunluğundan bağımsızdır.
+ *
+ *        Kayıt, nesne yapısını (oluşturma, silme, ebeveyn bağları) değil yalnızca bileşen değerlerini saklar.
+ *        Seek, kaydedilen değerleri yalnızca hâlâ yaşayan ve kuşağı değişmemiş nesnelere geri yazar.
+ */
+class ReplayBuffer {
+private:
+    struct Frame {
+        uint64_t mTick;
+        size_t mOffset;
+        size_t mSize;
+        bool mKeyframe;
+    };
+
+    uint32_t mKeyframeInterval;
+    std::vector<uint32_t> mArena;
+    size_t mHead = 0;
+
+    // Kareler halka düzeninde tutulur; mFirst en eski karenin konumudur
+    std::vector<Frame> mFrames;
+    size_t mFirst = 0;
+    size_t mFrameCount = 0;
+
+    uint64_t mNextTick = 0;
+    uint32_t mTicksSinceKeyframe = 0;
+    uint64_t mDroppedTicks = 0;
+
+    // Son kaydedilen adımın görüntüsü ve kayıt sırasında kullanılan yardımcı tamponlar
+    std::vector<uint32_t> mState;
+    std::vector<uint32_t> mCurrent;
+    std::vector<uint32_t> mEncoded;
+
+    Frame& FrameAt(size_t index) { return mFrames[(mFirst + index) % mFrames.size()]; }
+    const Frame& FrameAt(size_t index) const { return mFrames[(mFirst + index) % mFrames.size()]; }
+    void PushFrame(const Frame& frame);
+    void PopOldest();
+
+    /**
+     * @brief words kelimelik bir kare için alanda yer açar ve konumunu döner. Yer açmak için en eski kareler silinir.
+     */
+    size_t Allocate(size_t words);
+
+    void Capture(Registry& registry);
+    void EncodeDelta();
+    static void ApplyDelta(const uint32_t* delta, size_t size, std::vector<uint32_t>& state);
+    static void Restore(Registry& registry, const std::vector<uint32_t>& state);
+
+public:
+    /**
+     * @brief capacityBytes boş bir dünyanın anahtar karesini bile tutamayacak kadar küçükse std::runtime_error fırlatır.
+     */
+    explicit ReplayBuffer(uint32_t keyframeInterval = 60, size_t capacityBytes = 16 * 1024 * 1024);
+
+    /**
+     * @brief Güncel durumu bir sonraki adım olarak kaydeder ve adımın numarasını döner. Numaralar 0'dan başlar.
+     *        Tek bir anahtar kare bile alana sığmıyorsa adım kaydedilmez ve DroppedTicks bir artar. Adım numaraları
+     *        arka arkaya olmak zorunda olduğundan bu durumda önceki kareler de silinir.
+     */
+    uint64_t Record(Registry& registry);
+
+    /**
+     * @brief Registry'yi tick adımındaki duruma geri sarar. tick'ten sonraki kareler silinir ve kayıt bu adımdan devam
+     *        eder, böylece geri sarılan oturum yeniden çalıştırılabilir. Adım tamponda değilse false döner.
+     */
+    bool Seek(Registry& registry, uint64_t tick);
+
+    bool Empty() const { return mFrameCount == 0; }
+    uint64_t OldestTick() const { return Empty() ? mNextTick : FrameAt(0).mTick; }
+    uint64_t NewestTick() const { return Empty() ? mNextTick : FrameAt(mFrameCount - 1).mTick; }
+    size_t FrameCount() const { return mFrameCount; }
+    uint32_t KeyframeInterval() const { return mKeyframeInterval; }
+
+    /**
+     * @brief Alana sığmadığı için kaydedilemeyen adımların toplam sayısıdır.
+     */
+    uint64_t DroppedTicks() const { return mDroppedTicks; }
+
+    /**
+     * @brief registry'nin güncel durumunun bir anahtar karede kaplayacağı bayt sayısıdır. Kapasite seçerken
+     *        bu değerden büyük bir alan ayrılmalıdır.
+     */
+    static size_t KeyframeBytes(Registry& registry);
+
+    /**
+     * @brief Karelerin şu anda kapladığı bayt sayısıdır; hiçbir zaman CapacityBytes değerini aşmaz.
+     */
+    size_t UsedBytes() const;
+    size_t CapacityBytes() const { return mArena.size() * sizeof(uint32_t); }
+};
@@ -0,0 +1,125 @@
+/**
+ * @file scene-graph.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Nesneler arasındaki ebeveyn/çocuk ilişkisini tutan ve dünya dönüşümlerini önbelleğe alan sahne ağacı.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "component-store.h"
+
+/**
+ * @brief 2B afin dönüşüm matrisidir: [m00 m01 tx; m10 m11 ty; 0 0 1].
+ */
+struct Affine2D {
+    float m00 = 1.0f;
+    float m01 = 0.0f;
+    float m10 = 0.0f;
+    float m11 = 1.0f;
+    float tx = 0.0f;
+    float ty = 0.0f;
+
+    /**
+     * @brief Ölçek, dönme ve öteleme sırasıyla uygulanan dönüşümün matrisini oluşturur.
+     */
+    static Affine2D FromTransform(const Transform& transform);
+
+    Affine2D operator*(const Affine2D& local) const;
+
+    /**
+     * @brief Matrisi konum, dönme ve ölçek olarak dönüşüme yazar. Eğilme (shear) içeren matrislerde yaklaşıktır.
+     */
+    void Decompose(Transform& transform) const;
+};
+
+/**
+ * @brief SceneGraph, ağaçtaki nesnelerin dünya matrislerini hesaplar.
+ *        Düğümler her yapısal değişiklikten sonra genişlik öncelikli (BFS) sırayla bitişik dizilere yerleştirilir;
+ *        böylece ebeveyn her zaman çocuklarından önce gelir. Yapı değiştiğinde tüm ağaç tek doğrusal geçişte
+ *        hesaplanır.
+ *
+ *        Sonraki adımlarda yalnızca kirli (dirty) düğümler ve alt ağaçları hesaplanır. Kirli düğümler Transform
+ *        havuzunu izleyen bir ChangeList'ten okunur: bileşen ekleme ve silme (CommandBuffer dahil) havuz tarafından,
+ *        Teleport bileşenin sahibi üzerinden kendiliğinden bildirilir; Transform'a yazan sistemler (MovementSystem,
+ *        PhysicsSystem, ComponentUpdateSystem) ve ReplayBuffer ise yazdıkları nesneleri ComponentStore::MarkChanged
+ *        ile bildirir. Bir düğümün çocukları BFS sırasında art arda yer aldığından kirli düğümler artan konum
+ *        sırasıyla gezilir ve her hesaplanan düğümün çocuk aralığı aynı sıraya eklenir; böylece ağaç bağlantıları
+ *        izlenmeden bitişik diziler üzerinde ilerlenir ve dokunulmayan alt ağaçlar için hiçbir bileşen okunmaz.
+ *        Kök olmayan düğümlerin dünya dönüşümü WorldTransform bileşenine yazılır ve değişiklik WorldTransform
+ *        havuzunu izleyenlere bildirilir.
+ */
+class SceneGraph {
+private:
+    static constexpr uint32_t kNoPosition = std::numeric_limits<uint32_t>::max();
+
+    // Nesne numarası ile indekslenen ağaç bağlantıları
+    std::vector<ObjectId> mParentOf;
+    std::vector<ObjectId> mFirstChild;
+    std::vector<ObjectId> mNextSibling;
+
+    // BFS sırasındaki bitişik düğüm dizileri; bir düğümün çocukları [mChildBegin, mChildBegin + mChildCount) aralığındadır
+    std::vector<ObjectId> mOrder;
+    std::vector<uint32_t> mParentPosition;
+    std::vector<uint32_t> mChildBegin;
+    std::vector<uint32_t> mChildCount;
+    std::vector<Affine2D> mWorld;
+    std::vector<uint8_t> mTeleported;
+    std::vector<uint32_t> mPosition;
+    bool mStructureChanged = false;
+
+    // Transform havuzunda değişen nesneler ve bunların bu adımda hesaplanacak BFS konumları
+    ChangeList mChanges;
+    std::vector<uint32_t> mDirty;
+
+    // Bu adımda hesaplanan düğümlerin damgası ve hesaplanan düğümlerin çocuklarından oluşan artan sıralı kuyruk
+    std::vector<uint32_t> mStamp;
+    std::vector<uint32_t> mFrontier;
+    uint32_t mFrame = 0;
+
+    // Önceki adımda dünya dönüşümü değişen düğümler; bir sonraki adımda önceki değerleri güncellenir
+    std::vector<ObjectId> mMoved;
+
+    void EnsureCapacity(ObjectId id);
+    void Unlink(ObjectId child);
+    void Rebuild();
+    void Recompute(ComponentStore& store, uint32_t position, bool rebuilt);
+    void RecomputeDirty(ComponentStore& store);
+
+public:
+    /**
+     * @brief child nesnesini parent nesnesinin altına bağlar. Döngü oluşacaksa std::runtime_error fırlatır.
+     */
+    void Attach(ObjectId child, ObjectId parent);
+    void Detach(ObjectId child);
+
+    /**
+     * @brief Silinen nesneyi ağaçtan çıkarır; çocukları köke dönüşür.
+     */
+    void Remove(ObjectId id);
+
+    ObjectId GetParent(ObjectId id) const;
+    bool IsNode(ObjectId id) const;
+
+    /**
+     * @brief Nesnenin tüm alt düğümlerini (kendisi hariç) out dizisine ekler.
+     */
+    void CollectDescendants(ObjectId id, std::vector<ObjectId>& out) const;
+
+    /**
+     * @brief Yapı değiştiyse tüm ağacı, değilse yalnızca Transform'u değişen düğümlerin alt ağaçlarını yeniden
+     *        hesaplar. Hesaplanan düğümlerin Teleport ile kurulan ışınlanma bilgisi okunup temizlenir.
+     *        İlk çağrıda depodaki Transform havuzunu izlemeye başlar; ağaç hep aynı depo ile güncellenmelidir.
+     */
+    void Update(ComponentStore& store);
+
+    /**
+     * @brief Son Update sonundaki dünya matrisini döner. Nesne ağaçta değilse nullptr döner.
+     */
+    const Affine2D* GetWorldMatrix(ObjectId id) const;
+
+    size_t NodeCount() const { return mOrder.size(); }
+};
@@ -11,31 +11,88 @@
 #include <iostream>
 #include <chrono>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
 #include <SDL3/SDL.h>
 
 #include "sdl-resource.h"
 #include "event-system.h"
+#include "fixed-timestep.h"
 #include "graphical-object-factory.h"
+#include "registry.h"
+#include "render-queue.h"
+#include "render-snapshot.h"
+#include "replay-buffer.h"
+#include "movement-system.h"
+#include "job-system.h"
+#include "system-scheduler.h"
+#include "triple-buffer.h"
+#include "viewport-culler.h"
+#include "world-snapshot.h"
 
 class Sdl3Application : public EventObserver {
 private:
-    bool mRunning = true;    
+    std::atomic<bool> mRunning = true;
     SDLWindow mWindow;
     EventSubject mEventSubject;
-    std::vector<std::unique_ptr<GraphicalObject>> mGraphicalObjects;
+    Registry mRegistry;
+    Entity mPlayer;
+    JobSystem mJobSystem;
+    SystemScheduler mScheduler{mJobSystem};
+    FixedTimestep mTimestep{60.0, 5};
+    ViewportCuller mCuller;
+    ReplayBuffer mReplay;
     std::chrono::high_resolution_clock::time_point mLastTime;
 
+    // Ayrı iş parçacığında simülasyon için: snapshot aktarımı, pencere boyutu ve simülasyona iletilecek tuşlar
+    bool mThreadedSimulation = false;
+    TripleBuffer<RenderSnapshot> mSnapshots;
+    std::atomic<int> mViewportWidth = 800;
+    std::atomic<int> mViewportHeight = 600;
+    std::mutex mPendingKeysMutex;
+    std::vector<SDL_KeyboardEvent> mPendingKeys;
+    std::vector<SDL_KeyboardEvent> mHandledKeys;
+
+    // Parçacık köşeleri ve çizim kuyruğu her karede yeniden ayırma yapmamak için saklanır
+    std::vector<SDL_Vertex> mParticleVertices;
+    RenderQueue mRenderQueue;
+
 public:
     Sdl3Application();
 
-    bool Initialize();    
+    /**
+     * @brief Pencereyi ve sistemleri hazırlar. scenePath verilirse sahne WorldSnapshot dosyasından yüklenir ve
+     *        dosyadaki ilk nesne oyuncu olur; verilmezse varsayılan örnek sahne kurulur.
+     */
+    bool Initialize(const std::string& scenePath = {});
     void Run();    
     void Shutdown();    
     void OnEvent(const SDL_Event& event) override;
 
+    /**
+     * @brief Simülasyonun saniyedeki adım sayısını ve takılan karelerden sonra yapılabilecek en fazla adım sayısını ayarlar.
+     */
+    void SetTickRate(double ticksPerSecond, uint32_t maxStepsPerFrame = 5);
+
+    /**
+     * @brief Açıksa Run, simülasyonu ayrı bir iş parçacığında çalıştırır. Simülasyon her adım grubunun sonunda görünür
+     *        nesnelerin değişmez bir RenderSnapshot kopyasını üçlü tampon üzerinden yayınlar; ana iş parçacığı yalnızca
+     *        olayları okur, en son snapshot'ı alır ve SDL çizim çağrılarını yapar. Böylece N+1. adımın simülasyonu
+     *        N. karenin çizimiyle aynı anda yürür ve Present içindeki dikey eşitleme (vsync) beklemeleri simülasyonu
+     *        durdurmaz. Tuş olayları simülasyon iş parçacığına iletilir ve bir sonraki adım grubundan önce işlenir.
+     *        Run çağrılmadan önce ayarlanmalıdır.
+     */
+    void SetThreadedSimulation(bool enabled) { mThreadedSimulation = enabled; }
+
 private:
     void HandleEvents();    
     void HandleKeyDown(const SDL_KeyboardEvent& key);    
-    void Update();
+    uint32_t Update();
     void Render();
+
+    void RunThreaded();
+    void SimulationLoop();
+    void PublishSnapshot();
+    void RenderSnapshotFrame();
 };
\ No newline at end of file
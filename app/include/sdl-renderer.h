@@ -8,7 +8,10 @@
 
 #include <memory>
 
+#include "geometry-batch.h"
+#include "render-strategies.h"
 #include "sdl-resource.h"
+#include "shape-texture-cache.h"
 
 /** 
  * @brief Renderer sınıfı, SDL_Renderer'ı singleton design pattern'i kullanarak yöneten sınıftır.
@@ -17,6 +20,13 @@ class Renderer {
 private:
     static std::unique_ptr<Renderer> mInstance;
     SDLRenderer mRenderer;
+    float mInterpolationAlpha = 1.0f;
+    GeometryBatch mBatch;
+    TriangleOffsetCache mTriangleOffsets;
+    size_t mLastDrawCalls = 0;
+
+    // Dokular SDL_Renderer'dan önce silinmelidir, bu yüzden mRenderer'dan sonra tanımlanır
+    ShapeTextureCache mShapeCache;
     
     explicit Renderer(SDL_Renderer* renderer);
 public:
@@ -26,4 +36,38 @@ public:
     SDL_Renderer* GetSDLRenderer() const;    
     void Clear(SDL_Color color = {0, 0, 0, 255});    
     void Present();
+
+    /**
+     * @brief Sabit adımlı simülasyonda son adımdan bu yana geçen sürenin adım süresine oranıdır (0..1).
+     *        Çizim yapan bileşenler önceki ve güncel dönüşüm arasında bu oranla ara değer alır.
+     */
+    void SetInterpolationAlpha(float alpha) { mInterpolationAlpha = alpha; }
+    float GetInterpolationAlpha() const { return mInterpolationAlpha; }
+
+    /**
+     * @brief Kare boyunca çizilen şekillerin toplandığı akıştır. Stratejiler şekillerini buraya ekler ve
+     *        Present bunları doku başına tek bir SDL_RenderGeometry çağrısı ile çizer. Clear biriken şekilleri atar.
+     */
+    GeometryBatch& Batch() { return mBatch; }
+
+    /**
+     * @brief Üçgen stratejilerinin döndürülmüş köşe ofsetlerini açı ve ölçeğe göre saklayan önbellektir.
+     */
+    TriangleOffsetCache& TriangleOffsets() { return mTriangleOffsets; }
+
+    /**
+     * @brief Önceden taranmış şekil dokularının önbelleğidir. Clear her karede önbelleğe yeni kareyi bildirir.
+     */
+    ShapeTextureCache& ShapeCache() { return mShapeCache; }
+
+    /**
+     * @brief Biriken şekilleri hemen çizer. Toplayıcıyı kullanmadan doğrudan SDL ile çizim yapmadan önce
+     *        çağrılmalıdır, böylece çizim sırası korunur.
+     */
+    void Flush();
+
+    /**
+     * @brief Son Present ile tamamlanan karede toplayıcının yaptığı SDL_RenderGeometry çağrısı sayısıdır.
+     */
+    size_t GetLastDrawCalls() const { return mLastDrawCalls; }
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+ * @file shape-texture-cache.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Şekil türü, boyut ve renge göre bir kez taranıp saklanan şekil dokularının önbelleği.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "render-strategies.h"
+#include "sdl-resource.h"
+
+/**
+ * @brief ShapeTextureCache, aynı tür, boyut ve renkteki şekilleri bir kez CPU üzerinde tarayıp SDLTexture olarak
+ *        saklar; sonraki karelerde şekil yeniden taranmaz, doku dörtgen olarak çizilir.
+ *
+ *        Dokuların toplam boyutu mBudget baytı aşınca en uzun süredir kullanılmayan dokular silinir. Toplayıcıya
+ *        eklenen dokular Present ile çizilene kadar geçerli kalmalıdır, bu yüzden içinde bulunulan karede
+ *        kullanılmış hiçbir doku silinmez; bütçe o kare için geçici olarak aşılabilir. Kareler BeginFrame ile
+ *        ayrılır. Bütçeye sığmayan ya da kMaxSide değerinden büyük şekiller saklanmaz ve Acquire nullptr döner.
+ */
+class ShapeTextureCache {
+public:
+    static constexpr int32_t kMaxSide = 1024;
+    static constexpr size_t kDefaultBudget = 16u * 1024u * 1024u;
+
+    explicit ShapeTextureCache(size_t budget = kDefaultBudget);
+
+    /**
+     * @brief width x height piksellik, color renkli şeklin dokusunu döner; yoksa tarayıp oluşturur.
+     *        Doku oluşturulamazsa nullptr döner.
+     */
+    SDL_Texture* Acquire(SDL_Renderer* renderer, ShapeType type, int32_t width, int32_t height, SDL_Color color);
+
+    /**
+     * @brief Yeni bir karenin başladığını bildirir; önceki karelerde kullanılan dokular artık silinebilir.
+     */
+    void BeginFrame() { mFrame++; }
+
+    /**
+     * @brief Bayt bütçesini değiştirir ve gerekirse dokuları siler. 0 önbelleği kapatır.
+     */
+    void SetBudget(size_t budget);
+
+    /**
+     * @brief Tüm dokuları siler.
+     */
+    void Clear();
+
+    size_t GetBudget() const { return mBudget; }
+    size_t Bytes() const { return mBytes; }
+    size_t Size() const { return mEntries.size(); }
+    size_t Hits() const { return mHits; }
+    size_t Misses() const { return mMisses; }
+
+    /**
+     * @brief Şekil türü, boyut ve rengi tek bir 64 bitlik anahtara paketler.
+     */
+    static uint64_t MakeKey(ShapeType type, int32_t width, int32_t height, SDL_Color color);
+
+    /**
+     * @brief Şekli RGBA32 biçiminde pixels dizisine tarar; şeklin dışı tamamen saydamdır. Daire, CircleRenderer
+     *        ile aynı pikselleri kapsar. Desteklenmeyen türlerde false döner.
+     */
+    static bool Rasterize(ShapeType type, int32_t width, int32_t height, SDL_Color color,
+                          std::vector<SDL_Color>& pixels);
+
+private:
+    struct Entry {
+        SDLTexture mTexture;
+        size_t mBytes;
+        uint64_t mLastFrame;
+        std::list<uint64_t>::iterator mOrder;
+    };
+
+    size_t mBudget;
+    size_t mBytes = 0;
+    uint64_t mFrame = 0;
+    size_t mHits = 0;
+    size_t mMisses = 0;
+
+    std::unordered_map<uint64_t, Entry> mEntries;
+
+    // Baş tarafta en son kullanılan anahtar bulunur
+    std::list<uint64_t> mOrder;
+
+    // Tarama tamponu, her yeni dokuda yeniden ayırma yapmamak için saklanır
+    std::vector<SDL_Color> mPixels;
+
+    /**
+     * @brief Toplam boyut bütçeyi aşarken bu karede kullanılmamış en eski dokuları siler.
+     */
+    void Evict();
+};
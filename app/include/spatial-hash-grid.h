@@ -0,0 +1,187 @@
+/**
+ * @file spatial-hash-grid.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Nesne konumlarını eşit boyutlu hücrelere dağıtan ve komşuluk sorgularını hızlandıran uzamsal özet ızgarası.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "entity.h"
+
+class Registry;
+class JobSystem;
+
+/**
+ * @brief SpatialHashGrid, düzlemi cellSize boyutunda hücrelere böler ve hücre koordinatlarını sabit sayıda kovaya (bucket)
+ *        özetler; böylece dünya sınırı gerekmez. Her adımda noktalar sayarak sıralama (counting sort) ile kovalarına göre
+ *        yeniden dizilir: önce kova başına nokta sayılır, ön ek toplamıyla başlangıçlar bulunur ve noktalar bitişik
+ *        dizilere yerleştirilir. Sorgular yalnızca kapsadıkları hücrelerin kovalarını gezer ve bellek ayırmaz.
+ *        Farklı hücreler aynı kovaya düşebildiğinden sorgu, noktanın hücresini yeniden hesaplayarak yalnızca
+ *        ziyaret ettiği hücreye ait noktaları kabul eder, bu yüzden sonuçlarda tekrar olmaz.
+ *        Kapasiteler bir kez büyüdükten sonra Build de bellek ayırmaz.
+ */
+class SpatialHashGrid {
+private:
+    float mCellSize;
+    float mInverseCellSize;
+    uint32_t mMinBucketCount;
+    uint32_t mBucketMask = 0;
+
+    // Kova başlangıçları; mBucketStart[b] .. mBucketStart[b + 1] arası b kovasındaki noktalardır
+    std::vector<uint32_t> mBucketStart;
+
+    struct Point {
+        float mX;
+        float mY;
+        Entity mEntity;
+    };
+
+    // Kovalara göre sıralanmış noktalar; 16 baytlık noktalar yerleştirme sırasında tek bir bellek satırına yazılır
+    std::vector<Point> mPoints;
+
+    // Build öncesi eklenme sırasındaki noktalar ve kovaları
+    std::vector<Point> mInPoints;
+    std::vector<uint32_t> mInBucket;
+
+    // Hücre koordinatları [-kMaxCell, kMaxCell] aralığına kırpılır; böylece tamsayıya çevirme ve hücre döngüleri taşmaz
+    static constexpr int32_t kMaxCell = 1 << 30;
+
+    int32_t CellCoord(float value) const {
+        // std::floor bazı derlemelerde kütüphane çağrısına dönüştüğünden kesme ve düzeltme ile hesaplanır.
+        // Aralık dışındaki, sonsuz ve NaN değerler tamsayıya çevrilmeden önce kırpılır
+        const float scaled = value * mInverseCellSize;
+        if (!(scaled > -static_cast<float>(kMaxCell))) {
+            return -kMaxCell;
+        }
+        if (!(scaled < static_cast<float>(kMaxCell))) {
+            return kMaxCell;
+        }
+        const auto truncated = static_cast<int32_t>(scaled);
+        return truncated - static_cast<int32_t>(scaled < static_cast<float>(truncated));
+    }
+
+    uint32_t BucketOf(int32_t cellX, int32_t cellY) const {
+        uint32_t hash = static_cast<uint32_t>(cellX) * 0x9E3779B1u ^ static_cast<uint32_t>(cellY) * 0x85EBCA77u;
+        hash ^= hash >> 15;
+        return hash & mBucketMask;
+    }
+
+    bool InCell(const Point& point, int32_t cellX, int32_t cellY) const {
+        return CellCoord(point.mX) == cellX && CellCoord(point.mY) == cellY;
+    }
+
+    void PrepareKeys(size_t count);
+    void ComputeKeys(size_t begin, size_t end);
+    void Sort();
+
+    /**
+     * @brief [minX, maxX] x [minY, maxY] hücre aralığındaki kovaları gezer. fn(const Point&, cellX, cellY) şeklinde çağrılır;
+     *        kovada başka hücrelerin noktaları da bulunabileceğinden çağıran InCell ile kontrol etmelidir.
+     *        Aralık kova sayısından fazla hücre kapsıyorsa aynı kovalar tekrar tekrar gezilmesin diye her kova bir kez
+     *        taranır ve noktalar kendi hücreleriyle bildirilir.
+     */
+    template<typename Fn>
+    void ForEachInCells(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY, Fn&& fn) const {
+        if (mBucketStart.empty() || minX > maxX || minY > maxY) {
+            return;
+        }
+
+        const uint64_t cellCount = (static_cast<uint64_t>(static_cast<int64_t>(maxX) - minX) + 1)
+            * (static_cast<uint64_t>(static_cast<int64_t>(maxY) - minY) + 1);
+        if (cellCount > BucketCount()) {
+            for (const Point& point : mPoints) {
+                const int32_t cellX = CellCoord(point.mX);
+                const int32_t cellY = CellCoord(point.mY);
+                if (cellX >= minX && cellX <= maxX && cellY >= minY && cellY <= maxY) {
+                    fn(point, cellX, cellY);
+                }
+            }
+            return;
+        }
+
+        for (int32_t cellY = minY; cellY <= maxY; cellY++) {
+            for (int32_t cellX = minX; cellX <= maxX; cellX++) {
+                const uint32_t bucket = BucketOf(cellX, cellY);
+                const uint32_t end = mBucketStart[bucket + 1];
+                for (uint32_t i = mBucketStart[bucket]; i < end; i++) {
+                    fn(mPoints[i], cellX, cellY);
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief cellSize genellikle en sık yapılan sorgu yarıçapının iki katı civarında seçilir.
+     *        Kova sayısı 2'nin kuvvetine yuvarlanır ve nokta sayısı arttıkça kova başına ortalama birkaç nokta düşecek şekilde büyür.
+     */
+    explicit SpatialHashGrid(float cellSize = 32.0f, uint32_t minBucketCount = 4096);
+
+    /**
+     * @brief Bir sonraki Build için tüm noktaları temizler.
+     */
+    void Clear();
+
+    /**
+     * @brief Bir sonraki Build'e dahil edilecek noktayı ekler. Sorgular Build çağrılana kadar eski düzeni görür.
+     */
+    void Insert(Entity entity, float x, float y);
+
+    /**
+     * @brief Eklenen noktaları kovalarına göre yeniden dizer.
+     */
+    void Build();
+
+    /**
+     * @brief Dönüşümü olan tüm nesnelerden ızgarayı yeniden oluşturur. Sahne ağacındaki nesneler için dünya konumu kullanılır.
+     *        JobSystem verildiğinde konumların toplanması ve hücre anahtarlarının hesabı parçalara bölünür.
+     */
+    void Build(Registry& registry, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief (x, y) merkezli radius yarıçaplı daire içindeki nesneler için fn(Entity) çağırır.
+     */
+    template<typename Fn>
+    void ForEachInRadius(float x, float y, float radius, Fn&& fn) const {
+        const float radiusSquared = radius * radius;
+        ForEachInCells(CellCoord(x - radius), CellCoord(y - radius), CellCoord(x + radius), CellCoord(y + radius),
+            [&](const Point& point, int32_t cellX, int32_t cellY) {
+                // Ucuz mesafe testi önce yapılır, hücre kontrolü yalnızca kabul edilen noktalar için gerekir
+                const float dx = point.mX - x;
+                const float dy = point.mY - y;
+                if (dx * dx + dy * dy <= radiusSquared && InCell(point, cellX, cellY)) {
+                    fn(point.mEntity);
+                }
+            });
+    }
+
+    /**
+     * @brief [minX, maxX] x [minY, maxY] kutusu içindeki nesneler için fn(Entity) çağırır.
+     */
+    template<typename Fn>
+    void ForEachInBox(float minX, float minY, float maxX, float maxY, Fn&& fn) const {
+        ForEachInCells(CellCoord(minX), CellCoord(minY), CellCoord(maxX), CellCoord(maxY),
+            [&](const Point& point, int32_t cellX, int32_t cellY) {
+                if (point.mX >= minX && point.mX <= maxX && point.mY >= minY && point.mY <= maxY
+                    && InCell(point, cellX, cellY)) {
+                    fn(point.mEntity);
+                }
+            });
+    }
+
+    /**
+     * @brief Daire içindeki nesneleri out dizisine yazar ve bulunan toplam nesne sayısını döner.
+     *        Dönen değer out boyutundan büyükse sonuçların yalnızca ilk out.size() tanesi yazılmıştır.
+     */
+    size_t QueryRadius(float x, float y, float radius, std::span<Entity> out) const;
+    size_t QueryBox(float minX, float minY, float maxX, float maxY, std::span<Entity> out) const;
+
+    size_t Size() const { return mPoints.size(); }
+    size_t BucketCount() const { return mBucketStart.empty() ? 0 : mBucketStart.size() - 1; }
+    float CellSize() const { return mCellSize; }
+};
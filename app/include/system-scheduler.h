@@ -0,0 +1,139 @@
+/**
+ * @file system-scheduler.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Sistemleri okudukları ve yazdıkları bileşen türlerine göre aşamalara ayırıp paralel çalıştıran zamanlayıcı.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "collision.h"
+#include "component-store.h"
+#include "job-system.h"
+#include "spatial-hash-grid.h"
+
+class Registry;
+
+/**
+ * @brief Sistemlerin sahip olduğu ve bileşen olmayan paylaşılan yapıların maske bitleridir. Bir yapıyı yeniden
+ *        oluşturan sistem bitini Writes, sorgulayan sistem ise Reads maskesine ekler; böylece tüketiciler
+ *        üreticiyle aynı aşamaya düşmez.
+ */
+constexpr ComponentMask ResourceMaskOf(uint32_t resource) {
+    return ComponentMask{1} << (kMaxComponentTypes + resource);
+}
+
+constexpr ComponentMask kSpatialGridResource = ResourceMaskOf(0);
+constexpr ComponentMask kCollisionWorldResource = ResourceMaskOf(1);
+
+/**
+ * @brief Güncelleme aşamasında çalışan sistemler için soyut sınıftır.
+ *        Her sistem hangi bileşen türlerini okuduğunu ve hangilerine yazdığını bildirir.
+ *        Run içerisinde nesne ve bileşenler doğrudan oluşturulmamalı ya da silinmemelidir; bu değişiklikler
+ *        registry.Commands() üzerine kaydedilir ve tüm aşamalar bittikten sonra toplu olarak uygulanır.
+ *        Aynı şekilde Run içinde depoya yeni havuz eklenmemelidir: havuzlar Pool yerine FindPool ile aranır.
+ *        View ise Run içinde oluşturulabilir: havuzları FindPool ile arar, eşleşme listelerinin oluşturulması da depo
+ *        tarafından eşitlenir.
+ */
+class System {
+public:
+    virtual ~System() = default;
+    virtual ComponentMask Reads() const = 0;
+    virtual ComponentMask Writes() const = 0;
+    virtual void Run(Registry& registry, JobSystem& jobs, float deltaTime) = 0;
+};
+
+/**
+ * @brief SystemScheduler, eklenen sistemleri çakışmayanlar aynı aşamada olacak şekilde gruplar.
+ *        Bir sistemin yazdığı türü diğeri okuyor ya da yazıyorsa iki sistem çakışır ve eklenme sıraları korunur.
+ *        Aynı aşamadaki sistemler JobSystem üzerinde birlikte çalıştırılır.
+ */
+class SystemScheduler {
+private:
+    JobSystem& mJobs;
+    std::vector<std::unique_ptr<System>> mSystems;
+    std::vector<std::vector<System*>> mStages;
+
+public:
+    explicit SystemScheduler(JobSystem& jobs);
+
+    System& AddSystem(std::unique_ptr<System> system);
+    void Run(Registry& registry, float deltaTime);
+
+    size_t StageCount() const { return mStages.size(); }
+    const std::vector<System*>& GetStage(size_t index) const { return mStages[index]; }
+
+    static bool Conflicts(const System& first, const System& second);
+};
+
+/**
+ * @brief Her nesnenin bileşenlerindeki sanal Update fonksiyonlarını çağıran sistemdir.
+ *        Bileşenlerin neye dokunduğu bilinemediğinden tüm türleri okuyup yazdığı kabul edilir ve tek başına çalışır.
+ *        Transform havuzu izleniyorsa Update sırasında dönüşümü değişen nesneler izleyenlere bildirilir.
+ */
+class ComponentUpdateSystem : public System {
+public:
+    ComponentMask Reads() const override { return ~ComponentMask{0}; }
+    ComponentMask Writes() const override { return ~ComponentMask{0}; }
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+};
+
+/**
+ * @brief Her simülasyon adımının başında dönüşümlerin güncel değerlerini önceki adım olarak saklayan sistemdir.
+ *        Dönüşüme yazan diğer sistemlerden önce eklenmelidir; çizim bu değerlerle adımlar arasında ara değer alır.
+ */
+class TransformSnapshotSystem : public System {
+public:
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+};
+
+/**
+ * @brief Sahne ağacındaki dünya dönüşümlerini güncelleyen sistemdir. Yerel dönüşümlere yazan sistemlerden sonra eklenmelidir.
+ */
+class SceneGraphSystem : public System {
+public:
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+};
+
+/**
+ * @brief Sahip olduğu uzamsal ızgarayı güncel konumlarla yeniden oluşturan sistemdir.
+ *        Konumlara yazan sistemlerden sonra eklenmelidir. Izgarayı sorgulayan sistemler Grid() ile aldıkları
+ *        başvuruyu tutar ve Reads maskesine kSpatialGridResource ekler; böylece yeniden oluşturmayla aynı aşamada
+ *        çalışmazlar.
+ */
+class SpatialGridSystem : public System {
+private:
+    SpatialHashGrid mGrid;
+
+public:
+    explicit SpatialGridSystem(float cellSize = 32.0f);
+
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+
+    const SpatialHashGrid& Grid() const { return mGrid; }
+};
+
+/**
+ * @brief Sahip olduğu temas listesini güncel konumlarla yeniden hesaplayan sistemdir.
+ *        Temasları kullanan sistemler bu sistemden sonra eklenir, World() ile aldıkları başvuruyu tutar ve Reads
+ *        maskesine kCollisionWorldResource ekler; böylece temas listesi yeniden hesaplanırken okunmaz.
+ */
+class CollisionSystem : public System {
+private:
+    CollisionWorld mWorld;
+
+public:
+    ComponentMask Reads() const override;
+    ComponentMask Writes() const override;
+    void Run(Registry& registry, JobSystem& jobs, float deltaTime) override;
+
+    const CollisionWorld& World() const { return mWorld; }
+};
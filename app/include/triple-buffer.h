@@ -0,0 +1,64 @@
+/**
+ * @file triple-buffer.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Tek yazar ve tek okuyucu arasında kilitsiz veri aktarımı için üçlü tampon.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief TripleBuffer, bir iş parçacığının ürettiği en güncel değeri diğerine beklemeden aktarır.
+ *        Üç yuvadan biri yazara (arka), biri okuyucuya (ön) aittir; üçüncüsü ortada bekler. Yazar arka yuvayı
+ *        doldurup Publish ile ortadakiyle değiştirir, okuyucu da Acquire ile yeni bir değer varsa ortadakini ön yuvayla
+ *        değiştirir. Değişim tek bir atomik exchange ile yapıldığından iki taraf da hiçbir zaman beklemez ve aynı yuvaya
+ *        aynı anda dokunmaz. Okuyucunun kaçırdığı ara değerler atılır; okuyucu her zaman en son yayınlanan değeri görür.
+ *        Yuvalar yeniden kullanıldığından T'nin içindeki diziler bir kez büyüdükten sonra bellek ayrılmaz.
+ */
+template<typename T>
+class TripleBuffer {
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kFreshBit = 0x4;
+
+    std::array<T, 3> mSlots;
+
+    // Yazar ve okuyucunun yuvaları ayrı önbellek satırlarında tutulur
+    alignas(64) std::atomic<uint8_t> mMiddle{1};
+    alignas(64) uint8_t mBack = 0;
+    alignas(64) uint8_t mFront = 2;
+
+public:
+    /**
+     * @brief Yazarın dolduracağı yuvadır. Yalnızca yazar iş parçacığı kullanmalıdır.
+     */
+    T& Back() { return mSlots[mBack]; }
+
+    /**
+     * @brief Arka yuvayı yayınlar. Sonrasında Back farklı bir yuvayı, önceki içeriğiyle birlikte döner.
+     */
+    void Publish() {
+        const uint8_t previous = mMiddle.exchange(static_cast<uint8_t>(mBack | kFreshBit), std::memory_order_acq_rel);
+        mBack = previous & kIndexMask;
+    }
+
+    /**
+     * @brief Yeni bir değer yayınlandıysa onu ön yuvaya alır ve true döner. Yalnızca okuyucu iş parçacığı kullanmalıdır.
+     */
+    bool Acquire() {
+        if ((mMiddle.load(std::memory_order_relaxed) & kFreshBit) == 0) {
+            return false;
+        }
+        const uint8_t previous = mMiddle.exchange(mFront, std::memory_order_acq_rel);
+        mFront = previous & kIndexMask;
+        return true;
+    }
+
+    /**
+     * @brief Okuyucunun en son aldığı değerdir; bir sonraki Acquire çağrısına kadar değişmez.
+     */
+    const T& Front() const { return mSlots[mFront]; }
+};
@@ -0,0 +1,80 @@
+/**
+ * @file view.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Birden fazla bileşen türüne birlikte sahip nesneleri gezmek için kullanılan sorgu görünümü.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "component-store.h"
+
+/**
+ * @brief View<Transform, Velocity> şeklinde kullanılır ve yalnızca istenen bileşenlerin hepsine sahip nesneleri gezer.
+ *        Eşleşen nesneler depodaki önbelleğe alınmış MatchList'ten okunur, bu yüzden görünüm oluşturmak ucuzdur ve
+ *        gezinti sırasında eşleşmeyen nesnelere hiç bakılmaz. Bileşenlere havuzlar üzerinden doğrudan erişilir;
+ *        sanal çağrı ya da tür dönüşümü yapılmaz. Havuzlar FindPool ile arandığından görünüm oluşturmak depoya yeni
+ *        havuz eklemez; havuzu henüz olmayan bir tür varsa eşleşme listesi de boştur. Eşleşme listesi depo ile
+ *        birlikte güncellendiğinden, görünümden sonra oluşturulan havuzlar erişim sırasında depodan aranır.
+ *        Gezinti sırasında bileşen eklenmemeli ya da silinmemelidir, bu değişiklikler CommandBuffer ile yapılmalıdır.
+ */
+template<typename... Ts>
+class View {
+    static_assert(sizeof...(Ts) > 0, "View requires at least one component type");
+
+private:
+    const ComponentStore* mStore;
+    const MatchList* mMatches;
+    std::tuple<ComponentPool<Ts>*...> mPools;
+
+public:
+    /**
+     * @brief exclude maskesindeki türlerden herhangi birine sahip nesneler görünüme dahil edilmez.
+     */
+    explicit View(ComponentStore& store, ComponentMask exclude = 0)
+        : mStore(&store),
+          mMatches(&store.Match((ComponentMaskOf<Ts>() | ...), exclude)),
+          mPools(store.FindPool<Ts>()...) {
+    }
+
+    size_t Size() const { return mMatches->Size(); }
+    bool Empty() const { return mMatches->Size() == 0; }
+    ObjectId IdAt(size_t index) const { return mMatches->IdAt(index); }
+
+    /**
+     * @brief Eşleşen nesnenin istenen bileşenine erişir. id bu görünümde eşleşen bir nesne olmalıdır.
+     */
+    template<typename T>
+    T& Get(ObjectId id) const {
+        ComponentPool<T>* pool = std::get<ComponentPool<T>*>(mPools);
+        if (!pool) {
+            pool = mStore->FindPool<T>();
+        }
+        return *pool->GetUnchecked(id);
+    }
+
+    /**
+     * @brief Eşleşme listesinin [begin, end) aralığını gezer; paralel çalışan sistemlerin parçalara bölmesi içindir.
+     *        fn(Ts&...) ya da fn(ObjectId, Ts&...) şeklinde çağrılır.
+     */
+    template<typename Fn>
+    void ForEach(size_t begin, size_t end, Fn&& fn) const {
+        const ObjectId* ids = mMatches->Data();
+        for (size_t i = begin; i < end; i++) {
+            const ObjectId id = ids[i];
+            if constexpr (std::is_invocable_v<Fn&, ObjectId, Ts&...>) {
+                fn(id, Get<Ts>(id)...);
+            } else {
+                fn(Get<Ts>(id)...);
+            }
+        }
+    }
+
+    template<typename Fn>
+    void ForEach(Fn&& fn) const {
+        ForEach(0, Size(), std::forward<Fn>(fn));
+    }
+};
@@ -0,0 +1,75 @@
+/**
+ * @file viewport-culler.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Çizilecek nesnelerin sınır kutularını dinamik AABB ağacında tutan ve yalnızca görünenleri döndüren ayıklayıcı.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "component-store.h"
+#include "dynamic-aabb-tree.h"
+#include "render-strategies.h"
+
+class Registry;
+
+/**
+ * @brief ViewportCuller, RenderComponent bileşeni olan her nesne için ağaçta bir yaprak tutar.
+ *        Sınır kutusu stratejinin şekil boyutu ile dönüşümün ölçeğinden hesaplanır; çizimde önceki ve güncel adım
+ *        arasında ara değer alındığından kutu iki konumu da kapsar. Update tüm havuzu taramaz; Transform,
+ *        WorldTransform ve RenderComponent havuzlarını ChangeList ile izler ve yalnızca son güncellemeden beri
+ *        eklenen, silinen ya da yazılan nesnelerin kutularını eşitler. Ağaç yalnızca genişletilmiş kutusundan çıkan
+ *        nesneler için değişir. Query ise görüş alanıyla kesişen nesneleri bulur, böylece çizime gönderilen nesne
+ *        sayısı toplam nesne sayısına değil görünen nesne sayısına bağlı olur.
+ */
+class ViewportCuller {
+private:
+    static constexpr int32_t kNoProxy = DynamicAabbTree::kNullNode;
+
+    DynamicAabbTree mTree;
+    std::vector<int32_t> mProxyOf;
+    std::vector<ObjectId> mVisible;
+    ChangeList mTransformChanges;
+    ChangeList mWorldChanges;
+    ChangeList mRenderChanges;
+
+    /**
+     * @brief Havuz oluşmuşsa ve henüz izlenmiyorsa list'i ona bağlar; bağlanma havuzdaki mevcut nesneleri de listeye ekler.
+     */
+    template<typename T>
+    static void TrackIfPresent(const ComponentStore& store, ChangeList& list) {
+        if (!list.IsTracking()) {
+            if (auto* pool = store.FindPool<T>()) {
+                pool->Track(list);
+            }
+        }
+    }
+
+    /**
+     * @brief Listedeki nesnelerin yapraklarını oluşturur, taşır ya da çizilemez hale gelenleri siler; ardından listeyi boşaltır.
+     */
+    void Sync(const ComponentPool<RenderComponent>* renders, ChangeList& changes);
+
+public:
+    explicit ViewportCuller(float margin = 16.0f);
+
+    /**
+     * @brief Son çağrıdan beri değişen çizilebilir nesnelerin kutularını günceller; yeni nesneleri ekler, silinenleri
+     *        ağaçtan çıkarır. Dönüşüme yerinde yazan kod ComponentStore::MarkChanged ile bildirimde bulunmalıdır.
+     */
+    void Update(Registry& registry);
+
+    /**
+     * @brief viewport ile kesişen nesnelerin numaralarını artan sırada döner. Dönen dizi bir sonraki sorguya kadar geçerlidir.
+     */
+    const std::vector<ObjectId>& Query(const Aabb& viewport);
+
+    /**
+     * @brief Şeklin dönüşüm uygulanmış sınır kutusunu döner. Üçgen dönebildiğinden çevrel çemberi kullanılır.
+     */
+    static Aabb ComputeBounds(const ShapeDesc& shape, const Transform& transform);
+
+    size_t ProxyCount() const { return mTree.ProxyCount(); }
+};
@@ -0,0 +1,49 @@
+/**
+ * @file world-snapshot.h
+ * @author yazilimperver (yazilimperver@gmail.com)
+ * @brief Dünyadaki nesneleri sürümlü ve sıkışık bir ikili dosyaya kaydeden, dosyayı belleğe eşleyerek yükleyen sınıf.
+ * @date 2026-10-17
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "entity.h"
+
+class Registry;
+
+/**
+ * @brief WorldSnapshot, sahneyi nesne nesne fabrikadan kurmak yerine tek dosyadan yüklemeyi sağlar.
+ *        Dosya bir başlık, bir bölüm tablosu ve bölümlerden oluşur. Her bileşen türü kendi bölümünde bitişik bir dizi
+ *        olarak durur: önce sahip nesnelerin dosya içi numaraları, ardından sanal tablo ve işaretçi içermeyen düz
+ *        kayıtlar gelir. Render stratejileri ayrı bir bölümde bir kez yazılır ve nesneler bunlara numara ile bağlanır,
+ *        böylece paylaşılan stratejiler yüklemeden sonra da paylaşılır. Sahne ağacındaki ebeveynler de saklanır;
+ *        WorldTransform ise türetilmiş bir değer olduğundan kaydedilmez ve SceneGraph tarafından yeniden hesaplanır.
+ *
+ *        Yükleme dosyayı mmap ile eşler ve kayıtları doğrudan eşlenmiş bellekten okuyarak bileşen havuzlarının
+ *        sayfalarına tek geçişte kurar; arada ne ayrıştırma ne de ara tampon vardır. Dosyanın tamamı kayıt değiştirilmeden
+ *        önce doğrulanır, bu nedenle bozuk ya da desteklenmeyen bir dosya std::runtime_error fırlatır ve Registry'ye
+ *        hiçbir nesne eklenmez. Bilinmeyen bölümler atlanır, böylece yeni bölüm ekleyen sürümler eski dosyaları okuyabilir.
+ *        Dosya, yazıldığı makinenin bayt sırasıyla saklanır ve farklı bayt sırasındaki dosyalar reddedilir.
+ */
+class WorldSnapshot {
+public:
+    /**
+     * @brief Sürüm 2, RenderComponent katmanlarını ayrı bir bölümde saklar. Sürüm 1 dosyaları da okunur; nesneleri
+     *        varsayılan katmanda yüklenir.
+     */
+    static constexpr uint32_t kVersion = 2;
+
+    /**
+     * @brief Registry'deki yaşayan tüm nesnelerin Transform, Velocity, RenderComponent (katmanıyla birlikte) ve
+     *        Collider bileşenlerini ve ebeveynlerini path dosyasına yazar. Bu türlerin dışındaki bileşenler kaydedilmez.
+     */
+    static void Save(Registry& registry, const std::string& path);
+
+    /**
+     * @brief path dosyasındaki nesneleri Registry'ye ekler ve tutamaçlarını kaydedildikleri sırayla döner.
+     */
+    static std::vector<Entity> Load(Registry& registry, const std::string& path);
+};
@@ -0,0 +1,555 @@
+#include "collision.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "registry.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define COLLISION_X86 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// Eklemeli sıralamada proxy başına izin verilen ortalama kaydırma; aşılırsa sıra tamamen yeniden kurulur
+constexpr size_t kInsertionShiftBudget = 8;
+
+// Süpürme bantlarının ortalama nesne yüksekliğine oranı
+constexpr float kBandHeightFactor = 4.0f;
+
+struct Vec2 {
+    float mX;
+    float mY;
+};
+
+float Dot(Vec2 first, Vec2 second) {
+    return first.mX * second.mX + first.mY * second.mY;
+}
+
+void Project(const Vec2* vertices, size_t count, Vec2 axis, float& min, float& max) {
+    min = max = Dot(vertices[0], axis);
+    for (size_t i = 1; i < count; i++) {
+        const float value = Dot(vertices[i], axis);
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+}
+
+/**
+ * Ayırıcı eksen teoremi; ayırıcı eksen bulunursa false, aksi halde en az iç içe geçme ekseni ve miktarı döner.
+ * Daire verilirse (radius > 0) dairenin merkezine en yakın köşeden geçen eksen de denenir.
+ */
+bool SeparatingAxisTest(const Vec2* first, size_t firstCount, const Vec2* second, size_t secondCount,
+                        Vec2 circleCenter, float radius, Vec2& normal, float& depth) {
+    depth = std::numeric_limits<float>::max();
+
+    auto testAxis = [&](Vec2 axis) {
+        const float length = std::sqrt(Dot(axis, axis));
+        if (length <= 0.0f) {
+            return true;
+        }
+        axis = Vec2{axis.mX / length, axis.mY / length};
+
+        float firstMin, firstMax, secondMin, secondMax;
+        Project(first, firstCount, axis, firstMin, firstMax);
+        if (secondCount > 0) {
+            Project(second, secondCount, axis, secondMin, secondMax);
+        } else {
+            const float center = Dot(circleCenter, axis);
+            secondMin = center - radius;
+            secondMax = center + radius;
+        }
+
+        const float overlap = std::min(firstMax, secondMax) - std::max(firstMin, secondMin);
+        if (overlap <= 0.0f) {
+            return false;
+        }
+        if (overlap < depth) {
+            depth = overlap;
+            normal = axis;
+        }
+        return true;
+    };
+
+    auto testEdges = [&](const Vec2* vertices, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            const Vec2 from = vertices[i];
+            const Vec2 to = vertices[(i + 1) % count];
+            if (!testAxis(Vec2{from.mY - to.mY, to.mX - from.mX})) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (!testEdges(first, firstCount)) {
+        return false;
+    }
+    if (secondCount > 0) {
+        return testEdges(second, secondCount);
+    }
+
+    Vec2 closest = first[0];
+    float closestDistance = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < firstCount; i++) {
+        const Vec2 offset{circleCenter.mX - first[i].mX, circleCenter.mY - first[i].mY};
+        const float distance = Dot(offset, offset);
+        if (distance < closestDistance) {
+            closestDistance = distance;
+            closest = first[i];
+        }
+    }
+    return testAxis(Vec2{circleCenter.mX - closest.mX, circleCenter.mY - closest.mY});
+}
+
+void OverlapCirclesScalar(const float* ax, const float* ay, const float* ar, const float* bx, const float* by,
+                          const float* br, size_t begin, size_t count, uint8_t* hits) {
+    for (size_t i = begin; i < count; i++) {
+        const float dx = bx[i] - ax[i];
+        const float dy = by[i] - ay[i];
+        const float radius = ar[i] + br[i];
+        hits[i] = dx * dx + dy * dy < radius * radius;
+    }
+}
+
+void OverlapBoxCirclesScalar(const float* boxX, const float* boxY, const float* halfWidth, const float* halfHeight,
+                             const float* circleX, const float* circleY, const float* radius, size_t begin,
+                             size_t count, uint8_t* hits) {
+    for (size_t i = begin; i < count; i++) {
+        // Daire merkezinin kutuya uzaklığı; kutunun içindeyse sıfırdır
+        const float dx = std::max(std::fabs(circleX[i] - boxX[i]) - halfWidth[i], 0.0f);
+        const float dy = std::max(std::fabs(circleY[i] - boxY[i]) - halfHeight[i], 0.0f);
+        hits[i] = dx * dx + dy * dy < radius[i] * radius[i];
+    }
+}
+
+void StoreHits(int mask, uint8_t* hits) {
+    hits[0] = static_cast<uint8_t>(mask & 1);
+    hits[1] = static_cast<uint8_t>((mask >> 1) & 1);
+    hits[2] = static_cast<uint8_t>((mask >> 2) & 1);
+    hits[3] = static_cast<uint8_t>((mask >> 3) & 1);
+}
+
+} // namespace
+
+void CollisionWorld::OverlapCircles(const float* ax, const float* ay, const float* ar,
+                                    const float* bx, const float* by, const float* br, size_t count, uint8_t* hits) {
+    size_t i = 0;
+#if defined(COLLISION_X86)
+    for (; i + 4 <= count; i += 4) {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(bx + i), _mm_loadu_ps(ax + i));
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(by + i), _mm_loadu_ps(ay + i));
+        const __m128 radius = _mm_add_ps(_mm_loadu_ps(ar + i), _mm_loadu_ps(br + i));
+        const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        StoreHits(_mm_movemask_ps(_mm_cmplt_ps(distance, _mm_mul_ps(radius, radius))), hits + i);
+    }
+#endif
+    OverlapCirclesScalar(ax, ay, ar, bx, by, br, i, count, hits);
+}
+
+void CollisionWorld::OverlapBoxCircles(const float* boxX, const float* boxY, const float* halfWidth,
+                                       const float* halfHeight, const float* circleX, const float* circleY,
+                                       const float* radius, size_t count, uint8_t* hits) {
+    size_t i = 0;
+#if defined(COLLISION_X86)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(circleX + i), _mm_loadu_ps(boxX + i)), absMask);
+        __m128 dy = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(circleY + i), _mm_loadu_ps(boxY + i)), absMask);
+        dx = _mm_max_ps(_mm_sub_ps(dx, _mm_loadu_ps(halfWidth + i)), zero);
+        dy = _mm_max_ps(_mm_sub_ps(dy, _mm_loadu_ps(halfHeight + i)), zero);
+        const __m128 r = _mm_loadu_ps(radius + i);
+        const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        StoreHits(_mm_movemask_ps(_mm_cmplt_ps(distance, _mm_mul_ps(r, r))), hits + i);
+    }
+#endif
+    OverlapBoxCirclesScalar(boxX, boxY, halfWidth, halfHeight, circleX, circleY, radius, i, count, hits);
+}
+
+void CollisionWorld::Update(Registry& registry) {
+    RefreshProxies(registry);
+    SortProxies();
+    FindPairs();
+
+    mContacts.clear();
+    TestCirclePairs(registry);
+    TestBoxCirclePairs(registry);
+    TestBoxPairs(registry);
+    TestPolygonPairs(registry);
+
+    // Temas sırası nesne numaralarına göre sabitlenir, böylece tüketen sistemler her çalıştırmada aynı sırayı görür
+    std::sort(mContacts.begin(), mContacts.end(), [](const Contact& first, const Contact& second) {
+        return first.mA.mIndex != second.mA.mIndex ? first.mA.mIndex < second.mA.mIndex
+                                                   : first.mB.mIndex < second.mB.mIndex;
+    });
+}
+
+void CollisionWorld::RefreshProxies(Registry& registry) {
+    ComponentStore& store = registry.Store();
+    // Paralel aşamada çalışabildiğinden havuzlar oluşturulmaz, yalnızca aranır
+    const ComponentPool<Collider>* colliders = store.FindPool<Collider>();
+    const ComponentPool<Transform>* transforms = store.FindPool<Transform>();
+    const ComponentPool<WorldTransform>* worldTransforms = store.FindPool<WorldTransform>();
+    mVertices.clear();
+
+    auto fill = [&](Proxy& proxy, ObjectId id) {
+        const Collider* collider = colliders ? colliders->Get(id) : nullptr;
+        const Transform* transform = worldTransforms ? worldTransforms->Get(id) : nullptr;
+        if (!transform && transforms) {
+            transform = transforms->Get(id);
+        }
+        if (!collider || !transform) {
+            return false;
+        }
+
+        const ShapeDesc& shape = collider->mShape;
+        proxy.mId = id;
+        proxy.mLayer = collider->mLayer;
+        proxy.mMask = collider->mMask;
+        proxy.mType = shape.mType;
+        proxy.mX = transform->mX;
+        proxy.mY = transform->mY;
+
+        if (shape.mType == ShapeType::Triangle) {
+            // Köşeler TriangleRenderer ile aynı şekilde hesaplanır
+            const float edge = shape.mWidth * transform->mScaleX;
+            const float height = edge * 0.866f;
+            const float local[3][2] = {
+                {0.0f, -height * 0.667f}, {-edge * 0.5f, height * 0.333f}, {edge * 0.5f, height * 0.333f}
+            };
+            const float cosR = std::cos(transform->mRotation);
+            const float sinR = std::sin(transform->mRotation);
+
+            proxy.mVertexOffset = static_cast<uint32_t>(mVertices.size());
+            proxy.mMinX = proxy.mMinY = std::numeric_limits<float>::max();
+            proxy.mMaxX = proxy.mMaxY = std::numeric_limits<float>::lowest();
+            for (const auto& vertex : local) {
+                const float x = proxy.mX + vertex[0] * cosR - vertex[1] * sinR;
+                const float y = proxy.mY + vertex[0] * sinR + vertex[1] * cosR;
+                mVertices.push_back(x);
+                mVertices.push_back(y);
+                proxy.mMinX = std::min(proxy.mMinX, x);
+                proxy.mMaxX = std::max(proxy.mMaxX, x);
+                proxy.mMinY = std::min(proxy.mMinY, y);
+                proxy.mMaxY = std::max(proxy.mMaxY, y);
+            }
+            proxy.mHalfWidth = (proxy.mMaxX - proxy.mMinX) * 0.5f;
+            proxy.mHalfHeight = (proxy.mMaxY - proxy.mMinY) * 0.5f;
+            return true;
+        }
+
+        if (shape.mType == ShapeType::Circle) {
+            // Daire testleri tek yarıçap kullandığından mScaleY bilerek yok sayılır (bkz. Collider)
+            proxy.mHalfWidth = proxy.mHalfHeight = std::fabs(shape.mWidth * 0.5f * transform->mScaleX);
+        } else {
+            proxy.mHalfWidth = std::fabs(shape.mWidth * 0.5f * transform->mScaleX);
+            proxy.mHalfHeight = std::fabs(shape.mHeight * 0.5f * transform->mScaleY);
+        }
+        proxy.mMinX = proxy.mX - proxy.mHalfWidth;
+        proxy.mMaxX = proxy.mX + proxy.mHalfWidth;
+        proxy.mMinY = proxy.mY - proxy.mHalfHeight;
+        proxy.mMaxY = proxy.mY + proxy.mHalfHeight;
+        return true;
+    };
+
+    // Mevcut sıra korunarak güncellenir, bileşeni silinen nesneler çıkarılır
+    size_t kept = 0;
+    for (size_t i = 0; i < mProxies.size(); i++) {
+        Proxy proxy = mProxies[i];
+        if (fill(proxy, proxy.mId)) {
+            mProxies[kept++] = proxy;
+        } else {
+            mListed[proxy.mId] = 0;
+        }
+    }
+    mProxies.resize(kept);
+
+    const size_t colliderCount = colliders ? colliders->Size() : 0;
+    for (uint32_t i = 0; i < colliderCount; i++) {
+        const ObjectId id = colliders->OwnerAt(i);
+        if (id >= mListed.size()) {
+            mListed.resize(static_cast<size_t>(id) + 1, 0);
+        }
+        if (mListed[id]) {
+            continue;
+        }
+
+        Proxy proxy{};
+        if (fill(proxy, id)) {
+            mProxies.push_back(proxy);
+            mListed[id] = 1;
+        }
+    }
+}
+
+void CollisionWorld::SortProxies() {
+    auto less = [](const Proxy& first, const Proxy& second) {
+        return first.mMinX != second.mMinX ? first.mMinX < second.mMinX : first.mId < second.mId;
+    };
+
+    // Nesneler adımlar arasında az hareket ettiğinden önceki sıra neredeyse sıralıdır
+    const size_t budget = mProxies.size() * kInsertionShiftBudget;
+    size_t shifts = 0;
+    for (size_t i = 1; i < mProxies.size() && shifts <= budget; i++) {
+        const Proxy proxy = mProxies[i];
+        size_t j = i;
+        for (; j > 0 && less(proxy, mProxies[j - 1]); j--) {
+            mProxies[j] = mProxies[j - 1];
+        }
+        mProxies[j] = proxy;
+        shifts += i - j;
+    }
+
+    if (shifts > budget) {
+        std::sort(mProxies.begin(), mProxies.end(), less);
+    }
+}
+
+void CollisionWorld::FindPairs() {
+    mCirclePairs.clear();
+    mBoxCirclePairs.clear();
+    mBoxPairs.clear();
+    mPolygonPairs.clear();
+    mPairCount = 0;
+
+    const size_t count = mProxies.size();
+    if (count == 0) {
+        return;
+    }
+
+    // Bant yüksekliği ortalama nesne yüksekliğinin birkaç katıdır; bant sayısı nesne sayısı ile sınırlıdır
+    float minY = std::numeric_limits<float>::max();
+    float maxY = std::numeric_limits<float>::lowest();
+    float totalHeight = 0.0f;
+    for (const Proxy& proxy : mProxies) {
+        minY = std::min(minY, proxy.mMinY);
+        maxY = std::max(maxY, proxy.mMaxY);
+        totalHeight += proxy.mMaxY - proxy.mMinY;
+    }
+    const float bandHeight = std::max(kBandHeightFactor * totalHeight / static_cast<float>(count), 1e-3f);
+    const size_t bandCount = std::clamp<size_t>(static_cast<size_t>((maxY - minY) / bandHeight) + 1, 1, count);
+    const float inverseBandHeight = static_cast<float>(bandCount) / std::max(maxY - minY, 1e-3f);
+    auto bandOf = [&](float y) {
+        return std::min(static_cast<size_t>((y - minY) * inverseBandHeight), bandCount - 1);
+    };
+
+    // Nesneler kapladıkları bantlara sayarak sıralama ile dağıtılır; x sırası korunduğundan her bant zaten sıralıdır
+    mBandStart.assign(bandCount + 1, 0);
+    for (const Proxy& proxy : mProxies) {
+        for (size_t band = bandOf(proxy.mMinY), last = bandOf(proxy.mMaxY); band <= last; band++) {
+            mBandStart[band + 1]++;
+        }
+    }
+    for (size_t band = 0; band < bandCount; band++) {
+        mBandStart[band + 1] += mBandStart[band];
+    }
+    mBandCursor.assign(mBandStart.begin(), mBandStart.end() - 1);
+    mBandEntries.resize(mBandStart[bandCount]);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t band = bandOf(mProxies[i].mMinY), last = bandOf(mProxies[i].mMaxY); band <= last; band++) {
+            mBandEntries[mBandCursor[band]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    for (size_t band = 0; band < bandCount; band++) {
+        const uint32_t end = mBandStart[band + 1];
+        for (uint32_t k = mBandStart[band]; k < end; k++) {
+            const uint32_t a = mBandEntries[k];
+            const Proxy& first = mProxies[a];
+            for (uint32_t l = k + 1; l < end && mProxies[mBandEntries[l]].mMinX <= first.mMaxX; l++) {
+                const uint32_t b = mBandEntries[l];
+                const Proxy& second = mProxies[b];
+                if (second.mMinY > first.mMaxY || first.mMinY > second.mMaxY) {
+                    continue;
+                }
+                // Birden fazla bantta karşılaşan çift yalnızca kesişimlerinin başladığı bantta sayılır
+                if (bandOf(std::max(first.mMinY, second.mMinY)) != band) {
+                    continue;
+                }
+                if (!(first.mLayer & second.mMask) || !(second.mLayer & first.mMask)) {
+                    continue;
+                }
+
+                if (first.mType == ShapeType::Triangle || second.mType == ShapeType::Triangle) {
+                    mPolygonPairs.push_back(Pair{a, b});
+                } else if (first.mType != second.mType) {
+                    // Dikdörtgen her zaman ilk sırada tutulur
+                    mBoxCirclePairs.push_back(first.mType == ShapeType::Rectangle ? Pair{a, b} : Pair{b, a});
+                } else if (first.mType == ShapeType::Circle) {
+                    mCirclePairs.push_back(Pair{a, b});
+                } else {
+                    mBoxPairs.push_back(Pair{a, b});
+                }
+            }
+        }
+    }
+
+    mPairCount = mCirclePairs.size() + mBoxCirclePairs.size() + mBoxPairs.size() + mPolygonPairs.size();
+}
+
+void CollisionWorld::AddContact(Registry& registry, const Proxy& a, const Proxy& b,
+                                float normalX, float normalY, float depth) {
+    if (a.mId < b.mId) {
+        mContacts.push_back(Contact{registry.EntityOf(a.mId), registry.EntityOf(b.mId), normalX, normalY, depth});
+    } else {
+        mContacts.push_back(Contact{registry.EntityOf(b.mId), registry.EntityOf(a.mId), -normalX, -normalY, depth});
+    }
+}
+
+void CollisionWorld::TestCirclePairs(Registry& registry) {
+    const size_t count = mCirclePairs.size();
+    for (auto& lane : mLanes) {
+        lane.resize(count);
+    }
+    mHits.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        const Proxy& a = mProxies[mCirclePairs[i].mA];
+        const Proxy& b = mProxies[mCirclePairs[i].mB];
+        mLanes[0][i] = a.mX;
+        mLanes[1][i] = a.mY;
+        mLanes[2][i] = a.mHalfWidth;
+        mLanes[3][i] = b.mX;
+        mLanes[4][i] = b.mY;
+        mLanes[5][i] = b.mHalfWidth;
+    }
+
+    OverlapCircles(mLanes[0].data(), mLanes[1].data(), mLanes[2].data(), mLanes[3].data(), mLanes[4].data(),
+                   mLanes[5].data(), count, mHits.data());
+
+    for (size_t i = 0; i < count; i++) {
+        if (!mHits[i]) {
+            continue;
+        }
+        const Proxy& a = mProxies[mCirclePairs[i].mA];
+        const Proxy& b = mProxies[mCirclePairs[i].mB];
+        const float dx = b.mX - a.mX;
+        const float dy = b.mY - a.mY;
+        const float distance = std::sqrt(dx * dx + dy * dy);
+        const float depth = a.mHalfWidth + b.mHalfWidth - distance;
+        if (distance > 0.0f) {
+            AddContact(registry, a, b, dx / distance, dy / distance, depth);
+        } else {
+            AddContact(registry, a, b, 1.0f, 0.0f, depth);
+        }
+    }
+}
+
+void CollisionWorld::TestBoxCirclePairs(Registry& registry) {
+    const size_t count = mBoxCirclePairs.size();
+    for (auto& lane : mLanes) {
+        lane.resize(count);
+    }
+    mHits.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        const Proxy& box = mProxies[mBoxCirclePairs[i].mA];
+        const Proxy& circle = mProxies[mBoxCirclePairs[i].mB];
+        mLanes[0][i] = box.mX;
+        mLanes[1][i] = box.mY;
+        mLanes[2][i] = box.mHalfWidth;
+        mLanes[3][i] = box.mHalfHeight;
+        mLanes[4][i] = circle.mX;
+        mLanes[5][i] = circle.mY;
+        mLanes[6][i] = circle.mHalfWidth;
+    }
+
+    OverlapBoxCircles(mLanes[0].data(), mLanes[1].data(), mLanes[2].data(), mLanes[3].data(), mLanes[4].data(),
+                      mLanes[5].data(), mLanes[6].data(), count, mHits.data());
+
+    for (size_t i = 0; i < count; i++) {
+        if (!mHits[i]) {
+            continue;
+        }
+        const Proxy& box = mProxies[mBoxCirclePairs[i].mA];
+        const Proxy& circle = mProxies[mBoxCirclePairs[i].mB];
+        const float radius = circle.mHalfWidth;
+        const float closestX = std::clamp(circle.mX, box.mMinX, box.mMaxX);
+        const float closestY = std::clamp(circle.mY, box.mMinY, box.mMaxY);
+        const float dx = circle.mX - closestX;
+        const float dy = circle.mY - closestY;
+        const float distance = std::sqrt(dx * dx + dy * dy);
+
+        if (distance > 0.0f) {
+            AddContact(registry, box, circle, dx / distance, dy / distance, radius - distance);
+            continue;
+        }
+
+        // Merkez kutunun içinde: en yakın kenardan dışarı itilir
+        const float offsetX = circle.mX - box.mX;
+        const float offsetY = circle.mY - box.mY;
+        const float penetrationX = box.mHalfWidth - std::fabs(offsetX);
+        const float penetrationY = box.mHalfHeight - std::fabs(offsetY);
+        if (penetrationX < penetrationY) {
+            AddContact(registry, box, circle, offsetX < 0.0f ? -1.0f : 1.0f, 0.0f, penetrationX + radius);
+        } else {
+            AddContact(registry, box, circle, 0.0f, offsetY < 0.0f ? -1.0f : 1.0f, penetrationY + radius);
+        }
+    }
+}
+
+void CollisionWorld::TestBoxPairs(Registry& registry) {
+    for (const Pair& pair : mBoxPairs) {
+        const Proxy& a = mProxies[pair.mA];
+        const Proxy& b = mProxies[pair.mB];
+        const float overlapX = std::min(a.mMaxX, b.mMaxX) - std::max(a.mMinX, b.mMinX);
+        const float overlapY = std::min(a.mMaxY, b.mMaxY) - std::max(a.mMinY, b.mMinY);
+        if (overlapX <= 0.0f || overlapY <= 0.0f) {
+            continue;
+        }
+
+        if (overlapX < overlapY) {
+            AddContact(registry, a, b, b.mX < a.mX ? -1.0f : 1.0f, 0.0f, overlapX);
+        } else {
+            AddContact(registry, a, b, 0.0f, b.mY < a.mY ? -1.0f : 1.0f, overlapY);
+        }
+    }
+}
+
+void CollisionWorld::TestPolygonPairs(Registry& registry) {
+    auto polygonOf = [this](const Proxy& proxy, Vec2* out) -> size_t {
+        if (proxy.mType == ShapeType::Triangle) {
+            const float* vertices = mVertices.data() + proxy.mVertexOffset;
+            for (size_t i = 0; i < 3; i++) {
+                out[i] = Vec2{vertices[i * 2], vertices[i * 2 + 1]};
+            }
+            return 3;
+        }
+        if (proxy.mType == ShapeType::Rectangle) {
+            out[0] = Vec2{proxy.mMinX, proxy.mMinY};
+            out[1] = Vec2{proxy.mMaxX, proxy.mMinY};
+            out[2] = Vec2{proxy.mMaxX, proxy.mMaxY};
+            out[3] = Vec2{proxy.mMinX, proxy.mMaxY};
+            return 4;
+        }
+        return 0;
+    };
+
+    for (const Pair& pair : mPolygonPairs) {
+        // Üçgen her zaman ilk şekil olarak ele alınır
+        const bool swap = mProxies[pair.mA].mType != ShapeType::Triangle;
+        const Proxy& a = mProxies[swap ? pair.mB : pair.mA];
+        const Proxy& b = mProxies[swap ? pair.mA : pair.mB];
+
+        Vec2 first[4];
+        Vec2 second[4];
+        const size_t firstCount = polygonOf(a, first);
+        const size_t secondCount = polygonOf(b, second);
+
+        Vec2 normal{1.0f, 0.0f};
+        float depth = 0.0f;
+        const float radius = b.mType == ShapeType::Circle ? b.mHalfWidth : 0.0f;
+        if (!SeparatingAxisTest(first, firstCount, second, secondCount, Vec2{b.mX, b.mY}, radius, normal, depth)) {
+            continue;
+        }
+
+        // Normal a'dan b'ye bakacak şekilde çevrilir
+        if ((b.mX - a.mX) * normal.mX + (b.mY - a.mY) * normal.mY < 0.0f) {
+            normal = Vec2{-normal.mX, -normal.mY};
+        }
+        AddContact(registry, a, b, normal.mX, normal.mY, depth);
+    }
+}
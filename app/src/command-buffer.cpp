@@ -0,0 +1,175 @@
+#include "command-buffer.h"
+#include "registry.h"
+
+namespace {
+
+// Her iş parçacığı ilk kayıt sırasında bir şeride atanır, şeritler iş parçacıkları arasında sırayla dağıtılır
+std::atomic<uint32_t> sNextLane{0};
+thread_local uint32_t tLane = sNextLane.fetch_add(1, std::memory_order_relaxed);
+
+} // namespace
+
+void* CommandBuffer::Arena::Allocate(size_t size, size_t alignment) {
+    for (;;) {
+        while (mBlockIndex < mBlocks.size()) {
+            Block& block = mBlocks[mBlockIndex];
+            const auto base = reinterpret_cast<uintptr_t>(block.mMemory.get());
+            const uintptr_t aligned = (base + mOffset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+            if (aligned + size <= base + block.mSize) {
+                mOffset = aligned + size - base;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            mBlockIndex++;
+            mOffset = 0;
+        }
+
+        // Mevcut bloklar doldu; büyük veriler için blok boyutu veriye göre büyütülür
+        const size_t blockSize = std::max(kBlockSize, size + alignment);
+        mBlocks.push_back(Block{std::unique_ptr<std::byte[]>(new std::byte[blockSize]), blockSize});
+        mBlockIndex = mBlocks.size() - 1;
+        mOffset = 0;
+    }
+}
+
+void CommandBuffer::Arena::Reset() {
+    mBlockIndex = 0;
+    mOffset = 0;
+}
+
+CommandBuffer::~CommandBuffer() {
+    Clear();
+}
+
+CommandBuffer::Lane& CommandBuffer::CurrentLane() {
+    return mLanes[tLane % kLaneCount];
+}
+
+Entity CommandBuffer::Spawn() {
+    Entity entity{mNextDeferred.fetch_add(1, std::memory_order_relaxed), kDeferredGeneration};
+    Record<void>(CommandType::Spawn, 0, entity, nullptr, 0.0f, 0.0f);
+    return entity;
+}
+
+Entity CommandBuffer::Spawn(const Prefab& prefab, float x, float y) {
+    Entity entity{mNextDeferred.fetch_add(1, std::memory_order_relaxed), kDeferredGeneration};
+    Record<Prefab>(CommandType::Spawn, 0, entity, nullptr, x, y, prefab);
+    return entity;
+}
+
+void CommandBuffer::Destroy(Entity entity) {
+    Record<void>(CommandType::Destroy, 0, entity, nullptr, 0.0f, 0.0f);
+}
+
+void CommandBuffer::Apply(Registry& registry) {
+    mMerged.clear();
+    for (auto& lane : mLanes) {
+        std::lock_guard<std::mutex> lock(lane.mMutex);
+        mMerged.insert(mMerged.end(), lane.mCommands.begin(), lane.mCommands.end());
+    }
+
+    if (mMerged.empty()) {
+        return;
+    }
+
+    // 1. Nesneler kayıt sırasıyla oluşturulur, böylece indeks ataması iş parçacığı sayısından bağımsız olur
+    auto spawnsEnd = std::partition(mMerged.begin(), mMerged.end(), [](const Command& command) {
+        return command.mType == CommandType::Spawn;
+    });
+    std::sort(mMerged.begin(), spawnsEnd, [](const Command& first, const Command& second) {
+        return first.mSequence < second.mSequence;
+    });
+
+    mSpawned.assign(mNextDeferred.load(std::memory_order_relaxed), Entity{});
+    registry.Reserve(registry.Size() + static_cast<size_t>(spawnsEnd - mMerged.begin()));
+    for (auto it = mMerged.begin(); it != spawnsEnd; ++it) {
+        Entity entity = it->mPayload
+            ? GraphicalObjectFactory::Spawn(registry, *static_cast<const Prefab*>(it->mPayload), it->mX, it->mY)
+            : registry.Create();
+        mSpawned[it->mEntity.mIndex] = entity;
+    }
+
+    // 2. Geçici tutamaçlar gerçek tutamaçlarla değiştirilir ve komutlar aşama, bileşen türü ve nesne numarasına göre
+    //    gruplanır. Ekleme ve silme aynı aşamadadır; aynı nesne ve tür için kayıt sırasıyla uygulanırlar
+    for (auto it = spawnsEnd; it != mMerged.end(); ++it) {
+        if (IsDeferred(it->mEntity)) {
+            it->mEntity = it->mEntity.mIndex < mSpawned.size() ? mSpawned[it->mEntity.mIndex] : Entity{};
+        }
+    }
+
+    std::sort(spawnsEnd, mMerged.end(), [](const Command& first, const Command& second) {
+        const bool firstDestroys = first.mType == CommandType::Destroy;
+        const bool secondDestroys = second.mType == CommandType::Destroy;
+        if (firstDestroys != secondDestroys) {
+            return secondDestroys;
+        }
+        if (first.mComponent != second.mComponent) {
+            return first.mComponent < second.mComponent;
+        }
+        if (first.mEntity.mIndex != second.mEntity.mIndex) {
+            return first.mEntity.mIndex < second.mEntity.mIndex;
+        }
+        return first.mSequence < second.mSequence;
+    });
+
+    // 3. Bileşenler tür tür eklenir ve silinir, eklenen bileşenlerin bağları nesne başına yalnızca bir kez çözülür
+    ComponentStore& store = registry.Store();
+    auto it = spawnsEnd;
+    mTouched.clear();
+    for (; it != mMerged.end() && it->mType != CommandType::Destroy; ++it) {
+        GraphicalObject* object = registry.Get(it->mEntity);
+        if (!object) {
+            continue;
+        }
+
+        if (it->mType == CommandType::AddComponent) {
+            it->mAdd(store, it->mEntity.mIndex, object, it->mPayload);
+            mTouched.push_back(it->mEntity.mIndex);
+        } else {
+            store.Remove(it->mEntity.mIndex, it->mComponent);
+        }
+    }
+
+    std::sort(mTouched.begin(), mTouched.end());
+    mTouched.erase(std::unique(mTouched.begin(), mTouched.end()), mTouched.end());
+    for (ObjectId id : mTouched) {
+        store.ResolveObject(id);
+    }
+
+    // 4. Nesne silme
+    for (; it != mMerged.end(); ++it) {
+        registry.Destroy(it->mEntity);
+    }
+
+    Clear();
+}
+
+void CommandBuffer::ReleasePayloads() {
+    for (auto& lane : mLanes) {
+        std::lock_guard<std::mutex> lock(lane.mMutex);
+        for (const Command& command : lane.mCommands) {
+            if (command.mDestroy) {
+                command.mDestroy(command.mPayload);
+            }
+        }
+        lane.mCommands.clear();
+        lane.mArena.Reset();
+    }
+}
+
+void CommandBuffer::Clear() {
+    ReleasePayloads();
+    mMerged.clear();
+    mNextSequence.store(0, std::memory_order_relaxed);
+    mNextDeferred.store(0, std::memory_order_relaxed);
+}
+
+size_t CommandBuffer::Size() const {
+    size_t size = 0;
+    for (const auto& lane : mLanes) {
+        std::lock_guard<std::mutex> lock(lane.mMutex);
+        size += lane.mCommands.size();
+    }
+    return size;
+}
@@ -0,0 +1,69 @@
+#include "component-store.h"
+
+#include <atomic>
+#include <stdexcept>
+
+ComponentTypeId NextComponentTypeId() {
+    static std::atomic<ComponentTypeId> sNextId{0};
+    ComponentTypeId id = sNextId.fetch_add(1);
+    if (id >= kMaxComponentTypes) {
+        throw std::runtime_error("Too many component types");
+    }
+    return id;
+}
+
+ChangeList::~ChangeList() {
+    if (mPool) {
+        mPool->Untrack(*this);
+    }
+}
+
+ObjectId ComponentStore::CreateObject() {
+    if (!mFreeIds.empty()) {
+        ObjectId id = mFreeIds.back();
+        mFreeIds.pop_back();
+        return id;
+    }
+
+    mMasks.push_back(0);
+    return mNextId++;
+}
+
+void ComponentStore::DestroyObject(ObjectId id) {
+    // Her havuzda en fazla bir bileşen taşınır, taşınan bileşenlerin sahipleri silme bitince yeniden bağlanır
+    std::array<ObjectId, kMaxComponentTypes> movedIds;
+    size_t movedCount = 0;
+
+    for (ComponentMask mask = GetMask(id); mask != 0; mask &= mask - 1) {
+        ObjectId movedId = mPools[std::countr_zero(mask)]->Remove(id);
+        if (movedId != kInvalidObjectId) {
+            movedIds[movedCount++] = movedId;
+        }
+    }
+
+    UpdateMatches(id, mMasks[id], 0);
+    mMasks[id] = 0;
+    mFreeIds.push_back(id);
+
+    for (size_t i = 0; i < movedCount; i++) {
+        ResolveObject(movedIds[i]);
+    }
+}
+
+const MatchList& ComponentStore::Match(ComponentMask mask, ComponentMask exclude) {
+    std::lock_guard<std::mutex> lock(mMatchMutex);
+    for (const auto& list : mMatchLists) {
+        if (list->Mask() == mask && list->Exclude() == exclude) {
+            return *list;
+        }
+    }
+
+    // Liste ilk kez isteniyor, mevcut nesneler bir kez taranır
+    auto& list = mMatchLists.emplace_back(std::make_unique<MatchList>(mask, exclude));
+    for (ObjectId id = 0; id < static_cast<ObjectId>(mMasks.size()); id++) {
+        if (mMasks[id] != 0 && list->Matches(mMasks[id])) {
+            list->Insert(id);
+        }
+    }
+    return *list;
+}
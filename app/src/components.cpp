@@ -2,20 +2,36 @@
 #include "render-strategies.h"
 #include "graphical-object-factory.h"
 
-RenderComponent::RenderComponent(std::unique_ptr<RenderStrategy> strategy) 
+RenderComponent::RenderComponent(std::shared_ptr<RenderStrategy> strategy) 
     : mStrategy(std::move(strategy)) {
         
     }
 
-void RenderComponent::SetStrategy(std::unique_ptr<RenderStrategy> strategy) {
+void Transform::Teleport() {
+    SnapshotPrevious();
+    mTeleported = true;
+    if (mOwner) {
+        mOwner->MarkChanged<Transform>();
+    }
+}
+
+void RenderComponent::SetStrategy(std::shared_ptr<RenderStrategy> strategy) {
     mStrategy = std::move(strategy);
+
+    // Şekil değiştiğinden sınır kutusu hesaplayanlar (ör. ViewportCuller) nesneyi yeniden ele almalıdır
+    if (mOwner) {
+        mOwner->MarkChanged<RenderComponent>();
+    }
 }
 
 void RenderComponent::Render(Renderer& renderer) {
-    if (mStrategy && mOwner) {
-        auto* transform = mOwner->GetComponent<Transform>();
-
-        if (transform)
-            mStrategy->Render(renderer.GetSDLRenderer(), *transform);
+    if (mStrategy && mTransform) {
+        mStrategy->Submit(renderer, mTransform->Interpolated(renderer.GetInterpolationAlpha()));
     }
+}
+
+void RenderComponent::Resolve() {
+    // Sahne ağacındaki çocuk nesneler dünya dönüşümleriyle çizilir
+    Transform* world = mOwner ? mOwner->GetComponent<WorldTransform>() : nullptr;
+    mTransform = world ? world : (mOwner ? mOwner->GetComponent<Transform>() : nullptr);
 }
\ No newline at end of file
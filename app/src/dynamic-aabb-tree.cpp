@@ -0,0 +1,227 @@
+#include "dynamic-aabb-tree.h"
+
+DynamicAabbTree::DynamicAabbTree(float margin)
+    : mMargin(margin) {
+}
+
+int32_t DynamicAabbTree::AllocateNode() {
+    if (mFreeList == kNullNode) {
+        mNodes.emplace_back();
+        mNodes.back().mHeight = 0;
+        return static_cast<int32_t>(mNodes.size() - 1);
+    }
+
+    const int32_t node = mFreeList;
+    mFreeList = mNodes[node].mParent;
+    mNodes[node] = Node{};
+    mNodes[node].mHeight = 0;
+    return node;
+}
+
+void DynamicAabbTree::FreeNode(int32_t node) {
+    mNodes[node].mParent = mFreeList;
+    mNodes[node].mHeight = -1;
+    mFreeList = node;
+}
+
+int32_t DynamicAabbTree::CreateProxy(const Aabb& box, uint32_t userData) {
+    const int32_t proxy = AllocateNode();
+    mNodes[proxy].mBox = box.Expanded(mMargin);
+    mNodes[proxy].mUserData = userData;
+    InsertLeaf(proxy);
+    mProxyCount++;
+    return proxy;
+}
+
+void DynamicAabbTree::DestroyProxy(int32_t proxy) {
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    mProxyCount--;
+}
+
+bool DynamicAabbTree::MoveProxy(int32_t proxy, const Aabb& box) {
+    const Aabb& fat = mNodes[proxy].mBox;
+
+    // Nesne küçülmediyse ve genişletilmiş kutusunda kalıyorsa ağaç değişmez
+    if (fat.Contains(box) && box.Expanded(4.0f * mMargin).Contains(fat)) {
+        return false;
+    }
+
+    RemoveLeaf(proxy);
+    mNodes[proxy].mBox = box.Expanded(mMargin);
+    InsertLeaf(proxy);
+    return true;
+}
+
+void DynamicAabbTree::ReplaceChild(int32_t parent, int32_t oldChild, int32_t newChild) {
+    if (parent == kNullNode) {
+        mRoot = newChild;
+    } else if (mNodes[parent].mChild1 == oldChild) {
+        mNodes[parent].mChild1 = newChild;
+    } else {
+        mNodes[parent].mChild2 = newChild;
+    }
+}
+
+void DynamicAabbTree::InsertLeaf(int32_t leaf) {
+    if (mRoot == kNullNode) {
+        mRoot = leaf;
+        mNodes[leaf].mParent = kNullNode;
+        return;
+    }
+
+    // Çevre uzunluğu artışı en az olan kardeş aranır
+    const Aabb leafBox = mNodes[leaf].mBox;
+    int32_t index = mRoot;
+    while (!mNodes[index].IsLeaf()) {
+        const Node& node = mNodes[index];
+        const float area = node.mBox.Perimeter();
+        const float combined = Aabb::Union(node.mBox, leafBox).Perimeter();
+
+        // Burada yeni bir ebeveyn oluşturmanın maliyeti ve yaprağı aşağı indirmenin atalara getirdiği ek maliyet
+        const float cost = 2.0f * combined;
+        const float inheritance = 2.0f * (combined - area);
+
+        auto descendCost = [&](int32_t child) {
+            const Node& childNode = mNodes[child];
+            const float enlarged = Aabb::Union(childNode.mBox, leafBox).Perimeter();
+            return (childNode.IsLeaf() ? enlarged : enlarged - childNode.mBox.Perimeter()) + inheritance;
+        };
+        const float cost1 = descendCost(node.mChild1);
+        const float cost2 = descendCost(node.mChild2);
+
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        index = cost1 < cost2 ? node.mChild1 : node.mChild2;
+    }
+
+    const int32_t sibling = index;
+    const int32_t oldParent = mNodes[sibling].mParent;
+    const int32_t newParent = AllocateNode();
+    mNodes[newParent].mParent = oldParent;
+    mNodes[newParent].mBox = Aabb::Union(leafBox, mNodes[sibling].mBox);
+    mNodes[newParent].mHeight = mNodes[sibling].mHeight + 1;
+    mNodes[newParent].mChild1 = sibling;
+    mNodes[newParent].mChild2 = leaf;
+    ReplaceChild(oldParent, sibling, newParent);
+    mNodes[sibling].mParent = newParent;
+    mNodes[leaf].mParent = newParent;
+
+    // Yapraktan köke doğru kutular ve yükseklikler düzeltilir, gerekirse dönme yapılır
+    for (index = mNodes[leaf].mParent; index != kNullNode; index = mNodes[index].mParent) {
+        index = Balance(index);
+        Node& node = mNodes[index];
+        node.mHeight = 1 + std::max(mNodes[node.mChild1].mHeight, mNodes[node.mChild2].mHeight);
+        node.mBox = Aabb::Union(mNodes[node.mChild1].mBox, mNodes[node.mChild2].mBox);
+    }
+}
+
+void DynamicAabbTree::RemoveLeaf(int32_t leaf) {
+    if (leaf == mRoot) {
+        mRoot = kNullNode;
+        return;
+    }
+
+    const int32_t parent = mNodes[leaf].mParent;
+    const int32_t grandParent = mNodes[parent].mParent;
+    const int32_t sibling = mNodes[parent].mChild1 == leaf ? mNodes[parent].mChild2 : mNodes[parent].mChild1;
+
+    ReplaceChild(grandParent, parent, sibling);
+    mNodes[sibling].mParent = grandParent;
+    FreeNode(parent);
+
+    for (int32_t index = grandParent; index != kNullNode; index = mNodes[index].mParent) {
+        index = Balance(index);
+        Node& node = mNodes[index];
+        node.mHeight = 1 + std::max(mNodes[node.mChild1].mHeight, mNodes[node.mChild2].mHeight);
+        node.mBox = Aabb::Union(mNodes[node.mChild1].mBox, mNodes[node.mChild2].mBox);
+    }
+}
+
+int32_t DynamicAabbTree::Balance(int32_t indexA) {
+    Node& a = mNodes[indexA];
+    if (a.IsLeaf() || a.mHeight < 2) {
+        return indexA;
+    }
+
+    const int32_t indexB = a.mChild1;
+    const int32_t indexC = a.mChild2;
+    const int32_t balance = mNodes[indexC].mHeight - mNodes[indexB].mHeight;
+
+    // Yüksek olan çocuk bir seviye yukarı döndürülür; uzun torunu yanında kalır, kısa olanı a'ya geçer
+    auto rotateUp = [&](int32_t indexUp, int32_t indexOther, bool upIsSecond) {
+        Node& up = mNodes[indexUp];
+        const int32_t indexF = up.mChild1;
+        const int32_t indexG = up.mChild2;
+
+        up.mChild1 = indexA;
+        up.mParent = a.mParent;
+        a.mParent = indexUp;
+        ReplaceChild(up.mParent, indexA, indexUp);
+
+        const bool keepF = mNodes[indexF].mHeight > mNodes[indexG].mHeight;
+        const int32_t kept = keepF ? indexF : indexG;
+        const int32_t moved = keepF ? indexG : indexF;
+        up.mChild2 = kept;
+        if (upIsSecond) {
+            a.mChild2 = moved;
+        } else {
+            a.mChild1 = moved;
+        }
+        mNodes[moved].mParent = indexA;
+
+        a.mBox = Aabb::Union(mNodes[indexOther].mBox, mNodes[moved].mBox);
+        a.mHeight = 1 + std::max(mNodes[indexOther].mHeight, mNodes[moved].mHeight);
+        up.mBox = Aabb::Union(a.mBox, mNodes[kept].mBox);
+        up.mHeight = 1 + std::max(a.mHeight, mNodes[kept].mHeight);
+        return indexUp;
+    };
+
+    if (balance > 1) {
+        return rotateUp(indexC, indexB, true);
+    }
+    if (balance < -1) {
+        return rotateUp(indexB, indexC, false);
+    }
+    return indexA;
+}
+
+bool DynamicAabbTree::Validate() const {
+    if (mRoot == kNullNode) {
+        return mProxyCount == 0;
+    }
+    if (mNodes[mRoot].mParent != kNullNode) {
+        return false;
+    }
+
+    size_t leaves = 0;
+    std::vector<int32_t> stack{mRoot};
+    while (!stack.empty()) {
+        const int32_t index = stack.back();
+        stack.pop_back();
+        const Node& node = mNodes[index];
+        if (node.IsLeaf()) {
+            if (node.mHeight != 0) {
+                return false;
+            }
+            leaves++;
+            continue;
+        }
+
+        const Node& first = mNodes[node.mChild1];
+        const Node& second = mNodes[node.mChild2];
+        if (first.mParent != index || second.mParent != index) {
+            return false;
+        }
+        if (node.mHeight != 1 + std::max(first.mHeight, second.mHeight)) {
+            return false;
+        }
+        if (!node.mBox.Contains(first.mBox) || !node.mBox.Contains(second.mBox)) {
+            return false;
+        }
+        stack.push_back(node.mChild1);
+        stack.push_back(node.mChild2);
+    }
+    return leaves == mProxyCount;
+}
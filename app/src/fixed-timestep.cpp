@@ -0,0 +1,34 @@
+#include "fixed-timestep.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+FixedTimestep::FixedTimestep(double ticksPerSecond, uint32_t maxStepsPerFrame)
+    : mStepSeconds(0.0), mMaxStepsPerFrame(maxStepsPerFrame) {
+    SetTickRate(ticksPerSecond);
+}
+
+void FixedTimestep::SetTickRate(double ticksPerSecond) {
+    if (ticksPerSecond <= 0.0) {
+        throw std::runtime_error("Tick rate must be positive");
+    }
+    mStepSeconds = 1.0 / ticksPerSecond;
+}
+
+uint32_t FixedTimestep::Advance(double frameSeconds) {
+    mAccumulator += std::max(frameSeconds, 0.0);
+
+    uint32_t steps = 0;
+    while (mAccumulator >= mStepSeconds && steps < mMaxStepsPerFrame) {
+        mAccumulator -= mStepSeconds;
+        steps++;
+    }
+
+    // Yetişilemeyen süre atılır; simülasyon bu karede son adımın olduğu yerden devam eder
+    if (mAccumulator >= mStepSeconds) {
+        mAccumulator = 0.0;
+    }
+
+    mTickCount += steps;
+    return steps;
+}
@@ -0,0 +1,76 @@
+#include "geometry-batch.h"
+
+SDL_Vertex* GeometryBatch::AppendVertices(size_t count) {
+    const size_t first = mVertices.size();
+    mVertices.resize(first + count);
+    return mVertices.data() + first;
+}
+
+int* GeometryBatch::AppendIndices(size_t count, SDL_Texture* texture) {
+    // Doku değişmedikçe aynı parçaya eklenir
+    if (mSegments.empty() || mSegments.back().mTexture != texture) {
+        mSegments.push_back(Segment{texture, mIndices.size(), 0});
+    }
+    mSegments.back().mIndexCount += count;
+
+    const size_t first = mIndices.size();
+    mIndices.resize(first + count);
+    return mIndices.data() + first;
+}
+
+void GeometryBatch::AddRect(const SDL_FRect& rect, SDL_FColor color) {
+    AddQuad(rect, color, nullptr);
+}
+
+void GeometryBatch::AddTexturedRect(const SDL_FRect& rect, SDL_Texture* texture, SDL_FColor tint) {
+    AddQuad(rect, tint, texture);
+}
+
+void GeometryBatch::AddQuad(const SDL_FRect& rect, SDL_FColor color, SDL_Texture* texture) {
+    const auto base = static_cast<int>(mVertices.size());
+    SDL_Vertex* vertices = AppendVertices(4);
+    vertices[0] = SDL_Vertex{{rect.x, rect.y}, color, {0.0f, 0.0f}};
+    vertices[1] = SDL_Vertex{{rect.x + rect.w, rect.y}, color, {1.0f, 0.0f}};
+    vertices[2] = SDL_Vertex{{rect.x + rect.w, rect.y + rect.h}, color, {1.0f, 1.0f}};
+    vertices[3] = SDL_Vertex{{rect.x, rect.y + rect.h}, color, {0.0f, 1.0f}};
+
+    int* indices = AppendIndices(6, texture);
+    indices[0] = base;
+    indices[1] = base + 1;
+    indices[2] = base + 2;
+    indices[3] = base;
+    indices[4] = base + 2;
+    indices[5] = base + 3;
+}
+
+void GeometryBatch::AddTriangle(SDL_FPoint first, SDL_FPoint second, SDL_FPoint third, SDL_FColor color) {
+    const auto base = static_cast<int>(mVertices.size());
+    SDL_Vertex* vertices = AppendVertices(3);
+    vertices[0] = SDL_Vertex{first, color, {0.0f, 0.0f}};
+    vertices[1] = SDL_Vertex{second, color, {0.0f, 0.0f}};
+    vertices[2] = SDL_Vertex{third, color, {0.0f, 0.0f}};
+
+    int* indices = AppendIndices(3);
+    indices[0] = base;
+    indices[1] = base + 1;
+    indices[2] = base + 2;
+}
+
+size_t GeometryBatch::Flush(SDL_Renderer* renderer) {
+    const size_t drawCalls = mSegments.size();
+
+    // İndeksler tüm akıştaki köşe numaraları olduğundan her çağrıya köşe dizisinin tamamı verilir
+    for (const Segment& segment : mSegments) {
+        SDL_RenderGeometry(renderer, segment.mTexture, mVertices.data(), static_cast<int>(mVertices.size()),
+                           mIndices.data() + segment.mFirstIndex, static_cast<int>(segment.mIndexCount));
+    }
+
+    Clear();
+    return drawCalls;
+}
+
+void GeometryBatch::Clear() {
+    mVertices.clear();
+    mIndices.clear();
+    mSegments.clear();
+}
@@ -1,50 +1,115 @@
+#include <stdexcept>
+
 #include "graphical-object-factory.h"
 #include "render-strategies.h"
+#include "registry.h"
+
+GraphicalObject::GraphicalObject(ComponentStore& store, Entity entity)
+    : mStore(&store), mEntity(entity) {
+}
 
 void GraphicalObject::Update(float deltaTime) {
-    for (auto& component : mComponents) {
-        component->Update(deltaTime);
-    }
+    mStore->ForEachComponent(mEntity.mIndex, [deltaTime](Component& component) {
+        component.Update(deltaTime);
+    });
 }
 
 void GraphicalObject::Render(Renderer& renderer) {
-    for (auto& component : mComponents) {
-        component->Render(renderer);
-    }
+    mStore->ForEachComponent(mEntity.mIndex, [&renderer](Component& component) {
+        component.Render(renderer);
+    });
+}
+
+Entity GraphicalObjectFactory::CreateRectangle(Registry& registry, float x, float y) {
+    return Spawn(registry, RectanglePrefab(), x, y);
+}
+
+Entity GraphicalObjectFactory::CreateCircle(Registry& registry, float x, float y) {
+    return Spawn(registry, CirclePrefab(), x, y);
+}
+
+Entity GraphicalObjectFactory::CreateTriangle(Registry& registry, float x, float y) {
+    return Spawn(registry, TrianglePrefab(), x, y);
+}
+
+// Stratejiler new ile oluşturulur; make_shared kendi bloğunu ayırıp PooledObject havuzunu atlar
+const Prefab& GraphicalObjectFactory::RectanglePrefab() {
+    static const Prefab sPrefab{
+        Velocity(0.0f, 0.0f),
+        std::shared_ptr<RenderStrategy>(new RectangleRenderer(SDL_Color{0, 255, 0, 255}, 50, 50))
+    };
+    return sPrefab;
+}
+
+const Prefab& GraphicalObjectFactory::CirclePrefab() {
+    static const Prefab sPrefab{
+        Velocity(100.0f, 50.0f),
+        std::shared_ptr<RenderStrategy>(new CircleRenderer(SDL_Color{255, 0, 0, 255}, 25))
+    };
+    return sPrefab;
+}
+
+const Prefab& GraphicalObjectFactory::TrianglePrefab() {
+    static const Prefab sPrefab{
+        Velocity(-80.0f, 120.0f),
+        std::shared_ptr<RenderStrategy>(new TriangleRenderer(SDL_FColor{1.0f, 0, 1.0f, 1.0f}, 90.0f))
+    };
+    return sPrefab;
 }
 
-std::unique_ptr<GraphicalObject> GraphicalObjectFactory::CreateRectangle(float x, float y) {
-    auto rectangleObj = std::make_unique<GraphicalObject>();
-    rectangleObj->AddComponent<Transform>(x, y);
-    rectangleObj->AddComponent<Velocity>(0.0f, 0.0f);
-    
-    auto renderStrategy = std::make_unique<RectangleRenderer>(
-        SDL_Color{0, 255, 0, 255}, 50, 50);
-    rectangleObj->AddComponent<RenderComponent>(std::move(renderStrategy));
-    
-    return rectangleObj;
-}
-
-std::unique_ptr<GraphicalObject> GraphicalObjectFactory::CreateCircle(float x, float y) {
-    auto circleObj = std::make_unique<GraphicalObject>();
-    circleObj->AddComponent<Transform>(x, y);
-    circleObj->AddComponent<Velocity>(100.0f, 50.0f);
-    
-    auto renderStrategy = std::make_unique<CircleRenderer>(
-        SDL_Color{255, 0, 0, 255}, 25);
-    circleObj->AddComponent<RenderComponent>(std::move(renderStrategy));
-    
-    return circleObj;
-}
-
-std::unique_ptr<GraphicalObject> GraphicalObjectFactory::CreateTriangle(float x, float y){
-    auto triangleObj = std::make_unique<GraphicalObject>();
-    triangleObj->AddComponent<Transform>(x, y);
-    triangleObj->AddComponent<Velocity>(-80.0f, 120.0f);
-    auto renderStrategy = std::make_unique<TriangleRenderer>(
-            SDL_FColor{1.0f, 0, 1.0f, 1.0f}, 90.0f);
-      
-    triangleObj->AddComponent<RenderComponent>(std::move(renderStrategy));
-    
-    return triangleObj;
-}
\ No newline at end of file
+Entity GraphicalObjectFactory::Spawn(Registry& registry, const Prefab& prefab, float x, float y) {
+    Entity entity = registry.Create();
+    auto* object = registry.Get(entity);
+    object->AddComponent<Transform>(x, y);
+    object->AddComponent<Velocity>(prefab.mVelocity.mVx, prefab.mVelocity.mVy);
+    object->AddComponent<RenderComponent>(prefab.mStrategy);
+
+    return entity;
+}
+
+std::vector<Entity> GraphicalObjectFactory::SpawnMany(Registry& registry, const Prefab& prefab, size_t count,
+                                                      std::span<const SDL_FPoint> positions) {
+    if (!positions.empty() && positions.size() < count) {
+        throw std::runtime_error("SpawnMany requires a position for every object");
+    }
+
+    // Tüm yer bir kerede ayrılır; nesneler önce oluşturulur, bileşenler ardından tür tür toplu olarak eklenir
+    ComponentStore& store = registry.Store();
+    registry.Reserve(registry.Size() + count);
+
+    std::vector<Entity> entities;
+    std::vector<ObjectId> ids;
+    std::vector<GraphicalObject*> objects;
+    entities.reserve(count);
+    ids.reserve(count);
+    objects.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        Entity entity = registry.Create();
+        entities.push_back(entity);
+        ids.push_back(entity.mIndex);
+        objects.push_back(registry.Get(entity));
+    }
+
+    const std::span<const ObjectId> added(ids);
+    store.AddMany<Transform>(added, [&](size_t i) {
+        const SDL_FPoint position = positions.empty() ? SDL_FPoint{0.0f, 0.0f} : positions[i];
+        Transform transform(position.x, position.y);
+        transform.mOwner = objects[i];
+        return transform;
+    });
+    store.AddMany<Velocity>(added, [&](size_t i) {
+        Velocity velocity(prefab.mVelocity.mVx, prefab.mVelocity.mVy);
+        velocity.mOwner = objects[i];
+        return velocity;
+    });
+    store.AddMany<RenderComponent>(added, [&](size_t i) {
+        RenderComponent render(prefab.mStrategy);
+        render.mOwner = objects[i];
+        return render;
+    });
+
+    // Üç bileşenden yalnızca RenderComponent başka bileşene bağlanır; bağlar tür bazında topluca çözülür
+    store.ResolvePool<RenderComponent>();
+
+    return entities;
+}
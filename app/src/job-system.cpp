@@ -0,0 +1,165 @@
+#include "job-system.h"
+
+#include <utility>
+
+namespace {
+
+// Hangi iş parçacığının hangi havuza ve kuyruğa ait olduğunu tutar
+thread_local const JobSystem* tOwner = nullptr;
+thread_local uint32_t tWorkerIndex = 0;
+
+uint32_t DefaultWorkerCount() {
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+} // namespace
+
+JobSystem::JobSystem()
+    : JobSystem(DefaultWorkerCount()) {
+}
+
+JobSystem::JobSystem(uint32_t workerCount) {
+    for (uint32_t i = 0; i <= workerCount; i++) {
+        mQueues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    for (uint32_t i = 0; i < workerCount; i++) {
+        mWorkers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mStopping.store(true);
+    }
+    mWake.notify_all();
+
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+uint32_t JobSystem::HomeQueue() const {
+    if (tOwner == this) {
+        return tWorkerIndex;
+    }
+    return static_cast<uint32_t>(mQueues.size()) - 1;
+}
+
+void JobSystem::Submit(WaitGroup& group, std::function<void()> task) {
+    group.mPending.fetch_add(1, std::memory_order_relaxed);
+
+    // Havuz içinden gönderilen işler kendi kuyruğuna, dışarıdan gelenler sırayla kuyruklara dağıtılır
+    uint32_t queueIndex = tOwner == this
+        ? tWorkerIndex
+        : mNextQueue.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(mQueues.size());
+
+    // Sayaç iş yayımlanmadan önce artırılır; aksi halde işi hemen alan bir iş parçacığı sayacı sıfırın altına indirir
+    mQueuedJobs.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(mQueues[queueIndex]->mMutex);
+        mQueues[queueIndex]->mJobs.push_back(Job{std::move(task), &group});
+    }
+
+    bool hasWaiters = false;
+    {
+        // Uyumaya hazırlanan bir iş parçacığının bildirimi kaçırmaması için
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        hasWaiters = mWaiters > 0;
+    }
+    mWake.notify_one();
+    if (hasWaiters) {
+        mFinished.notify_all();
+    }
+}
+
+void JobSystem::Wait(WaitGroup& group) {
+    const uint32_t home = HomeQueue();
+    while (!group.IsDone()) {
+        if (TryRunOne(home)) {
+            continue;
+        }
+
+        // Kalan işler başka iş parçacıklarında çalışıyor; bitmeleri ya da yardım edilecek yeni bir iş beklenir
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mWaiters++;
+        mFinished.wait(lock, [this, &group]() {
+            return group.IsDone() || mQueuedJobs.load(std::memory_order_acquire) > 0;
+        });
+        mWaiters--;
+    }
+
+    if (group.mError) {
+        std::exception_ptr error = std::exchange(group.mError, nullptr);
+        std::rethrow_exception(error);
+    }
+}
+
+bool JobSystem::TryPop(uint32_t queueIndex, bool fromBack, Job& job) {
+    auto& queue = *mQueues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mMutex);
+
+    if (queue.mJobs.empty()) {
+        return false;
+    }
+
+    if (fromBack) {
+        job = std::move(queue.mJobs.back());
+        queue.mJobs.pop_back();
+    } else {
+        job = std::move(queue.mJobs.front());
+        queue.mJobs.pop_front();
+    }
+    return true;
+}
+
+bool JobSystem::TryRunOne(uint32_t homeQueue) {
+    Job job;
+    bool found = TryPop(homeQueue, true, job);
+
+    // Kendi kuyruğu boşsa diğer kuyrukların en eski işlerini çal
+    const auto queueCount = static_cast<uint32_t>(mQueues.size());
+    for (uint32_t offset = 1; !found && offset < queueCount; offset++) {
+        found = TryPop((homeQueue + offset) % queueCount, false, job);
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    mQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+    // İstisna iş parçacığının dışına taşarsa std::terminate çağrılır; bunun yerine Wait'e iletilir
+    try {
+        job.mTask();
+    } catch (...) {
+        job.mGroup->Fail(std::current_exception());
+    }
+
+    // Grup bu işten sonra yok edilebileceğinden son azaltmadan sonra gruba dokunulmaz
+    if (job.mGroup->mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        if (mWaiters > 0) {
+            mFinished.notify_all();
+        }
+    }
+    return true;
+}
+
+void JobSystem::WorkerLoop(uint32_t workerIndex) {
+    tOwner = this;
+    tWorkerIndex = workerIndex;
+
+    while (!mStopping.load()) {
+        if (TryRunOne(workerIndex)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mWake.wait(lock, [this]() {
+            return mStopping.load() || mQueuedJobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
@@ -1,14 +1,27 @@
 #include "sdl-application.h"
 
+#include <cstring>
+
 int main(int argc, char* argv[]) {
     Sdl3Application application;
     
-    if (!application.Initialize()) {
+    // --threaded ile simülasyon ayrı iş parçacığında çalışır; diğer argüman sahne dosyası olarak yüklenir
+    std::string scenePath;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--threaded") == 0) {
+            application.SetThreadedSimulation(true);
+        } else {
+            scenePath = argv[i];
+        }
+    }
+
+    if (!application.Initialize(scenePath)) {
         return -1;
     }
     
     std::cout << "Cikis icin Q tusuna basiniz!\n";
     std::cout << "WASD tuslari ile yesil dikdortgen hareket ettirilebilir!\n";
+    std::cout << "Backspace tusu simulasyonu bir saniye geri sarar!\n";
     std::cout << "Bu tuslar disindaki tuslar hareketi sonlandirir!\n";
     
     application.Run();
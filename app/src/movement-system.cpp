@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <cmath>
+
+#include "movement-system.h"
+#include "physics-system.h"
+#include "registry.h"
+#include "view.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MOVEMENT_SYSTEM_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(MOVEMENT_SYSTEM_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MOVEMENT_SYSTEM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MOVEMENT_SYSTEM_TARGET_AVX2
+#endif
+
+namespace {
+
+constexpr float kWrapEpsilon = 1.0f;
+
+inline float WrapScalar(float value, float limit) {
+    value = value < 0.0f ? limit : value;
+    return value > limit ? 0.0f : value;
+}
+
+void IntegrateScalar(float* x, float* y, const float* vx, const float* vy, size_t begin, size_t count,
+                     float deltaTime, float width, float height) {
+    for (size_t i = begin; i < count; i++) {
+        x[i] = WrapScalar(x[i] + vx[i] * deltaTime, width);
+        y[i] = WrapScalar(y[i] + vy[i] * deltaTime, height);
+    }
+}
+
+#if defined(MOVEMENT_SYSTEM_X86)
+
+inline __m128 WrapSse2(__m128 value, __m128 limit, __m128 zero) {
+    // value < 0 ise limit, value > limit ise 0
+    __m128 below = _mm_cmplt_ps(value, zero);
+    value = _mm_or_ps(_mm_and_ps(below, limit), _mm_andnot_ps(below, value));
+    __m128 above = _mm_cmpgt_ps(value, limit);
+    return _mm_andnot_ps(above, value);
+}
+
+void IntegrateSse2(float* x, float* y, const float* vx, const float* vy, size_t count,
+                   float deltaTime, float width, float height) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 w = _mm_set1_ps(width);
+    const __m128 h = _mm_set1_ps(height);
+    const __m128 zero = _mm_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt));
+        __m128 py = _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt));
+        _mm_storeu_ps(x + i, WrapSse2(px, w, zero));
+        _mm_storeu_ps(y + i, WrapSse2(py, h, zero));
+    }
+
+    IntegrateScalar(x, y, vx, vy, i, count, deltaTime, width, height);
+}
+
+MOVEMENT_SYSTEM_TARGET_AVX2
+inline __m256 WrapAvx2(__m256 value, __m256 limit, __m256 zero) {
+    value = _mm256_blendv_ps(value, limit, _mm256_cmp_ps(value, zero, _CMP_LT_OQ));
+    return _mm256_blendv_ps(value, zero, _mm256_cmp_ps(value, limit, _CMP_GT_OQ));
+}
+
+MOVEMENT_SYSTEM_TARGET_AVX2
+void IntegrateAvx2(float* x, float* y, const float* vx, const float* vy, size_t count,
+                   float deltaTime, float width, float height) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 w = _mm256_set1_ps(width);
+    const __m256 h = _mm256_set1_ps(height);
+    const __m256 zero = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(_mm256_loadu_ps(vx + i), dt));
+        __m256 py = _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(_mm256_loadu_ps(vy + i), dt));
+        _mm256_storeu_ps(x + i, WrapAvx2(px, w, zero));
+        _mm256_storeu_ps(y + i, WrapAvx2(py, h, zero));
+    }
+
+    IntegrateScalar(x, y, vx, vy, i, count, deltaTime, width, height);
+}
+
+#endif
+
+} // namespace
+
+MovementSystem::MovementSystem(float width, float height)
+    : mWidth(width), mHeight(height) {
+}
+
+void MovementSystem::Update(ComponentStore& store, float deltaTime, JobSystem* jobs) {
+    // Kuvvetle hareket eden nesnelerin konumlarını PhysicsSystem günceller
+    const View<Transform, Velocity> view(store, ComponentMaskOf<RigidBody>());
+
+    const size_t count = view.Size();
+
+    // Transform havuzunu izleyen yoksa bildirim tamamen atlanır
+    ComponentPool<Transform>* transforms = store.FindPool<Transform>();
+    ComponentPool<Transform>* tracked = transforms && transforms->IsTracked() ? transforms : nullptr;
+
+    // Her parça kendi aralığını blok blok toplar, işler ve geri yazar; parçalar birbirinin verisine dokunmaz
+    auto process = [&](size_t begin, size_t end) {
+        alignas(32) float x[kBlockSize];
+        alignas(32) float y[kBlockSize];
+        alignas(32) float vx[kBlockSize];
+        alignas(32) float vy[kBlockSize];
+        Transform* targets[kBlockSize];
+        ObjectId ids[kBlockSize];
+
+        for (size_t blockBegin = begin; blockBegin < end; blockBegin += kBlockSize) {
+            const size_t blockEnd = std::min(blockBegin + kBlockSize, end);
+            size_t i = 0;
+            view.ForEach(blockBegin, blockEnd, [&](ObjectId id, Transform& transform, Velocity& velocity) {
+                targets[i] = &transform;
+                ids[i] = id;
+                x[i] = transform.mX;
+                y[i] = transform.mY;
+                vx[i] = velocity.mVx;
+                vy[i] = velocity.mVy;
+                i++;
+            });
+
+            Integrate(x, y, vx, vy, i, deltaTime, mWidth, mHeight);
+
+            for (size_t j = 0; j < i; j++) {
+                Transform& transform = *targets[j];
+                const float expectedX = transform.mX + vx[j] * deltaTime;
+                const float expectedY = transform.mY + vy[j] * deltaTime;
+
+                // Hızı sıfır olan ve sarılmayan nesnelerin konumu değişmez; bunlar izleyenlere bildirilmez
+                if (tracked && (x[j] != transform.mX || y[j] != transform.mY)) {
+                    tracked->MarkChanged(ids[j]);
+                }
+                transform.mX = x[j];
+                transform.mY = y[j];
+
+                // Kenardan sarılan nesnenin çizimde ekran boyunca kaymaması için ara değer iptal edilir
+                if (std::fabs(x[j] - expectedX) > kWrapEpsilon || std::fabs(y[j] - expectedY) > kWrapEpsilon) {
+                    transform.Teleport();
+                }
+            }
+        }
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(count, kGrainSize, process);
+    } else {
+        process(0, count);
+    }
+}
+
+ComponentMask MovementSystem::Reads() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<Velocity>();
+}
+
+ComponentMask MovementSystem::Writes() const {
+    return ComponentMaskOf<Transform>();
+}
+
+void MovementSystem::Run(Registry& registry, JobSystem& jobs, float deltaTime) {
+    Update(registry.Store(), deltaTime, &jobs);
+}
+
+void MovementSystem::Integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+                               float deltaTime, float width, float height) {
+    static const SimdLevel sLevel = DetectSimdLevel();
+    Integrate(sLevel, x, y, vx, vy, count, deltaTime, width, height);
+}
+
+void MovementSystem::Integrate(SimdLevel level, float* x, float* y, const float* vx, const float* vy, size_t count,
+                               float deltaTime, float width, float height) {
+#if defined(MOVEMENT_SYSTEM_X86)
+    switch (level) {
+        case SimdLevel::Avx2:
+            IntegrateAvx2(x, y, vx, vy, count, deltaTime, width, height);
+            return;
+
+        case SimdLevel::Sse2:
+            IntegrateSse2(x, y, vx, vy, count, deltaTime, width, height);
+            return;
+
+        case SimdLevel::Scalar:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    IntegrateScalar(x, y, vx, vy, 0, count, deltaTime, width, height);
+}
+
+SimdLevel MovementSystem::DetectSimdLevel() {
+#if defined(MOVEMENT_SYSTEM_X86)
+#if defined(_MSC_VER)
+    // AVX2 biti tek başına yetmez: işletim sistemi YMM yazmaçlarını bağlam değişiminde saklamıyorsa (OSXSAVE ve
+    // XCR0'daki XMM/YMM bitleri) AVX komutları geçersiz komut hatası verir
+    int info[4] = {};
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    __cpuid(info, 1);
+    const bool hasOsXsave = (info[2] & (1 << 27)) != 0;
+    const bool hasAvx = (info[2] & (1 << 28)) != 0;
+
+    bool hasAvx2 = false;
+    if (maxLeaf >= 7 && hasOsXsave && hasAvx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        hasAvx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    // libgcc ve compiler-rt AVX özelliklerini yalnızca işletim sistemi YMM durumunu etkinleştirmişse bildirir
+    bool hasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+    return hasAvx2 ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <cmath>
+
+#include "graphical-object-factory.h"
+#include "particle-system.h"
+#include "registry.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PARTICLE_SYSTEM_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(PARTICLE_SYSTEM_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PARTICLE_SYSTEM_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PARTICLE_SYSTEM_TARGET_AVX2
+#endif
+
+namespace {
+
+// Parçacık üçgeninin merkeze göre köşeleri (birim boyut için)
+constexpr float kTriangleHalfWidth = 0.8660254f;
+constexpr float kTriangleBottom = 0.5f;
+
+void IntegrateScalar(float* x, float* y, float* vx, float* vy, float* age, const float* inverseLifetime,
+                     size_t begin, size_t count, float deltaTime, float gravityX, float gravityY) {
+    for (size_t i = begin; i < count; i++) {
+        vx[i] += gravityX * deltaTime;
+        vy[i] += gravityY * deltaTime;
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+        age[i] += inverseLifetime[i] * deltaTime;
+    }
+}
+
+#if defined(PARTICLE_SYSTEM_X86)
+
+void IntegrateSse2(float* x, float* y, float* vx, float* vy, float* age, const float* inverseLifetime,
+                   size_t count, float deltaTime, float gravityX, float gravityY) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 gx = _mm_set1_ps(gravityX * deltaTime);
+    const __m128 gy = _mm_set1_ps(gravityY * deltaTime);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 nvx = _mm_add_ps(_mm_loadu_ps(vx + i), gx);
+        __m128 nvy = _mm_add_ps(_mm_loadu_ps(vy + i), gy);
+        _mm_storeu_ps(vx + i, nvx);
+        _mm_storeu_ps(vy + i, nvy);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(nvx, dt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(nvy, dt)));
+        _mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), _mm_mul_ps(_mm_loadu_ps(inverseLifetime + i), dt)));
+    }
+
+    IntegrateScalar(x, y, vx, vy, age, inverseLifetime, i, count, deltaTime, gravityX, gravityY);
+}
+
+PARTICLE_SYSTEM_TARGET_AVX2
+void IntegrateAvx2(float* x, float* y, float* vx, float* vy, float* age, const float* inverseLifetime,
+                   size_t count, float deltaTime, float gravityX, float gravityY) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 gx = _mm256_set1_ps(gravityX * deltaTime);
+    const __m256 gy = _mm256_set1_ps(gravityY * deltaTime);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 nvx = _mm256_add_ps(_mm256_loadu_ps(vx + i), gx);
+        __m256 nvy = _mm256_add_ps(_mm256_loadu_ps(vy + i), gy);
+        _mm256_storeu_ps(vx + i, nvx);
+        _mm256_storeu_ps(vy + i, nvy);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(nvx, dt)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(nvy, dt)));
+        _mm256_storeu_ps(age + i, _mm256_add_ps(_mm256_loadu_ps(age + i),
+                                                _mm256_mul_ps(_mm256_loadu_ps(inverseLifetime + i), dt)));
+    }
+
+    IntegrateScalar(x, y, vx, vy, age, inverseLifetime, i, count, deltaTime, gravityX, gravityY);
+}
+
+#endif
+
+} // namespace
+
+ParticleEmitter::ParticleEmitter(const ParticleEmitterSettings& settings, uint32_t seed)
+    : mSettings(settings)
+    , mX(settings.mMaxParticles)
+    , mY(settings.mMaxParticles)
+    , mVx(settings.mMaxParticles)
+    , mVy(settings.mMaxParticles)
+    , mAge(settings.mMaxParticles)
+    , mInverseLifetime(settings.mMaxParticles)
+    , mRandomState(seed == 0 ? 1 : seed) {
+}
+
+void ParticleEmitter::Resolve() {
+    // Sahne ağacındaki çocuk nesneler dünya konumlarından parçacık üretir
+    Transform* world = mOwner ? mOwner->GetComponent<WorldTransform>() : nullptr;
+    mTransform = world ? world : (mOwner ? mOwner->GetComponent<Transform>() : nullptr);
+}
+
+float ParticleEmitter::NextRandom() {
+    // xorshift32; her yayıcı kendi durumunu tuttuğundan paralel güncellemede sonuç değişmez
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+    return static_cast<float>(mRandomState >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleEmitter::Spawn(size_t count) {
+    count = std::min(count, Capacity() - mCount);
+    const float originX = mTransform ? mTransform->mX : 0.0f;
+    const float originY = mTransform ? mTransform->mY : 0.0f;
+
+    for (size_t i = mCount; i < mCount + count; i++) {
+        const float angle = mSettings.mDirection + mSettings.mSpread * (NextRandom() - 0.5f);
+        const float speed = mSettings.mMinSpeed + (mSettings.mMaxSpeed - mSettings.mMinSpeed) * NextRandom();
+        const float lifetime = mSettings.mMinLifetime + (mSettings.mMaxLifetime - mSettings.mMinLifetime) * NextRandom();
+
+        mX[i] = originX;
+        mY[i] = originY;
+        mVx[i] = std::cos(angle) * speed;
+        mVy[i] = std::sin(angle) * speed;
+        mAge[i] = 0.0f;
+        mInverseLifetime[i] = lifetime > 0.0f ? 1.0f / lifetime : 1.0f;
+    }
+    mCount += count;
+}
+
+void ParticleEmitter::Simulate(float deltaTime) {
+    mLastStep = deltaTime;
+
+    ParticleSystem::Integrate(mX.data(), mY.data(), mVx.data(), mVy.data(), mAge.data(), mInverseLifetime.data(),
+                              mCount, deltaTime, mSettings.mGravityX, mSettings.mGravityY);
+    mCount = ParticleSystem::Compact(mX.data(), mY.data(), mVx.data(), mVy.data(), mAge.data(),
+                                     mInverseLifetime.data(), mCount);
+
+    if (mEmitting) {
+        mSpawnAccumulator += mSettings.mRate * deltaTime;
+        const float whole = std::floor(mSpawnAccumulator);
+        mSpawnAccumulator -= whole;
+        Spawn(static_cast<size_t>(whole));
+    }
+}
+
+void ParticleEmitter::Burst(size_t count) {
+    Spawn(count);
+}
+
+void ParticleEmitter::WriteVertices(SDL_Vertex* out, float alpha) const {
+    const float rewind = (alpha - 1.0f) * mLastStep;
+    const float size = mSettings.mSize;
+    const float halfWidth = size * kTriangleHalfWidth;
+    const float bottom = size * kTriangleBottom;
+    const SDL_FColor start = mSettings.mStartColor;
+    const SDL_FColor delta{mSettings.mEndColor.r - start.r, mSettings.mEndColor.g - start.g,
+                           mSettings.mEndColor.b - start.b, mSettings.mEndColor.a - start.a};
+    const float* x = mX.data();
+    const float* y = mY.data();
+    const float* vx = mVx.data();
+    const float* vy = mVy.data();
+    const float* age = mAge.data();
+
+    size_t i = 0;
+#if defined(PARTICLE_SYSTEM_X86)
+    // Bir köşe {x, y, r, g, b, a, u, v} düzenindedir; her köşe iki 16 baytlık yazma ile doldurulur
+    static_assert(sizeof(SDL_Vertex) == 8 * sizeof(float));
+    const __m128 startColor = _mm_setr_ps(start.r, start.g, start.b, start.a);
+    const __m128 deltaColor = _mm_setr_ps(delta.r, delta.g, delta.b, delta.a);
+    const __m128 offsets01 = _mm_setr_ps(0.0f, -size, halfWidth, bottom);
+    const __m128 offsets2 = _mm_setr_ps(-halfWidth, bottom, 0.0f, 0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    auto* target = reinterpret_cast<float*>(out);
+
+    for (; i < mCount; i++, target += 24) {
+        const float px = x[i] + vx[i] * rewind;
+        const float py = y[i] + vy[i] * rewind;
+        const __m128 position = _mm_setr_ps(px, py, px, py);
+        const __m128 color = _mm_add_ps(startColor, _mm_mul_ps(deltaColor, _mm_set1_ps(age[i])));
+        const __m128 colorHigh = _mm_movehl_ps(zero, color);
+        const __m128 corners01 = _mm_add_ps(position, offsets01);
+        const __m128 corner2 = _mm_add_ps(position, offsets2);
+
+        _mm_storeu_ps(target + 0, _mm_movelh_ps(corners01, color));
+        _mm_storeu_ps(target + 4, colorHigh);
+        _mm_storeu_ps(target + 8, _mm_shuffle_ps(corners01, color, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(target + 12, colorHigh);
+        _mm_storeu_ps(target + 16, _mm_movelh_ps(corner2, color));
+        _mm_storeu_ps(target + 20, colorHigh);
+    }
+#endif
+
+    for (; i < mCount; i++) {
+        const float px = x[i] + vx[i] * rewind;
+        const float py = y[i] + vy[i] * rewind;
+        const float t = age[i];
+        const SDL_FColor color{start.r + delta.r * t, start.g + delta.g * t, start.b + delta.b * t,
+                               start.a + delta.a * t};
+
+        SDL_Vertex* vertex = out + i * 3;
+        vertex[0] = SDL_Vertex{{px, py - size}, color, {0.0f, 0.0f}};
+        vertex[1] = SDL_Vertex{{px + halfWidth, py + bottom}, color, {0.0f, 0.0f}};
+        vertex[2] = SDL_Vertex{{px - halfWidth, py + bottom}, color, {0.0f, 0.0f}};
+    }
+}
+
+ComponentMask ParticleSystem::Reads() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<WorldTransform>() | ComponentMaskOf<ParticleEmitter>();
+}
+
+ComponentMask ParticleSystem::Writes() const {
+    return ComponentMaskOf<ParticleEmitter>();
+}
+
+void ParticleSystem::Run(Registry& registry, JobSystem& jobs, float deltaTime) {
+    ComponentPool<ParticleEmitter>* emitters = registry.Store().FindPool<ParticleEmitter>();
+    if (!emitters) {
+        return;
+    }
+
+    jobs.ParallelFor(emitters->Size(), 1, [emitters, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            emitters->At(i).Simulate(deltaTime);
+        }
+    });
+}
+
+void ParticleSystem::BuildVertices(ComponentStore& store, float alpha, std::vector<SDL_Vertex>& vertices) {
+    auto& emitters = store.Pool<ParticleEmitter>();
+    size_t total = 0;
+    emitters.ForEach([&total](ObjectId, ParticleEmitter& emitter) {
+        total += emitter.VertexCount();
+    });
+
+    // clear + resize her karede tüm diziyi sıfırlayacağından yalnızca boyut değiştirilir ve köşeler üzerine yazılır
+    vertices.resize(total);
+    SDL_Vertex* out = vertices.data();
+    emitters.ForEach([&out, alpha](ObjectId, ParticleEmitter& emitter) {
+        emitter.WriteVertices(out, alpha);
+        out += emitter.VertexCount();
+    });
+}
+
+void ParticleSystem::Draw(SDL_Renderer* renderer, const std::vector<SDL_Vertex>& vertices) {
+    if (vertices.empty()) {
+        return;
+    }
+
+    SDL_BlendMode previous = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(renderer, &previous);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(renderer, nullptr, vertices.data(), static_cast<int>(vertices.size()), nullptr, 0);
+    SDL_SetRenderDrawBlendMode(renderer, previous);
+}
+
+void ParticleSystem::Integrate(float* x, float* y, float* vx, float* vy, float* age, const float* inverseLifetime,
+                               size_t count, float deltaTime, float gravityX, float gravityY) {
+    static const SimdLevel sLevel = MovementSystem::DetectSimdLevel();
+    Integrate(sLevel, x, y, vx, vy, age, inverseLifetime, count, deltaTime, gravityX, gravityY);
+}
+
+void ParticleSystem::Integrate(SimdLevel level, float* x, float* y, float* vx, float* vy, float* age,
+                               const float* inverseLifetime, size_t count, float deltaTime,
+                               float gravityX, float gravityY) {
+#if defined(PARTICLE_SYSTEM_X86)
+    switch (level) {
+        case SimdLevel::Avx2:
+            IntegrateAvx2(x, y, vx, vy, age, inverseLifetime, count, deltaTime, gravityX, gravityY);
+            return;
+
+        case SimdLevel::Sse2:
+            IntegrateSse2(x, y, vx, vy, age, inverseLifetime, count, deltaTime, gravityX, gravityY);
+            return;
+
+        case SimdLevel::Scalar:
+            break;
+    }
+#else
+    (void)level;
+#endif
+    IntegrateScalar(x, y, vx, vy, age, inverseLifetime, 0, count, deltaTime, gravityX, gravityY);
+}
+
+size_t ParticleSystem::Compact(float* x, float* y, float* vx, float* vy, float* age, float* inverseLifetime,
+                               size_t count) {
+    size_t write = 0;
+    for (size_t i = 0; i < count; i++) {
+        // Parçacık her durumda yazılır; ölüyse bir sonraki canlı aynı konumun üzerine yazar
+        const size_t alive = age[i] < 1.0f;
+        x[write] = x[i];
+        y[write] = y[i];
+        vx[write] = vx[i];
+        vy[write] = vy[i];
+        age[write] = age[i];
+        inverseLifetime[write] = inverseLifetime[i];
+        write += alive;
+    }
+    return write;
+}
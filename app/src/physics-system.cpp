@@ -0,0 +1,128 @@
+#include <algorithm>
+
+#include "physics-system.h"
+#include "registry.h"
+#include "view.h"
+
+namespace {
+
+void IntegrateSemiImplicitEuler(float* x, float* y, float* vx, float* vy, const float* ax, const float* ay,
+                                const float* drag, size_t count, float deltaTime) {
+    for (size_t i = 0; i < count; i++) {
+        vx[i] += (ax[i] - drag[i] * vx[i]) * deltaTime;
+        vy[i] += (ay[i] - drag[i] * vy[i]) * deltaTime;
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+    }
+}
+
+void IntegrateVelocityVerlet(float* x, float* y, float* vx, float* vy, const float* ax, const float* ay,
+                             const float* drag, size_t count, float deltaTime) {
+    const float halfStep = 0.5f * deltaTime;
+    for (size_t i = 0; i < count; i++) {
+        // Adımın başındaki ivme
+        const float startAx = ax[i] - drag[i] * vx[i];
+        const float startAy = ay[i] - drag[i] * vy[i];
+        x[i] += (vx[i] + startAx * halfStep) * deltaTime;
+        y[i] += (vy[i] + startAy * halfStep) * deltaTime;
+
+        // Dış kuvvet adım boyunca sabit kabul edilir; sürtünme öngörülen adım sonu hızıyla hesaplanır
+        const float endAx = ax[i] - drag[i] * (vx[i] + startAx * deltaTime);
+        const float endAy = ay[i] - drag[i] * (vy[i] + startAy * deltaTime);
+        vx[i] += (startAx + endAx) * halfStep;
+        vy[i] += (startAy + endAy) * halfStep;
+    }
+}
+
+} // namespace
+
+PhysicsSystem::PhysicsSystem(IntegrationMethod method, float gravityX, float gravityY)
+    : mMethod(method), mGravityX(gravityX), mGravityY(gravityY) {
+}
+
+void PhysicsSystem::Update(ComponentStore& store, float deltaTime, JobSystem* jobs) {
+    const View<Transform, Velocity, RigidBody> view(store);
+
+    const size_t count = view.Size();
+    mX.resize(count);
+    mY.resize(count);
+    mVx.resize(count);
+    mVy.resize(count);
+    mAx.resize(count);
+    mAy.resize(count);
+    mDrag.resize(count);
+
+    // Transform havuzunu izleyen yoksa bildirim tamamen atlanır
+    ComponentPool<Transform>* transforms = store.FindPool<Transform>();
+    ComponentPool<Transform>* tracked = transforms && transforms->IsTracked() ? transforms : nullptr;
+
+    // Parça sınırları iş parçacığı sayısına değil yalnızca kChunkSize'a bağlıdır
+    auto process = [&](size_t firstChunk, size_t lastChunk) {
+        for (size_t chunk = firstChunk; chunk < lastChunk; chunk++) {
+            const size_t begin = chunk * kChunkSize;
+            const size_t end = std::min(begin + kChunkSize, count);
+
+            size_t i = begin;
+            view.ForEach(begin, end, [&](Transform& transform, Velocity& velocity, RigidBody& body) {
+                // Durağan nesneler yerçekiminden de etkilenmez
+                const float dynamic = body.mInverseMass > 0.0f ? 1.0f : 0.0f;
+                mX[i] = transform.mX;
+                mY[i] = transform.mY;
+                mVx[i] = velocity.mVx;
+                mVy[i] = velocity.mVy;
+                mAx[i] = body.mForceX * body.mInverseMass + mGravityX * dynamic;
+                mAy[i] = body.mForceY * body.mInverseMass + mGravityY * dynamic;
+                mDrag[i] = body.mDrag * dynamic;
+                body.ClearForces();
+                i++;
+            });
+
+            Integrate(mMethod, mX.data() + begin, mY.data() + begin, mVx.data() + begin, mVy.data() + begin,
+                      mAx.data() + begin, mAy.data() + begin, mDrag.data() + begin, end - begin, deltaTime);
+
+            i = begin;
+            view.ForEach(begin, end, [&](ObjectId id, Transform& transform, Velocity& velocity, RigidBody&) {
+                if (tracked) {
+                    tracked->MarkChanged(id);
+                }
+                transform.mX = mX[i];
+                transform.mY = mY[i];
+                velocity.mVx = mVx[i];
+                velocity.mVy = mVy[i];
+                i++;
+            });
+        }
+    };
+
+    const size_t chunkCount = (count + kChunkSize - 1) / kChunkSize;
+    if (jobs) {
+        jobs->ParallelFor(chunkCount, 1, process);
+    } else {
+        process(0, chunkCount);
+    }
+}
+
+ComponentMask PhysicsSystem::Reads() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<Velocity>() | ComponentMaskOf<RigidBody>();
+}
+
+ComponentMask PhysicsSystem::Writes() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<Velocity>() | ComponentMaskOf<RigidBody>();
+}
+
+void PhysicsSystem::Run(Registry& registry, JobSystem& jobs, float deltaTime) {
+    Update(registry.Store(), deltaTime, &jobs);
+}
+
+void PhysicsSystem::Integrate(IntegrationMethod method, float* x, float* y, float* vx, float* vy,
+                              const float* ax, const float* ay, const float* drag, size_t count, float deltaTime) {
+    switch (method) {
+        case IntegrationMethod::SemiImplicitEuler:
+            IntegrateSemiImplicitEuler(x, y, vx, vy, ax, ay, drag, count, deltaTime);
+            break;
+
+        case IntegrationMethod::VelocityVerlet:
+            IntegrateVelocityVerlet(x, y, vx, vy, ax, ay, drag, count, deltaTime);
+            break;
+    }
+}
@@ -0,0 +1,114 @@
+#include "pool-allocator.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+FixedBlockPool::FixedBlockPool(size_t blockSize, size_t alignment, size_t blocksPerChunk, PoolBacking backing)
+    : mAlignment(std::max(alignment, alignof(FreeBlock))),
+      mBlocksPerChunk(std::max<size_t>(blocksPerChunk, 1)),
+      mBacking(backing) {
+    // Boş bloklar serbest liste düğümü olarak kullanıldığından blok en az bir işaretçi büyüklüğünde olmalı
+    mBlockSize = AlignUp(std::max(blockSize, sizeof(FreeBlock)), mAlignment);
+    mStats.mBlockSize = mBlockSize;
+}
+
+FixedBlockPool::~FixedBlockPool() {
+    for (const auto& chunk : mChunks) {
+#if defined(__linux__)
+        if (chunk.mMapped) {
+            munmap(chunk.mMemory, chunk.mBytes);
+            continue;
+        }
+#endif
+        ::operator delete(chunk.mMemory, std::align_val_t{mAlignment});
+    }
+}
+
+void FixedBlockPool::Grow() {
+    size_t bytes = mBlockSize * mBlocksPerChunk;
+    Chunk chunk{nullptr, bytes, false};
+
+#if defined(__linux__)
+    if (mBacking == PoolBacking::HugePages) {
+        // Büyük sayfa sınırına yuvarlanan alan, çekirdekten şeffaf büyük sayfa (THP) olarak istenir
+        bytes = AlignUp(bytes, kHugePageSize);
+        void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory != MAP_FAILED) {
+            madvise(memory, bytes, MADV_HUGEPAGE);
+            chunk = Chunk{memory, bytes, true};
+        }
+    }
+#endif
+
+    if (!chunk.mMemory) {
+        chunk.mMemory = ::operator new(bytes, std::align_val_t{mAlignment});
+    }
+
+    mChunks.push_back(chunk);
+
+    // Yeni blokları adres sırasıyla kullanılacak şekilde listeye ekle
+    const size_t blockCount = bytes / mBlockSize;
+    auto* base = static_cast<std::byte*>(chunk.mMemory);
+    for (size_t i = blockCount; i > 0; i--) {
+        auto* block = reinterpret_cast<FreeBlock*>(base + (i - 1) * mBlockSize);
+        block->mNext = mFreeList;
+        mFreeList = block;
+    }
+
+    mStats.mCapacity += blockCount;
+    mStats.mChunkCount++;
+}
+
+void* FixedBlockPool::Allocate() {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mFreeList) {
+        Grow();
+    }
+
+    FreeBlock* block = mFreeList;
+    mFreeList = block->mNext;
+
+    mStats.mInUse++;
+    mStats.mPeakInUse = std::max(mStats.mPeakInUse, mStats.mInUse);
+    return block;
+}
+
+void FixedBlockPool::Deallocate(void* block) {
+    if (!block) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->mNext = mFreeList;
+    mFreeList = freeBlock;
+    mStats.mInUse--;
+}
+
+void FixedBlockPool::Reserve(size_t blockCount) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    while (mStats.mCapacity < blockCount) {
+        Grow();
+    }
+}
+
+PoolStats FixedBlockPool::GetStats() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
@@ -0,0 +1,117 @@
+#include "registry.h"
+
+Registry::Registry(PoolBacking backing)
+    : mStore(backing), mObjectPool(1024, backing) {
+}
+
+Registry::~Registry() {
+    for (GraphicalObject* object : mObjects) {
+        mObjectPool.Destroy(object);
+    }
+}
+
+Entity Registry::Create() {
+    ObjectId index = mStore.CreateObject();
+
+    if (index >= mGenerations.size()) {
+        mGenerations.resize(static_cast<size_t>(index) + 1, 0);
+        mAliveIndex.resize(static_cast<size_t>(index) + 1, Entity::kInvalidIndex);
+    }
+
+    Entity entity{index, mGenerations[index]};
+
+    // Görünümler silinmez, indeks yeniden kullanıldığında aynı görünüm yeni tutamaca bağlanır
+    while (mObjects.size() <= index) {
+        mObjects.push_back(mObjectPool.Create(mStore, Entity{}));
+    }
+    mObjects[index]->Rebind(entity);
+
+    mAliveIndex[index] = static_cast<uint32_t>(mAlive.size());
+    mAlive.push_back(entity);
+    return entity;
+}
+
+void Registry::Destroy(Entity entity) {
+    if (!IsAlive(entity)) {
+        return;
+    }
+
+    // Alt nesneler en derindekinden başlanarak silinir
+    if (mSceneGraph.IsNode(entity.mIndex)) {
+        const size_t begin = mDescendants.size();
+        mSceneGraph.CollectDescendants(entity.mIndex, mDescendants);
+        while (mDescendants.size() > begin) {
+            ObjectId id = mDescendants.back();
+            mDescendants.pop_back();
+            Destroy(Entity{id, mGenerations[id]});
+        }
+        mSceneGraph.Remove(entity.mIndex);
+    }
+
+    mStore.DestroyObject(entity.mIndex);
+    mGenerations[entity.mIndex]++;
+
+    uint32_t removedIndex = mAliveIndex[entity.mIndex];
+    Entity last = mAlive.back();
+    mAlive[removedIndex] = last;
+    mAliveIndex[last.mIndex] = removedIndex;
+    mAlive.pop_back();
+    mAliveIndex[entity.mIndex] = Entity::kInvalidIndex;
+}
+
+bool Registry::IsAlive(Entity entity) const {
+    return entity.mIndex < mGenerations.size()
+        && mGenerations[entity.mIndex] == entity.mGeneration
+        && mAliveIndex[entity.mIndex] != Entity::kInvalidIndex;
+}
+
+GraphicalObject* Registry::Get(Entity entity) {
+    return IsAlive(entity) ? mObjects[entity.mIndex] : nullptr;
+}
+
+Entity Registry::EntityOf(ObjectId id) const {
+    if (id >= mAliveIndex.size() || mAliveIndex[id] == Entity::kInvalidIndex) {
+        return Entity{};
+    }
+    return Entity{id, mGenerations[id]};
+}
+
+void Registry::Reserve(size_t count) {
+    mStore.Reserve(count);
+    mObjectPool.Reserve(count);
+    mObjects.reserve(count);
+    mGenerations.reserve(count);
+    mAliveIndex.reserve(count);
+    mAlive.reserve(count);
+}
+
+void Registry::SetParent(Entity child, Entity parent) {
+    GraphicalObject* childObject = Get(child);
+    if (!childObject || !IsAlive(parent)) {
+        return;
+    }
+
+    mSceneGraph.Attach(child.mIndex, parent.mIndex);
+    if (!childObject->GetComponent<WorldTransform>()) {
+        childObject->AddComponent<WorldTransform>();
+    }
+}
+
+void Registry::ClearParent(Entity child) {
+    GraphicalObject* childObject = Get(child);
+    if (!childObject) {
+        return;
+    }
+
+    mSceneGraph.Detach(child.mIndex);
+    childObject->RemoveComponent<WorldTransform>();
+}
+
+Entity Registry::GetParent(Entity child) const {
+    if (!IsAlive(child)) {
+        return Entity{};
+    }
+
+    ObjectId parent = mSceneGraph.GetParent(child.mIndex);
+    return parent == kInvalidObjectId ? Entity{} : Entity{parent, mGenerations[parent]};
+}
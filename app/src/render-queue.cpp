@@ -0,0 +1,115 @@
+#include "render-queue.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+
+#include "render-strategies.h"
+#include "sdl-renderer.h"
+
+namespace {
+
+constexpr int kDigitBits = 8;
+constexpr int kDigitCount = 64 / kDigitBits;
+constexpr size_t kBucketCount = size_t{1} << kDigitBits;
+
+uint32_t ColorBits(SDL_FColor color) {
+    auto channel = [](float value) {
+        return static_cast<uint32_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    };
+    return (channel(color.r) << 24) | (channel(color.g) << 16) | (channel(color.b) << 8) | channel(color.a);
+}
+
+// Stratejinin malzeme anahtari 20 bite ozetlenir; cakisma yalnizca gruplamayi bozar, cizimi degil
+uint32_t MaterialBits(uint64_t material) {
+    return static_cast<uint32_t>((material * 0x9E3779B97F4A7C15ull) >> 44);
+}
+
+} // namespace
+
+void RenderQueue::Clear() {
+    mCommands.clear();
+    mSorted = nullptr;
+}
+
+void RenderQueue::Push(RenderStrategy* strategy, const Transform& transform, uint8_t layer,
+                       SDL_BlendMode blendMode) {
+    mCommands.push_back(Command{strategy, transform, blendMode, MakeKey(layer, blendMode, *strategy, transform)});
+    mSorted = nullptr;
+}
+
+void RenderQueue::Sort() {
+    mEntries.resize(mCommands.size());
+    mScratch.resize(mCommands.size());
+    for (size_t i = 0; i < mCommands.size(); i++) {
+        mEntries[i] = SortEntry{mCommands[i].mKey, static_cast<uint32_t>(i)};
+    }
+    mSorted = RadixSort(mEntries.data(), mScratch.data(), mCommands.size());
+}
+
+void RenderQueue::Submit(Renderer& renderer) {
+    if (!mSorted) {
+        Sort();
+    }
+
+    bool blendSet = false;
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    for (size_t i = 0; i < mCommands.size(); i++) {
+        const Command& command = mCommands[mSorted[i].mIndex];
+
+        // Karisim modu cizim durumudur; onceki modla biriken sekiller once cizilir
+        if (!blendSet || command.mBlendMode != blendMode) {
+            renderer.Flush();
+            SDL_SetRenderDrawBlendMode(renderer.GetSDLRenderer(), command.mBlendMode);
+            blendMode = command.mBlendMode;
+            blendSet = true;
+        }
+        command.mStrategy->Submit(renderer, command.mTransform);
+    }
+}
+
+uint64_t RenderQueue::MakeKey(uint8_t layer, SDL_BlendMode blendMode, const RenderStrategy& strategy,
+                              const Transform& transform) {
+    // SDL karisim modlari tek bitlik bayraklardir; bit konumu 4 bite sigar
+    const auto blend = static_cast<uint64_t>(std::min<uint32_t>(std::bit_width(static_cast<uint32_t>(blendMode)), 15u));
+    return (static_cast<uint64_t>(layer) << 56) | (blend << 52) |
+           (static_cast<uint64_t>(MaterialBits(strategy.MaterialKey(transform))) << 32) |
+           ColorBits(strategy.GetColor());
+}
+
+RenderQueue::SortEntry* RenderQueue::RadixSort(SortEntry* entries, SortEntry* scratch, size_t count) {
+    // Tum basamaklarin histogramlari tek geciste cikarilir
+    uint32_t histograms[kDigitCount][kBucketCount] = {};
+    for (size_t i = 0; i < count; i++) {
+        const uint64_t key = entries[i].mKey;
+        for (int digit = 0; digit < kDigitCount; digit++) {
+            histograms[digit][(key >> (digit * kDigitBits)) & (kBucketCount - 1)]++;
+        }
+    }
+
+    SortEntry* source = entries;
+    SortEntry* target = scratch;
+    for (int digit = 0; digit < kDigitCount; digit++) {
+        uint32_t* histogram = histograms[digit];
+
+        // Tum anahtarlarda ayni olan basamak sirayi degistirmez
+        if (count == 0 || histogram[(source[0].mKey >> (digit * kDigitBits)) & (kBucketCount - 1)] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (size_t bucket = 0; bucket < kBucketCount; bucket++) {
+            const uint32_t bucketSize = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketSize;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const size_t bucket = (source[i].mKey >> (digit * kDigitBits)) & (kBucketCount - 1);
+            target[histogram[bucket]++] = source[i];
+        }
+        std::swap(source, target);
+    }
+    return source;
+}
@@ -0,0 +1,55 @@
+#include "render-snapshot.h"
+
+#include <algorithm>
+
+#include "particle-system.h"
+#include "registry.h"
+#include "render-queue.h"
+#include "render-strategies.h"
+#include "sdl-renderer.h"
+
+void RenderSnapshot::Capture(Registry& registry, const std::vector<ObjectId>& visible) {
+    mItems.clear();
+    mStrategies.clear();
+    mStrategyIndex.clear();
+
+    ComponentStore& store = registry.Store();
+    for (ObjectId id : visible) {
+        const RenderComponent* render = store.Get<RenderComponent>(id);
+        if (!render || !render->GetStrategy() || !render->GetBoundTransform()) {
+            continue;
+        }
+
+        // Farklı strateji sayısı küçük olduğundan sıralı dizi, düğüm ayıran bir hash tablosundan daha ucuzdur
+        const RenderStrategy* strategy = render->GetStrategy().get();
+        auto it = std::lower_bound(mStrategyIndex.begin(), mStrategyIndex.end(), strategy,
+                                   [](const auto& entry, const RenderStrategy* key) { return entry.first < key; });
+        if (it == mStrategyIndex.end() || it->first != strategy) {
+            it = mStrategyIndex.insert(it, {strategy, static_cast<uint32_t>(mStrategies.size())});
+            mStrategies.push_back(render->GetStrategy());
+        }
+
+        RenderItem& item = mItems.emplace_back(RenderItem{*render->GetBoundTransform(), it->second, render->GetLayer()});
+
+        // Kopya simülasyondaki nesneye geri dönüş yolu taşımaz
+        item.mTransform.mOwner = nullptr;
+    }
+
+    ParticleSystem::BuildVertices(store, 1.0f, mParticleVertices);
+}
+
+float RenderSnapshot::AlphaAt(std::chrono::steady_clock::time_point now) const {
+    const float elapsed = std::chrono::duration<float>(now - mPublishTime).count();
+    return std::clamp(mAlpha + elapsed / mStepSeconds, 0.0f, 1.0f);
+}
+
+void RenderSnapshot::Draw(Renderer& renderer, float alpha, RenderQueue& queue) const {
+    queue.Clear();
+    for (const RenderItem& item : mItems) {
+        queue.Push(mStrategies[item.mStrategy].get(), item.mTransform.Interpolated(alpha), item.mLayer);
+    }
+    queue.Sort();
+    queue.Submit(renderer);
+    renderer.Flush();
+    ParticleSystem::Draw(renderer.GetSDLRenderer(), mParticleVertices);
+}
@@ -1,8 +1,35 @@
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <iterator>
 #include <vector>
 
 #include "render-strategies.h"
 #include "components.h"
+#include "sdl-renderer.h"
+#include "shape-texture-cache.h"
+
+namespace {
+
+// Yelpaze kenarlarinin gercek cemberden en fazla sapmasi (piksel) ve kenar sayisi sinirlari
+constexpr float kFanTolerance = 0.5f;
+constexpr uint32_t kMinFanSegments = 8;
+constexpr uint32_t kMaxFanSegments = 128;
+
+SDL_FColor ToFColor(SDL_Color color) {
+    return SDL_FColor{color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+}
+
+} // namespace
+
+void RenderStrategy::Submit(Renderer& renderer, const Transform& transform) {
+    renderer.Flush();
+    Render(renderer.GetSDLRenderer(), transform);
+}
+
+uint64_t RenderStrategy::MaterialKey(const Transform&) const {
+    return static_cast<uint64_t>(GetShape().mType);
+}
 
 RectangleRenderer::RectangleRenderer(SDL_Color color, int32_t width, int32_t height) 
         : mColor(color), mWidth(width), mHeight(height) {
@@ -19,6 +46,23 @@ void RectangleRenderer::Render(SDL_Renderer* renderer, const Transform& transfor
     SDL_RenderFillRect(renderer, &rect);
 }
 
+void RectangleRenderer::Submit(Renderer& renderer, const Transform& transform) {
+    renderer.Batch().AddRect(SDL_FRect{
+        transform.mX - (mWidth * transform.mScaleX) / 2.0f,
+        transform.mY - (mHeight * transform.mScaleY) / 2.0f,
+        mWidth * transform.mScaleX,
+        mHeight * transform.mScaleY
+    }, GetColor());
+}
+
+ShapeDesc RectangleRenderer::GetShape() const {
+    return ShapeDesc{ShapeType::Rectangle, static_cast<float>(mWidth), static_cast<float>(mHeight)};
+}
+
+SDL_FColor RectangleRenderer::GetColor() const {
+    return ToFColor(mColor);
+}
+
 CircleRenderer::CircleRenderer(SDL_Color color, int32_t radius) 
         : mColor(color), mRadius(radius) {
 }
@@ -26,100 +70,187 @@ CircleRenderer::CircleRenderer(SDL_Color color, int32_t radius)
 void CircleRenderer::Render(SDL_Renderer* renderer, const Transform& transform) {
     SDL_SetRenderDrawColor(renderer, mColor.r, mColor.g, mColor.b, mColor.a);
     
-    // Simple circle drawing algorithm
-    int32_t scaledRadius = static_cast<int32_t>(mRadius * transform.mScaleX);
-    int32_t centerX = static_cast<int32_t>(transform.mX);
-    int32_t centerY = static_cast<int32_t>(transform.mY);
-    
-    for (int32_t y = -scaledRadius; y <= scaledRadius; y++) {
-        for (int32_t x = -scaledRadius; x <= scaledRadius; x++) {
-            if (x*x + y*y <= scaledRadius*scaledRadius) {
-                SDL_RenderPoint(renderer, centerX + x, centerY + y);
-            }
+    // Her satir tek bir dikdortgen olarak, tum satirlar ise tek cagri ile gonderilir. Satir dizisi paylasilan
+    // stratejide degil is parcacigi basina tutulur, boylece her cizimde bellek ayrilmaz ve cagri yeniden girilebilir
+    thread_local std::vector<SDL_FRect> tSpans;
+    BuildSpans(static_cast<int32_t>(transform.mX), static_cast<int32_t>(transform.mY),
+               static_cast<int32_t>(mRadius * transform.mScaleX), static_cast<int32_t>(mRadius * transform.mScaleY),
+               tSpans);
+    SDL_RenderFillRects(renderer, tSpans.data(), static_cast<int>(tSpans.size()));
+}
+
+void CircleRenderer::BuildSpans(int32_t centerX, int32_t centerY, int32_t radiusX, int32_t radiusY,
+                                std::vector<SDL_FRect>& spans) {
+    spans.clear();
+    if (radiusX < 0 || radiusY < 0) {
+        return;
+    }
+
+    // Tamsayi esitsizligi: x^2 * ry^2 + y^2 * rx^2 <= rx^2 * ry^2
+    const int64_t rx2 = static_cast<int64_t>(radiusX) * radiusX;
+    const int64_t ry2 = static_cast<int64_t>(radiusY) * radiusY;
+    const int64_t limit = rx2 * ry2;
+
+    for (int32_t y = -radiusY; y <= radiusY; y++) {
+        const int64_t rowTerm = static_cast<int64_t>(y) * y * rx2;
+        auto inside = [&](int64_t x) { return x * x * ry2 + rowTerm <= limit; };
+
+        // Kayan noktali tahmin tamsayi kosulu ile duzeltilir, boylece sonuc yuvarlama hatasindan etkilenmez
+        const float ratio = radiusY > 0 ? static_cast<float>(y) / static_cast<float>(radiusY) : 0.0f;
+        auto half = static_cast<int32_t>(radiusX * std::sqrt(std::max(0.0f, 1.0f - ratio * ratio)));
+        half = std::min(half, radiusX);
+        while (half < radiusX && inside(half + 1)) {
+            half++;
+        }
+        while (half > 0 && !inside(half)) {
+            half--;
         }
+
+        spans.push_back(SDL_FRect{static_cast<float>(centerX - half), static_cast<float>(centerY + y),
+                                  static_cast<float>(2 * half + 1), 1.0f});
     }
 }
 
+void CircleRenderer::Submit(Renderer& renderer, const Transform& transform) {
+    // Once onbellekteki hazir doku denenir; Render ile ayni piksellere denk gelecek sekilde yerlestirilir
+    const int32_t spanRadiusX = SpanRadius(transform.mScaleX);
+    const int32_t spanRadiusY = SpanRadius(transform.mScaleY);
+    SDL_Texture* texture = renderer.ShapeCache().Acquire(renderer.GetSDLRenderer(), ShapeType::Circle,
+                                                         2 * spanRadiusX + 1, 2 * spanRadiusY + 1, mColor);
+    if (texture) {
+        renderer.Batch().AddTexturedRect(SDL_FRect{
+            static_cast<float>(static_cast<int32_t>(transform.mX) - spanRadiusX),
+            static_cast<float>(static_cast<int32_t>(transform.mY) - spanRadiusY),
+            static_cast<float>(2 * spanRadiusX + 1),
+            static_cast<float>(2 * spanRadiusY + 1)
+        }, texture);
+        return;
+    }
+
+    const float radiusX = mRadius * transform.mScaleX;
+    const float radiusY = mRadius * transform.mScaleY;
+    const uint32_t segments = FanSegments(std::max(radiusX, radiusY));
+
+    // Merkez ve kenar noktalari; her kenar merkezle birlikte bir ucgen olusturur. Birim cember noktalari
+    // bir adimlik donmenin tekrar uygulanmasiyla uretilir, boylece yalnizca bir kez cos/sin cagrilir
+    GeometryBatch& batch = renderer.Batch();
+    const SDL_FColor color = GetColor();
+    const auto base = static_cast<int>(batch.VertexCount());
+    SDL_Vertex* vertices = batch.AppendVertices(segments + 1);
+    vertices[0] = SDL_Vertex{{transform.mX, transform.mY}, color, {0.0f, 0.0f}};
+
+    const float step = 6.2831853f / static_cast<float>(segments);
+    const float cosStep = std::cos(step);
+    const float sinStep = std::sin(step);
+    float unitX = 1.0f;
+    float unitY = 0.0f;
+    for (uint32_t i = 0; i < segments; i++) {
+        vertices[i + 1] = SDL_Vertex{{transform.mX + unitX * radiusX, transform.mY + unitY * radiusY},
+                                     color, {0.0f, 0.0f}};
+        const float nextX = unitX * cosStep - unitY * sinStep;
+        unitY = unitX * sinStep + unitY * cosStep;
+        unitX = nextX;
+    }
+
+    int* indices = batch.AppendIndices(static_cast<size_t>(segments) * 3);
+    for (uint32_t i = 0; i < segments; i++) {
+        indices[i * 3] = base;
+        indices[i * 3 + 1] = base + 1 + static_cast<int>(i);
+        indices[i * 3 + 2] = base + 1 + static_cast<int>((i + 1) % segments);
+    }
+}
+
+uint32_t CircleRenderer::FanSegments(float radius) {
+    if (radius <= kFanTolerance) {
+        return kMinFanSegments;
+    }
+
+    // Kirisin orta noktasinin cembere uzakligi r * (1 - cos(theta / 2)) <= tolerans
+    const float step = 2.0f * std::acos(1.0f - kFanTolerance / radius);
+    const auto segments = static_cast<uint32_t>(std::ceil(6.2831853f / step));
+    return std::clamp(segments, kMinFanSegments, kMaxFanSegments);
+}
+
+uint64_t CircleRenderer::MaterialKey(const Transform& transform) const {
+    return ShapeTextureCache::MakeKey(ShapeType::Circle, 2 * SpanRadius(transform.mScaleX) + 1,
+                                      2 * SpanRadius(transform.mScaleY) + 1, mColor);
+}
+
+ShapeDesc CircleRenderer::GetShape() const {
+    return ShapeDesc{ShapeType::Circle, 2.0f * mRadius, 2.0f * mRadius};
+}
+
+SDL_FColor CircleRenderer::GetColor() const {
+    return ToFColor(mColor);
+}
+
 TriangleRenderer::TriangleRenderer(SDL_FColor color, float size) 
         : mColor(color), mEdgeLength(size) {
 }
     
+ShapeDesc TriangleRenderer::GetShape() const {
+    return ShapeDesc{ShapeType::Triangle, mEdgeLength, mEdgeLength * 0.866f};
+}
+
+SDL_FColor TriangleRenderer::GetColor() const {
+    return mColor;
+}
+
 void TriangleRenderer::Render(SDL_Renderer* renderer, const Transform& transform) {
-    SDL_SetRenderDrawColor(renderer, mColor.r, mColor.g, mColor.b, mColor.a);
-    
-    float scaledSize = mEdgeLength * transform.mScaleX;
-    float centerX = transform.mX;
-    float centerY = transform.mY;
-    float rotation = transform.mRotation;
-    
-    // Create vertices for equilateral triangle
-    std::vector<SDL_Vertex> vertices;
-    std::vector<int> indices;
-    
+    // Tum ucgenler ayni uc indeksi kullanir
+    static constexpr int kIndices[] = {0, 1, 2};
+
+    const std::array<SDL_Vertex, 3> vertices = MakeVertices(transform);
+    SDL_RenderGeometry(renderer, nullptr, vertices.data(), static_cast<int>(vertices.size()),
+                       kIndices, static_cast<int>(std::size(kIndices)));
+}
+
+void TriangleRenderer::Submit(Renderer& renderer, const Transform& transform) {
+    const std::array<SDL_Vertex, 3> vertices = MakeVertices(transform, &renderer.TriangleOffsets());
+    renderer.Batch().AddTriangle(vertices[0].position, vertices[1].position, vertices[2].position, mColor);
+}
+
+std::array<SDL_Vertex, 3> TriangleRenderer::MakeVertices(const Transform& transform, TriangleOffsetCache* cache) const {
+    const float scaledSize = mEdgeLength * transform.mScaleX;
+    const TriangleOffsetCache::Offsets offsets = cache ? cache->Get(scaledSize, transform.mRotation)
+                                                       : TriangleOffsetCache::Compute(scaledSize, transform.mRotation);
+
+    std::array<SDL_Vertex, 3> vertices;
+    for (size_t i = 0; i < vertices.size(); i++) {
+        vertices[i] = SDL_Vertex{SDL_FPoint{transform.mX + offsets[i].x, transform.mY + offsets[i].y},
+                                 mColor, SDL_FPoint{0, 0}};
+    }
+    return vertices;
+}
+
+const TriangleOffsetCache::Offsets& TriangleOffsetCache::Get(float scaledSize, float rotation) {
+    const uint32_t hash = std::bit_cast<uint32_t>(scaledSize) * 0x9E3779B1u
+                        ^ std::bit_cast<uint32_t>(rotation) * 0x85EBCA77u;
+    Entry& entry = mEntries[(hash >> 16) % kEntryCount];
+    if (entry.mSize != scaledSize || entry.mRotation != rotation) {
+        entry.mSize = scaledSize;
+        entry.mRotation = rotation;
+        entry.mOffsets = Compute(scaledSize, rotation);
+        mMisses++;
+    }
+    return entry.mOffsets;
+}
+
+TriangleOffsetCache::Offsets TriangleOffsetCache::Compute(float scaledSize, float rotation) {
     // Triangle vertices (pointing upward by default)
     float height = scaledSize * 0.866f; // sqrt(3)/2 for equilateral triangle
     float halfBase = scaledSize * 0.5f;
-    
-    // Top vertex
-    float topX = centerX;
-    float topY = centerY - height * 0.667f; // 2/3 of height from center
-    
-    // Bottom left vertex
-    float leftX = centerX - halfBase;
-    float leftY = centerY + height * 0.333f; // 1/3 of height from center
-    
-    // Bottom right vertex
-    float rightX = centerX + halfBase;
-    float rightY = centerY + height * 0.333f;
-    
+    Offsets offsets = {SDL_FPoint{0.0f, -height * 0.667f},   // 2/3 of height from center
+                       SDL_FPoint{-halfBase, height * 0.333f},  // 1/3 of height from center
+                       SDL_FPoint{halfBase, height * 0.333f}};
+
     // Apply rotation if needed
     if (rotation != 0.0f) {
         float cosR = cosf(rotation);
         float sinR = sinf(rotation);
-        
-        // Rotate top vertex
-        float tempX = topX - centerX;
-        float tempY = topY - centerY;
-        topX = centerX + tempX * cosR - tempY * sinR;
-        topY = centerY + tempX * sinR + tempY * cosR;
-        
-        // Rotate left vertex
-        tempX = leftX - centerX;
-        tempY = leftY - centerY;
-        leftX = centerX + tempX * cosR - tempY * sinR;
-        leftY = centerY + tempX * sinR + tempY * cosR;
-        
-        // Rotate right vertex
-        tempX = rightX - centerX;
-        tempY = rightY - centerY;
-        rightX = centerX + tempX * cosR - tempY * sinR;
-        rightY = centerY + tempX * sinR + tempY * cosR;
+        for (SDL_FPoint& offset : offsets) {
+            offset = SDL_FPoint{offset.x * cosR - offset.y * sinR, offset.x * sinR + offset.y * cosR};
+        }
     }
-    
-    // Create vertices    
-    vertices.push_back(SDL_Vertex{
-        SDL_FPoint{topX, topY},
-        mColor,
-        SDL_FPoint{0, 0}
-    });
-    
-    vertices.push_back({
-        {leftX, leftY},
-        mColor,
-        {0, 0}
-    });
-    
-    vertices.push_back({
-        {rightX, rightY},
-        mColor,
-        {0, 0}
-    });
-    
-    // Triangle indices
-    indices = {0, 1, 2};
-    
-    // Render the triangle
-    SDL_RenderGeometry(renderer, nullptr, 
-                        vertices.data(), static_cast<int>(vertices.size()),
-                        indices.data(), static_cast<int>(indices.size()));
-}
\ No newline at end of file
+    return offsets;
+}
@@ -32,10 +32,19 @@ SDL_Renderer* Renderer::GetSDLRenderer() const {
 }
 
 void Renderer::Clear(SDL_Color color) {
+    // Temizlemeden önce biriken şekiller zaten silinecekti
+    mBatch.Clear();
+    mLastDrawCalls = 0;
+    mShapeCache.BeginFrame();
     SDL_SetRenderDrawColor(mRenderer.Get(), color.r, color.g, color.b, color.a);
     SDL_RenderClear(mRenderer.Get());
 }
 
+void Renderer::Flush() {
+    mLastDrawCalls += mBatch.Flush(mRenderer.Get());
+}
+
 void Renderer::Present() {
+    Flush();
     SDL_RenderPresent(mRenderer.Get());
 }
@@ -0,0 +1,305 @@
+#include "replay-buffer.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+#include "registry.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define REPLAY_X86 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr size_t kHeaderWords = 2;
+constexpr size_t kOwnerWords = 2;
+constexpr size_t kTransformWords = 8;
+constexpr size_t kVelocityWords = 2;
+constexpr size_t kBlockWords = 32;
+constexpr size_t kNoSpace = std::numeric_limits<size_t>::max();
+
+uint32_t Bits(float value) {
+    return std::bit_cast<uint32_t>(value);
+}
+
+float Value(uint32_t bits) {
+    return std::bit_cast<float>(bits);
+}
+
+/**
+ * @brief count (en fazla kBlockWords) kelimeden değişenlerin bit maskesini döner.
+ */
+uint32_t ChangedMask(const uint32_t* current, const uint32_t* previous, size_t count) {
+#if defined(REPLAY_X86)
+    if (count == kBlockWords) {
+        uint32_t equal = 0;
+        for (size_t i = 0; i < kBlockWords; i += 4) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + i));
+            equal |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)))) << i;
+        }
+        return ~equal;
+    }
+#endif
+    uint32_t mask = 0;
+    for (size_t i = 0; i < count; i++) {
+        mask |= static_cast<uint32_t>(current[i] != previous[i]) << i;
+    }
+    return mask;
+}
+
+} // namespace
+
+ReplayBuffer::ReplayBuffer(uint32_t keyframeInterval, size_t capacityBytes)
+    : mKeyframeInterval(keyframeInterval), mArena(capacityBytes / sizeof(uint32_t)), mFrames(64) {
+    if (keyframeInterval == 0) {
+        throw std::runtime_error("Keyframe interval must be positive");
+    }
+    if (mArena.size() < kHeaderWords) {
+        throw std::runtime_error("Replay capacity is too small for a keyframe");
+    }
+}
+
+void ReplayBuffer::PushFrame(const Frame& frame) {
+    if (mFrameCount == mFrames.size()) {
+        std::vector<Frame> grown(mFrames.size() * 2);
+        for (size_t i = 0; i < mFrameCount; i++) {
+            grown[i] = FrameAt(i);
+        }
+        mFrames.swap(grown);
+        mFirst = 0;
+    }
+    FrameAt(mFrameCount++) = frame;
+}
+
+void ReplayBuffer::PopOldest() {
+    mFirst = (mFirst + 1) % mFrames.size();
+    mFrameCount--;
+}
+
+size_t ReplayBuffer::Allocate(size_t words) {
+    if (words > mArena.size()) {
+        return kNoSpace;
+    }
+
+    size_t offset = mHead;
+    if (offset + words > mArena.size()) {
+        // Alanın sonuna sığmıyor; başa dönülür. Baştaki konumdan sonra kalan kareler en eski karelerdir
+        while (mFrameCount > 0 && FrameAt(0).mOffset >= mHead) {
+            PopOldest();
+        }
+        offset = 0;
+    }
+
+    // Yeni karenin üzerine yazılacağı en eski kareler silinir
+    while (mFrameCount > 0 && FrameAt(0).mOffset < offset + words
+           && offset < FrameAt(0).mOffset + FrameAt(0).mSize) {
+        PopOldest();
+    }
+
+    // Anahtar karesi silinen farklar çözülemeyeceğinden en eski kare her zaman bir anahtar kare olmalıdır
+    while (mFrameCount > 0 && !FrameAt(0).mKeyframe) {
+        PopOldest();
+    }
+
+    mHead = offset + words;
+    return offset;
+}
+
+void ReplayBuffer::Capture(Registry& registry) {
+    ComponentStore& store = registry.Store();
+    auto& transforms = store.Pool<Transform>();
+    auto& velocities = store.Pool<Velocity>();
+    const size_t transformCount = transforms.Size();
+    const size_t velocityCount = velocities.Size();
+
+    // Sahipler ve değerler ayrı dizilerde durur; nesneler yer değiştirmedikçe sahip blokları hiç fark üretmez.
+    // Sahip, numarası ve kuşağıyla saklanır; böylece geri sarmada numarası yeniden kullanılmış nesnelere yazılmaz
+    mCurrent.resize(kHeaderWords + transformCount * (kOwnerWords + kTransformWords)
+                    + velocityCount * (kOwnerWords + kVelocityWords));
+    uint32_t* words = mCurrent.data();
+    words[0] = static_cast<uint32_t>(transformCount);
+    words[1] = static_cast<uint32_t>(velocityCount);
+
+    uint32_t* transformOwners = words + kHeaderWords;
+    uint32_t* velocityOwners = transformOwners + transformCount * (kOwnerWords + kTransformWords);
+    transforms.ForEach([&registry, owners = transformOwners, values = transformOwners + transformCount * kOwnerWords](
+                           ObjectId id, Transform& t) mutable {
+        *owners++ = id;
+        *owners++ = registry.EntityOf(id).mGeneration;
+        values[0] = Bits(t.mX);
+        values[1] = Bits(t.mY);
+        values[2] = Bits(t.mRotation);
+        values[3] = Bits(t.mScaleX);
+        values[4] = Bits(t.mScaleY);
+        values[5] = Bits(t.mPrevX);
+        values[6] = Bits(t.mPrevY);
+        values[7] = Bits(t.mPrevRotation);
+        values += kTransformWords;
+    });
+
+    velocities.ForEach([&registry, owners = velocityOwners, values = velocityOwners + velocityCount * kOwnerWords](
+                           ObjectId id, Velocity& v) mutable {
+        *owners++ = id;
+        *owners++ = registry.EntityOf(id).mGeneration;
+        values[0] = Bits(v.mVx);
+        values[1] = Bits(v.mVy);
+        values += kVelocityWords;
+    });
+}
+
+void ReplayBuffer::EncodeDelta() {
+    const size_t count = mCurrent.size();
+    mEncoded.clear();
+    mEncoded.reserve(count + 2 * (count / kBlockWords + 1));
+    const uint32_t* current = mCurrent.data();
+    const uint32_t* previous = mState.data();
+
+    for (size_t base = 0; base < count; base += kBlockWords) {
+        const uint32_t mask = ChangedMask(current + base, previous + base, std::min(count - base, kBlockWords));
+        if (mask == 0) {
+            continue;
+        }
+
+        mEncoded.push_back(static_cast<uint32_t>(base / kBlockWords));
+        mEncoded.push_back(mask);
+        for (uint32_t bits = mask; bits != 0; bits &= bits - 1) {
+            const size_t i = base + static_cast<size_t>(std::countr_zero(bits));
+            mEncoded.push_back(current[i] ^ previous[i]);
+        }
+    }
+}
+
+void ReplayBuffer::ApplyDelta(const uint32_t* delta, size_t size, std::vector<uint32_t>& state) {
+    const uint32_t* end = delta + size;
+    while (delta < end) {
+        const size_t base = static_cast<size_t>(delta[0]) * kBlockWords;
+        uint32_t mask = delta[1];
+        delta += 2;
+        for (; mask != 0; mask &= mask - 1) {
+            state[base + static_cast<size_t>(std::countr_zero(mask))] ^= *delta++;
+        }
+    }
+}
+
+void ReplayBuffer::Restore(Registry& registry, const std::vector<uint32_t>& state) {
+    ComponentStore& store = registry.Store();
+    const size_t transformCount = state[0];
+    const size_t velocityCount = state[1];
+
+    // Kayıttan sonra silinip numarası başka bir nesneye verilen sahipler atlanır
+    auto live = [&registry](const uint32_t* owner) {
+        return registry.IsAlive(Entity{owner[0], owner[1]});
+    };
+
+    const uint32_t* owners = state.data() + kHeaderWords;
+    const uint32_t* values = owners + transformCount * kOwnerWords;
+    for (size_t i = 0; i < transformCount; i++, owners += kOwnerWords, values += kTransformWords) {
+        Transform* t = live(owners) ? store.Get<Transform>(owners[0]) : nullptr;
+        if (t) {
+            store.MarkChanged<Transform>(owners[0]);
+            t->mX = Value(values[0]);
+            t->mY = Value(values[1]);
+            t->mRotation = Value(values[2]);
+            t->mScaleX = Value(values[3]);
+            t->mScaleY = Value(values[4]);
+            t->mPrevX = Value(values[5]);
+            t->mPrevY = Value(values[6]);
+            t->mPrevRotation = Value(values[7]);
+        }
+    }
+
+    owners = values;
+    values = owners + velocityCount * kOwnerWords;
+    for (size_t i = 0; i < velocityCount; i++, owners += kOwnerWords, values += kVelocityWords) {
+        Velocity* v = live(owners) ? store.Get<Velocity>(owners[0]) : nullptr;
+        if (v) {
+            v->mVx = Value(values[0]);
+            v->mVy = Value(values[1]);
+        }
+    }
+}
+
+uint64_t ReplayBuffer::Record(Registry& registry) {
+    const uint64_t tick = mNextTick++;
+    Capture(registry);
+
+    bool keyframe = mFrameCount == 0 || mCurrent.size() != mState.size()
+                 || mTicksSinceKeyframe + 1 >= mKeyframeInterval;
+    if (!keyframe) {
+        EncodeDelta();
+    }
+
+    size_t offset = Allocate(keyframe ? mCurrent.size() : mEncoded.size());
+
+    // Yer açılırken farkın dayandığı anahtar kare de silindiyse bu adım anahtar kare olarak yazılır
+    if (offset != kNoSpace && !keyframe && mFrameCount == 0) {
+        keyframe = true;
+        mHead = 0;
+        offset = Allocate(mCurrent.size());
+    }
+
+    if (offset == kNoSpace) {
+        mDroppedTicks++;
+        mFrameCount = 0;
+        mHead = 0;
+        mState.swap(mCurrent);
+        return tick;
+    }
+
+    const std::vector<uint32_t>& source = keyframe ? mCurrent : mEncoded;
+    std::copy(source.begin(), source.end(), mArena.begin() + static_cast<std::ptrdiff_t>(offset));
+    PushFrame(Frame{tick, offset, source.size(), keyframe});
+    mTicksSinceKeyframe = keyframe ? 0 : mTicksSinceKeyframe + 1;
+
+    mState.swap(mCurrent);
+    return tick;
+}
+
+bool ReplayBuffer::Seek(Registry& registry, uint64_t tick) {
+    if (Empty() || tick < OldestTick() || tick > NewestTick()) {
+        return false;
+    }
+
+    const auto index = static_cast<size_t>(tick - OldestTick());
+    size_t keyIndex = index;
+    while (!FrameAt(keyIndex).mKeyframe) {
+        keyIndex--;
+    }
+
+    const Frame& key = FrameAt(keyIndex);
+    mCurrent.assign(mArena.begin() + static_cast<std::ptrdiff_t>(key.mOffset),
+                    mArena.begin() + static_cast<std::ptrdiff_t>(key.mOffset + key.mSize));
+    for (size_t i = keyIndex + 1; i <= index; i++) {
+        const Frame& frame = FrameAt(i);
+        ApplyDelta(mArena.data() + frame.mOffset, frame.mSize, mCurrent);
+    }
+    Restore(registry, mCurrent);
+
+    // Geri sarılan adımdan sonraki kareler artık geçersiz bir geleceğe aittir
+    const Frame& newest = FrameAt(index);
+    mFrameCount = index + 1;
+    mHead = newest.mOffset + newest.mSize;
+    mNextTick = tick + 1;
+    mTicksSinceKeyframe = static_cast<uint32_t>(index - keyIndex);
+    mState.swap(mCurrent);
+    return true;
+}
+
+size_t ReplayBuffer::KeyframeBytes(Registry& registry) {
+    ComponentStore& store = registry.Store();
+    const size_t words = kHeaderWords + store.Pool<Transform>().Size() * (kOwnerWords + kTransformWords)
+                       + store.Pool<Velocity>().Size() * (kOwnerWords + kVelocityWords);
+    return words * sizeof(uint32_t);
+}
+
+size_t ReplayBuffer::UsedBytes() const {
+    size_t words = 0;
+    for (size_t i = 0; i < mFrameCount; i++) {
+        words += FrameAt(i).mSize;
+    }
+    return words * sizeof(uint32_t);
+}
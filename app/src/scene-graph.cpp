@@ -0,0 +1,262 @@
+#include "scene-graph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Affine2D Affine2D::FromTransform(const Transform& transform) {
+    const float cosR = std::cos(transform.mRotation);
+    const float sinR = std::sin(transform.mRotation);
+    return Affine2D{
+        cosR * transform.mScaleX, -sinR * transform.mScaleY,
+        sinR * transform.mScaleX, cosR * transform.mScaleY,
+        transform.mX, transform.mY
+    };
+}
+
+Affine2D Affine2D::operator*(const Affine2D& local) const {
+    return Affine2D{
+        m00 * local.m00 + m01 * local.m10, m00 * local.m01 + m01 * local.m11,
+        m10 * local.m00 + m11 * local.m10, m10 * local.m01 + m11 * local.m11,
+        m00 * local.tx + m01 * local.ty + tx, m10 * local.tx + m11 * local.ty + ty
+    };
+}
+
+void Affine2D::Decompose(Transform& transform) const {
+    transform.mX = tx;
+    transform.mY = ty;
+    transform.mRotation = std::atan2(m10, m00);
+    transform.mScaleX = std::sqrt(m00 * m00 + m10 * m10);
+    transform.mScaleY = std::sqrt(m01 * m01 + m11 * m11);
+}
+
+void SceneGraph::EnsureCapacity(ObjectId id) {
+    if (id >= mParentOf.size()) {
+        const size_t size = static_cast<size_t>(id) + 1;
+        mParentOf.resize(size, kInvalidObjectId);
+        mFirstChild.resize(size, kInvalidObjectId);
+        mNextSibling.resize(size, kInvalidObjectId);
+    }
+}
+
+void SceneGraph::Unlink(ObjectId child) {
+    const ObjectId parent = mParentOf[child];
+    if (parent == kInvalidObjectId) {
+        return;
+    }
+
+    if (mFirstChild[parent] == child) {
+        mFirstChild[parent] = mNextSibling[child];
+    } else {
+        ObjectId sibling = mFirstChild[parent];
+        while (mNextSibling[sibling] != child) {
+            sibling = mNextSibling[sibling];
+        }
+        mNextSibling[sibling] = mNextSibling[child];
+    }
+
+    mParentOf[child] = kInvalidObjectId;
+    mNextSibling[child] = kInvalidObjectId;
+    mStructureChanged = true;
+}
+
+void SceneGraph::Attach(ObjectId child, ObjectId parent) {
+    if (child == parent) {
+        throw std::runtime_error("An object cannot be its own parent");
+    }
+
+    EnsureCapacity(std::max(child, parent));
+    for (ObjectId ancestor = parent; ancestor != kInvalidObjectId; ancestor = mParentOf[ancestor]) {
+        if (ancestor == child) {
+            throw std::runtime_error("Attaching would create a cycle in the scene graph");
+        }
+    }
+
+    Unlink(child);
+    mParentOf[child] = parent;
+    mNextSibling[child] = mFirstChild[parent];
+    mFirstChild[parent] = child;
+    mStructureChanged = true;
+}
+
+void SceneGraph::Detach(ObjectId child) {
+    if (child < mParentOf.size()) {
+        Unlink(child);
+    }
+}
+
+void SceneGraph::Remove(ObjectId id) {
+    if (id >= mParentOf.size()) {
+        return;
+    }
+
+    Unlink(id);
+    while (mFirstChild[id] != kInvalidObjectId) {
+        Unlink(mFirstChild[id]);
+    }
+}
+
+ObjectId SceneGraph::GetParent(ObjectId id) const {
+    return id < mParentOf.size() ? mParentOf[id] : kInvalidObjectId;
+}
+
+bool SceneGraph::IsNode(ObjectId id) const {
+    return id < mParentOf.size() && (mParentOf[id] != kInvalidObjectId || mFirstChild[id] != kInvalidObjectId);
+}
+
+void SceneGraph::CollectDescendants(ObjectId id, std::vector<ObjectId>& out) const {
+    if (id >= mFirstChild.size()) {
+        return;
+    }
+
+    const size_t begin = out.size();
+    for (ObjectId child = mFirstChild[id]; child != kInvalidObjectId; child = mNextSibling[child]) {
+        out.push_back(child);
+    }
+    for (size_t i = begin; i < out.size(); i++) {
+        for (ObjectId child = mFirstChild[out[i]]; child != kInvalidObjectId; child = mNextSibling[child]) {
+            out.push_back(child);
+        }
+    }
+}
+
+void SceneGraph::Rebuild() {
+    mOrder.clear();
+    mParentPosition.clear();
+    mChildBegin.clear();
+    mChildCount.clear();
+    mPosition.assign(mParentOf.size(), kNoPosition);
+
+    // Önce tüm kökler, ardından her seviye bir öncekinin hemen arkasına yerleştirilir
+    for (ObjectId id = 0; id < static_cast<ObjectId>(mParentOf.size()); id++) {
+        if (mParentOf[id] == kInvalidObjectId && mFirstChild[id] != kInvalidObjectId) {
+            mPosition[id] = static_cast<uint32_t>(mOrder.size());
+            mOrder.push_back(id);
+            mParentPosition.push_back(kNoPosition);
+        }
+    }
+
+    for (size_t i = 0; i < mOrder.size(); i++) {
+        const auto begin = static_cast<uint32_t>(mOrder.size());
+        for (ObjectId child = mFirstChild[mOrder[i]]; child != kInvalidObjectId; child = mNextSibling[child]) {
+            mPosition[child] = static_cast<uint32_t>(mOrder.size());
+            mOrder.push_back(child);
+            mParentPosition.push_back(static_cast<uint32_t>(i));
+        }
+        mChildBegin.push_back(begin);
+        mChildCount.push_back(static_cast<uint32_t>(mOrder.size()) - begin);
+    }
+
+    // Yeni düzende tüm düğümler bir kez hesaplanır
+    const size_t count = mOrder.size();
+    mWorld.assign(count, Affine2D{});
+    mTeleported.assign(count, 0);
+    mStamp.assign(count, 0);
+    mFrame = 0;
+    mStructureChanged = false;
+}
+
+void SceneGraph::Recompute(ComponentStore& store, uint32_t position, bool rebuilt) {
+    const ObjectId id = mOrder[position];
+    Transform* transform = store.Get<Transform>(id);
+    const uint32_t parent = mParentPosition[position];
+
+    // Kendisi ya da bu adımda hesaplanan ebeveyni ışınlanan düğüm ara değer almaz
+    bool teleported = transform && transform->mTeleported;
+    if (parent != kNoPosition && mStamp[parent] == mFrame) {
+        teleported = teleported || mTeleported[parent];
+    }
+    mTeleported[position] = teleported;
+    mStamp[position] = mFrame;
+
+    if (transform) {
+        transform->mTeleported = false;
+    }
+
+    const Affine2D localMatrix = transform ? Affine2D::FromTransform(*transform) : Affine2D{};
+    mWorld[position] = parent == kNoPosition ? localMatrix : mWorld[parent] * localMatrix;
+
+    if (parent != kNoPosition) {
+        if (auto* world = store.Get<WorldTransform>(id)) {
+            mWorld[position].Decompose(*world);
+            store.MarkChanged<WorldTransform>(id);
+            if (teleported || rebuilt) {
+                world->SnapshotPrevious();
+            } else {
+                mMoved.push_back(id);
+            }
+        }
+    }
+}
+
+void SceneGraph::RecomputeDirty(ComponentStore& store) {
+    mDirty.clear();
+    for (ObjectId id : mChanges.Ids()) {
+        if (id < mPosition.size() && mPosition[id] != kNoPosition) {
+            mDirty.push_back(mPosition[id]);
+        }
+    }
+    mChanges.Clear();
+    std::sort(mDirty.begin(), mDirty.end());
+
+    // Konumlar artan sırada işlenir. Bir düğümün çocukları art arda ve ebeveynlerin sırasıyla yerleştirildiğinden
+    // kuyruğa eklenen çocuk aralıkları da artan sıradadır; iki sıralı dizi birleştirilerek ebeveyn her zaman
+    // çocuklarından önce hesaplanır ve zaten hesaplanmış düğümler damgasıyla atlanır
+    mFrontier.clear();
+    size_t dirty = 0;
+    size_t frontier = 0;
+    while (dirty < mDirty.size() || frontier < mFrontier.size()) {
+        uint32_t position;
+        if (frontier < mFrontier.size() && (dirty == mDirty.size() || mFrontier[frontier] <= mDirty[dirty])) {
+            position = mFrontier[frontier++];
+        } else {
+            position = mDirty[dirty++];
+        }
+
+        if (mStamp[position] == mFrame) {
+            continue;
+        }
+        Recompute(store, position, false);
+
+        const uint32_t childEnd = mChildBegin[position] + mChildCount[position];
+        for (uint32_t child = mChildBegin[position]; child < childEnd; child++) {
+            mFrontier.push_back(child);
+        }
+    }
+}
+
+void SceneGraph::Update(ComponentStore& store) {
+    if (!mChanges.IsTracking()) {
+        store.Track<Transform>(mChanges);
+    }
+
+    const bool rebuilt = mStructureChanged;
+    if (rebuilt) {
+        Rebuild();
+    }
+
+    // Önceki adımda değişen dünya dönüşümleri, ara değer için önceki değer olarak saklanır
+    for (ObjectId id : mMoved) {
+        if (auto* world = store.Get<WorldTransform>(id)) {
+            world->SnapshotPrevious();
+        }
+    }
+    mMoved.clear();
+    mFrame++;
+
+    if (rebuilt) {
+        mChanges.Clear();
+        for (uint32_t position = 0; position < mOrder.size(); position++) {
+            Recompute(store, position, true);
+        }
+        return;
+    }
+    RecomputeDirty(store);
+}
+
+const Affine2D* SceneGraph::GetWorldMatrix(ObjectId id) const {
+    if (id >= mPosition.size() || mPosition[id] == kNoPosition) {
+        return nullptr;
+    }
+    return &mWorld[mPosition[id]];
+}
@@ -1,10 +1,16 @@
 #include "sdl-application.h"
+#include "particle-system.h"
+#include "physics-system.h"
+#include "render-strategies.h"
+
+#include <cmath>
+#include <thread>
 
 Sdl3Application::Sdl3Application() 
     : mLastTime(std::chrono::high_resolution_clock::now()) { 
 }
 
-bool Sdl3Application::Initialize() {
+bool Sdl3Application::Initialize(const std::string& scenePath) {
     if (!SDL_Init(SDL_INIT_VIDEO)) {
         std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
         return false;
@@ -31,15 +37,59 @@ bool Sdl3Application::Initialize() {
     Renderer::Initialize(renderer);
 
     mEventSubject.AddObserver(this);
+
+    mScheduler.AddSystem(std::make_unique<TransformSnapshotSystem>());
+    mScheduler.AddSystem(std::make_unique<ComponentUpdateSystem>());
+    mScheduler.AddSystem(std::make_unique<MovementSystem>(800.0f, 600.0f));
+    mScheduler.AddSystem(std::make_unique<PhysicsSystem>(IntegrationMethod::VelocityVerlet));
+    mScheduler.AddSystem(std::make_unique<SceneGraphSystem>());
+    mScheduler.AddSystem(std::make_unique<ParticleSystem>());
+    mScheduler.AddSystem(std::make_unique<SpatialGridSystem>());
+    mScheduler.AddSystem(std::make_unique<CollisionSystem>());
     
-    mGraphicalObjects.push_back(GraphicalObjectFactory::CreateRectangle(400, 300));
-    mGraphicalObjects.push_back(GraphicalObjectFactory::CreateCircle(100, 100));
-    mGraphicalObjects.push_back(GraphicalObjectFactory::CreateTriangle(300, 50));   
+    if (!scenePath.empty()) {
+        try {
+            std::vector<Entity> entities = WorldSnapshot::Load(mRegistry, scenePath);
+            mPlayer = entities.empty() ? Entity{} : entities.front();
+        } catch (const std::runtime_error& error) {
+            std::cerr << "Scene loading failed: " << error.what() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    mPlayer = GraphicalObjectFactory::CreateRectangle(mRegistry, 400, 300);
+    Entity circle = GraphicalObjectFactory::CreateCircle(mRegistry, 100, 100);
+    Entity triangle = GraphicalObjectFactory::CreateTriangle(mRegistry, 300, 50);   
+
+    // Çarpışma şekilleri çizilen şekillerden alınır
+    for (Entity entity : {mPlayer, circle, triangle}) {
+        GraphicalObject* object = mRegistry.Get(entity);
+        object->AddComponent<Collider>(object->GetComponent<RenderComponent>()->GetStrategy()->GetShape());
+    }
+
+    // Daire yukarı doğru kıvılcım saçar
+    ParticleEmitterSettings sparks;
+    sparks.mRate = 600.0f;
+    sparks.mMaxParticles = 2048;
+    sparks.mDirection = -1.5707963f;
+    sparks.mSpread = 1.0f;
+    sparks.mMinSpeed = 80.0f;
+    sparks.mMaxSpeed = 160.0f;
+    sparks.mGravityY = 200.0f;
+    sparks.mStartColor = SDL_FColor{1.0f, 0.8f, 0.2f, 1.0f};
+    sparks.mEndColor = SDL_FColor{1.0f, 0.1f, 0.0f, 0.0f};
+    mRegistry.Get(circle)->AddComponent<ParticleEmitter>(sparks);
     
     return true;
 }
 
 void Sdl3Application::Run() {
+    if (mThreadedSimulation) {
+        RunThreaded();
+        return;
+    }
+
     while (mRunning) {
         HandleEvents();
         Update();
@@ -47,6 +97,74 @@ void Sdl3Application::Run() {
     }
 }
 
+void Sdl3Application::RunThreaded() {
+    mLastTime = std::chrono::high_resolution_clock::now();
+    std::thread simulation([this]() { SimulationLoop(); });
+
+    while (mRunning) {
+        HandleEvents();
+        RenderSnapshotFrame();
+    }
+
+    simulation.join();
+}
+
+void Sdl3Application::SimulationLoop() {
+    PublishSnapshot();
+
+    while (mRunning) {
+        {
+            std::lock_guard<std::mutex> lock(mPendingKeysMutex);
+            mHandledKeys.swap(mPendingKeys);
+        }
+        for (const SDL_KeyboardEvent& key : mHandledKeys) {
+            HandleKeyDown(key);
+        }
+        const bool keysHandled = !mHandledKeys.empty();
+        mHandledKeys.clear();
+
+        if (Update() > 0 || keysHandled) {
+            PublishSnapshot();
+            continue;
+        }
+
+        // Bir sonraki adımın zamanı gelene kadar beklenir
+        const double remaining = mTimestep.StepSeconds() * (1.0 - mTimestep.Alpha());
+        std::this_thread::sleep_for(std::chrono::duration<double>(remaining));
+    }
+}
+
+void Sdl3Application::PublishSnapshot() {
+    const Aabb viewport{0.0f, 0.0f, static_cast<float>(mViewportWidth.load(std::memory_order_relaxed)),
+                        static_cast<float>(mViewportHeight.load(std::memory_order_relaxed))};
+    mCuller.Update(mRegistry);
+
+    RenderSnapshot& snapshot = mSnapshots.Back();
+    snapshot.Capture(mRegistry, mCuller.Query(viewport));
+    snapshot.mTick = mTimestep.TickCount();
+    snapshot.mAlpha = mTimestep.Alpha();
+    snapshot.mStepSeconds = mTimestep.StepSeconds();
+    snapshot.mPublishTime = std::chrono::steady_clock::now();
+    mSnapshots.Publish();
+}
+
+void Sdl3Application::RenderSnapshotFrame() {
+    auto& renderer = Renderer::Instance();
+
+    int width = 0;
+    int height = 0;
+    SDL_GetRenderOutputSize(renderer.GetSDLRenderer(), &width, &height);
+    mViewportWidth.store(width, std::memory_order_relaxed);
+    mViewportHeight.store(height, std::memory_order_relaxed);
+
+    mSnapshots.Acquire();
+    const RenderSnapshot& snapshot = mSnapshots.Front();
+
+    renderer.Clear({30, 30, 30, 255}); // Dark gray background
+    snapshot.Draw(renderer, snapshot.AlphaAt(std::chrono::steady_clock::now()), mRenderQueue);
+    renderer.Present();
+}
+
 void Sdl3Application::Shutdown() {
     Renderer::Shutdown();
     SDL_Quit();
@@ -58,10 +176,20 @@ void Sdl3Application::OnEvent(const SDL_Event& event) {
     }
     
     if (event.type == SDL_EVENT_KEY_DOWN) {
-        HandleKeyDown(event.key);
+        if (mThreadedSimulation) {
+            std::lock_guard<std::mutex> lock(mPendingKeysMutex);
+            mPendingKeys.push_back(event.key);
+        } else {
+            HandleKeyDown(event.key);
+        }
     }
 }
 
+void Sdl3Application::SetTickRate(double ticksPerSecond, uint32_t maxStepsPerFrame) {
+    mTimestep.SetTickRate(ticksPerSecond);
+    mTimestep.SetMaxStepsPerFrame(maxStepsPerFrame);
+}
+
 void Sdl3Application::HandleEvents() {
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
@@ -70,8 +198,8 @@ void Sdl3Application::HandleEvents() {
 }
 
 void Sdl3Application::HandleKeyDown(const SDL_KeyboardEvent& key) {
-    auto rectangleObj = mGraphicalObjects[0].get(); // First object is rectangleObj
-    auto* velocity = rectangleObj->GetComponent<Velocity>();
+    auto* rectangleObj = mRegistry.Get(mPlayer);
+    auto* velocity = rectangleObj ? rectangleObj->GetComponent<Velocity>() : nullptr;
     
     if (!velocity) 
         return;
@@ -99,45 +227,72 @@ void Sdl3Application::HandleKeyDown(const SDL_KeyboardEvent& key) {
             velocity->mVx = speed; 
             break;
 
+        case SDL_SCANCODE_BACKSPACE: {
+            // Simülasyon en fazla bir saniye öncesine geri sarılır ve oradan yeniden çalışır
+            const auto oneSecond = static_cast<uint64_t>(std::lround(1.0f / mTimestep.StepSeconds()));
+            const uint64_t newest = mReplay.NewestTick();
+            mReplay.Seek(mRegistry, newest - std::min(newest - mReplay.OldestTick(), oneSecond));
+            break;
+        }
+
         case SDL_SCANCODE_ESCAPE: 
             mRunning = false; 
             break;
     }
 }
 
-void Sdl3Application::Update() {
+uint32_t Sdl3Application::Update() {
     auto currentTime = std::chrono::high_resolution_clock::now();
-    float deltaTime = std::chrono::duration<float>(currentTime - mLastTime).count();
+    double frameSeconds = std::chrono::duration<double>(currentTime - mLastTime).count();
     mLastTime = currentTime;
     
-    // Update all game objects
-    for (auto& obj : mGraphicalObjects) {
-        obj->Update(deltaTime);
-        
-        // Simple movement system
-        auto* transform = obj->GetComponent<Transform>();
-        auto* velocity = obj->GetComponent<Velocity>();
-        
-        if (transform && velocity) {
-            transform->mX += velocity->mVx * deltaTime;
-            transform->mY += velocity->mVy * deltaTime;
-            
-            // Simple boundary wrapping
-            if (transform->mX < 0) transform->mX = 800;
-            if (transform->mX > 800) transform->mX = 0;
-            if (transform->mY < 0) transform->mY = 600;
-            if (transform->mY > 600) transform->mY = 0;
+    // Simulasyon kare hizindan bagimsiz olarak sabit adimlarla ilerletilir
+    const uint32_t steps = mTimestep.Advance(frameSeconds);
+    for (uint32_t i = 0; i < steps; i++) {
+        // Sistemler, cakismayanlar paralel calisacak sekilde zamanlayici tarafindan calistirilir
+        mScheduler.Run(mRegistry, mTimestep.StepSeconds());
+
+        // Anahtar kare bir kez sığmadığında dünya büyümüş demektir; her adımda boşuna görüntü alınmaması için kayıt durur
+        if (mReplay.DroppedTicks() > 0) {
+            continue;
+        }
+        mReplay.Record(mRegistry);
+        if (mReplay.DroppedTicks() > 0) {
+            std::cerr << "Replay capacity (" << mReplay.CapacityBytes() << " bytes) is too small for a "
+                      << ReplayBuffer::KeyframeBytes(mRegistry) << " byte keyframe; rewinding is disabled" << std::endl;
         }
     }
+    return steps;
 }
 
 void Sdl3Application::Render() {
     auto& renderer = Renderer::Instance();
     renderer.Clear({30, 30, 30, 255}); // Dark gray background
+    renderer.SetInterpolationAlpha(mTimestep.Alpha());
     
-    for (auto& obj : mGraphicalObjects) {
-        obj->Render(renderer); // Strategy pattern çalışıyor!
+    // Yalnizca pencereyle kesisen nesneler cizime gonderilir
+    int width = 0;
+    int height = 0;
+    SDL_GetRenderOutputSize(renderer.GetSDLRenderer(), &width, &height);
+    mCuller.Update(mRegistry);
+
+    // Gorunur nesneler katman ve cizim durumuna gore siralanip toplayiciya eklenir
+    ComponentStore& store = mRegistry.Store();
+    mRenderQueue.Clear();
+    for (ObjectId id : mCuller.Query(Aabb{0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)})) {
+        const RenderComponent* render = store.Get<RenderComponent>(id);
+        if (render && render->GetStrategy() && render->GetBoundTransform()) {
+            mRenderQueue.Push(render->GetStrategy().get(), render->GetBoundTransform()->Interpolated(mTimestep.Alpha()),
+                              render->GetLayer());
+        }
     }
+    mRenderQueue.Sort();
+    mRenderQueue.Submit(renderer);
+
+    // Biriken sekiller tek cagri ile cizilir, parcaciklar onlarin ustune ayri bir cagri ile gonderilir
+    renderer.Flush();
+    ParticleSystem::BuildVertices(mRegistry.Store(), mTimestep.Alpha(), mParticleVertices);
+    ParticleSystem::Draw(renderer.GetSDLRenderer(), mParticleVertices);
     
     renderer.Present();
 }
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "shape-texture-cache.h"
+
+#include <algorithm>
+
+ShapeTextureCache::ShapeTextureCache(size_t budget)
+    : mBudget(budget) {
+}
+
+SDL_Texture* ShapeTextureCache::Acquire(SDL_Renderer* renderer, ShapeType type, int32_t width, int32_t height,
+                                        SDL_Color color) {
+    if (width <= 0 || height <= 0 || width > kMaxSide || height > kMaxSide) {
+        return nullptr;
+    }
+
+    const uint64_t key = MakeKey(type, width, height, color);
+    auto found = mEntries.find(key);
+    if (found != mEntries.end()) {
+        Entry& entry = found->second;
+        entry.mLastFrame = mFrame;
+        mOrder.splice(mOrder.begin(), mOrder, entry.mOrder);
+        mHits++;
+        return entry.mTexture.Get();
+    }
+
+    const size_t bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(SDL_Color);
+    if (!renderer || bytes > mBudget || !Rasterize(type, width, height, color, mPixels)) {
+        return nullptr;
+    }
+
+    SDLTexture texture(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height));
+    if (!texture || !SDL_UpdateTexture(texture.Get(), nullptr, mPixels.data(),
+                                       width * static_cast<int>(sizeof(SDL_Color)))) {
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture.Get(), SDL_BLENDMODE_BLEND);
+    mMisses++;
+
+    mOrder.push_front(key);
+    SDL_Texture* result = texture.Get();
+    mEntries.emplace(key, Entry{std::move(texture), bytes, mFrame, mOrder.begin()});
+    mBytes += bytes;
+    Evict();
+    return result;
+}
+
+void ShapeTextureCache::SetBudget(size_t budget) {
+    mBudget = budget;
+    Evict();
+}
+
+void ShapeTextureCache::Clear() {
+    mEntries.clear();
+    mOrder.clear();
+    mBytes = 0;
+}
+
+void ShapeTextureCache::Evict() {
+    while (mBytes > mBudget && !mOrder.empty()) {
+        auto found = mEntries.find(mOrder.back());
+
+        // Liste kullanim sirasinda oldugundan en eskisi bu karede kullanildiysa digerleri de kullanilmistir
+        if (found->second.mLastFrame == mFrame) {
+            break;
+        }
+
+        mBytes -= found->second.mBytes;
+        mEntries.erase(found);
+        mOrder.pop_back();
+    }
+}
+
+uint64_t ShapeTextureCache::MakeKey(ShapeType type, int32_t width, int32_t height, SDL_Color color) {
+    // tur (8 bit) | genislik (12 bit) | yukseklik (12 bit) | RGBA (32 bit); boyutlar kMaxSide ile sinirlidir
+    const uint32_t rgba = (static_cast<uint32_t>(color.r) << 24) | (static_cast<uint32_t>(color.g) << 16) |
+                          (static_cast<uint32_t>(color.b) << 8) | color.a;
+    return (static_cast<uint64_t>(type) << 56) | (static_cast<uint64_t>(width & 0xFFF) << 44) |
+           (static_cast<uint64_t>(height & 0xFFF) << 32) | rgba;
+}
+
+bool ShapeTextureCache::Rasterize(ShapeType type, int32_t width, int32_t height, SDL_Color color,
+                                  std::vector<SDL_Color>& pixels) {
+    pixels.assign(static_cast<size_t>(width) * static_cast<size_t>(height), SDL_Color{0, 0, 0, 0});
+
+    switch (type) {
+        case ShapeType::Rectangle:
+            std::fill(pixels.begin(), pixels.end(), color);
+            return true;
+
+        case ShapeType::Circle: {
+            // Dairenin kapsadigi pikseller CircleRenderer ile ayni satir araliklarindan alinir
+            std::vector<SDL_FRect> spans;
+            const int32_t radiusX = (width - 1) / 2;
+            const int32_t radiusY = (height - 1) / 2;
+            CircleRenderer::BuildSpans(radiusX, radiusY, radiusX, radiusY, spans);
+            for (const SDL_FRect& span : spans) {
+                SDL_Color* row = pixels.data() + static_cast<size_t>(span.y) * static_cast<size_t>(width);
+                std::fill(row + static_cast<size_t>(span.x), row + static_cast<size_t>(span.x + span.w), color);
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
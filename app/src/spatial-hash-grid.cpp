@@ -0,0 +1,137 @@
+#include "spatial-hash-grid.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "job-system.h"
+#include "registry.h"
+
+namespace {
+
+constexpr size_t kGrainSize = 16384;
+
+// Kova sayısı belirlenirken kova başına hedeflenen ortalama nokta sayısı
+constexpr size_t kPointsPerBucket = 4;
+
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize, uint32_t minBucketCount)
+    : mCellSize(cellSize), mInverseCellSize(0.0f), mMinBucketCount(std::bit_ceil(std::max(minBucketCount, 1u))) {
+    if (!(cellSize > 0.0f)) {
+        throw std::runtime_error("Spatial hash cell size must be positive");
+    }
+    mInverseCellSize = 1.0f / cellSize;
+}
+
+void SpatialHashGrid::Clear() {
+    mInPoints.clear();
+}
+
+void SpatialHashGrid::Insert(Entity entity, float x, float y) {
+    mInPoints.push_back(Point{x, y, entity});
+}
+
+void SpatialHashGrid::PrepareKeys(size_t count) {
+    // Kova sayısı nokta sayısına göre büyür, böylece kova başına düşen nokta sayısı sınırlı kalır
+    const auto wanted = static_cast<uint32_t>(std::max<size_t>(count / kPointsPerBucket, 1));
+    mBucketMask = std::max(mMinBucketCount, std::bit_ceil(wanted)) - 1;
+    mInBucket.resize(count);
+}
+
+void SpatialHashGrid::ComputeKeys(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+        mInBucket[i] = BucketOf(CellCoord(mInPoints[i].mX), CellCoord(mInPoints[i].mY));
+    }
+}
+
+void SpatialHashGrid::Build() {
+    const size_t count = mInPoints.size();
+
+    PrepareKeys(count);
+    ComputeKeys(0, count);
+    Sort();
+}
+
+void SpatialHashGrid::Build(Registry& registry, JobSystem* jobs) {
+    ComponentStore& store = registry.Store();
+    // Paralel aşamada çalışabildiğinden havuzlar oluşturulmaz, yalnızca aranır
+    const ComponentPool<Transform>* transforms = store.FindPool<Transform>();
+    const ComponentPool<WorldTransform>* worldTransforms = store.FindPool<WorldTransform>();
+    const bool hasHierarchy = worldTransforms && worldTransforms->Size() > 0;
+    const size_t count = transforms ? transforms->Size() : 0;
+
+    mInPoints.resize(count);
+    PrepareKeys(count);
+
+    // Her parça kendi aralığına yazdığından toplama ve anahtar hesabı eş zamanlı yapılabilir
+    auto gather = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const ObjectId id = transforms->OwnerAt(static_cast<uint32_t>(i));
+            const Transform* transform = &transforms->At(static_cast<uint32_t>(i));
+            if (hasHierarchy) {
+                if (const WorldTransform* world = worldTransforms->Get(id)) {
+                    transform = world;
+                }
+            }
+            mInPoints[i].mX = transform->mX;
+            mInPoints[i].mY = transform->mY;
+            mInPoints[i].mEntity = registry.EntityOf(id);
+        }
+        ComputeKeys(begin, end);
+    };
+
+    if (jobs) {
+        jobs->ParallelFor(count, kGrainSize, gather);
+    } else {
+        gather(0, count);
+    }
+
+    Sort();
+}
+
+void SpatialHashGrid::Sort() {
+    const size_t count = mInPoints.size();
+    const size_t bucketCount = static_cast<size_t>(mBucketMask) + 1;
+
+    // Kova başına nokta sayısı, ardından kapsayıcı ön ek toplamı ile her kovanın bitişi bulunur
+    mBucketStart.assign(bucketCount + 1, 0);
+    for (size_t i = 0; i < count; i++) {
+        mBucketStart[mInBucket[i]]++;
+    }
+    uint32_t running = 0;
+    for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+        running += mBucketStart[bucket];
+        mBucketStart[bucket] = running;
+    }
+    mBucketStart[bucketCount] = running;
+
+    mPoints.resize(count);
+
+    // Sondan başa yerleştirme sıralamayı kararlı tutar ve bitişleri başlangıçlara çevirir
+    for (size_t i = count; i-- > 0;) {
+        mPoints[--mBucketStart[mInBucket[i]]] = mInPoints[i];
+    }
+}
+
+size_t SpatialHashGrid::QueryRadius(float x, float y, float radius, std::span<Entity> out) const {
+    size_t found = 0;
+    ForEachInRadius(x, y, radius, [&](Entity entity) {
+        if (found < out.size()) {
+            out[found] = entity;
+        }
+        found++;
+    });
+    return found;
+}
+
+size_t SpatialHashGrid::QueryBox(float minX, float minY, float maxX, float maxY, std::span<Entity> out) const {
+    size_t found = 0;
+    ForEachInBox(minX, minY, maxX, maxY, [&](Entity entity) {
+        if (found < out.size()) {
+            out[found] = entity;
+        }
+        found++;
+    });
+    return found;
+}
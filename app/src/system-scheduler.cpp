@@ -0,0 +1,166 @@
+#include "system-scheduler.h"
+
+#include <exception>
+
+#include "registry.h"
+
+SystemScheduler::SystemScheduler(JobSystem& jobs)
+    : mJobs(jobs) {
+}
+
+bool SystemScheduler::Conflicts(const System& first, const System& second) {
+    return (first.Writes() & (second.Reads() | second.Writes())) != 0
+        || (second.Writes() & first.Reads()) != 0;
+}
+
+System& SystemScheduler::AddSystem(std::unique_ptr<System> system) {
+    System* added = system.get();
+    mSystems.push_back(std::move(system));
+
+    // Sistem, kendisiyle çakışan son sistemin bulunduğu aşamadan sonraki ilk aşamaya yerleşir
+    size_t stageIndex = 0;
+    for (size_t i = mStages.size(); i > 0; i--) {
+        bool conflicts = false;
+        for (const System* other : mStages[i - 1]) {
+            conflicts = conflicts || Conflicts(*added, *other);
+        }
+
+        if (conflicts) {
+            stageIndex = i;
+            break;
+        }
+    }
+
+    if (stageIndex == mStages.size()) {
+        mStages.emplace_back();
+    }
+    mStages[stageIndex].push_back(added);
+    return *added;
+}
+
+void SystemScheduler::Run(Registry& registry, float deltaTime) {
+    for (auto& stage : mStages) {
+        if (stage.size() == 1) {
+            stage.front()->Run(registry, mJobs, deltaTime);
+            continue;
+        }
+
+        WaitGroup group;
+        for (size_t i = 1; i < stage.size(); i++) {
+            System* system = stage[i];
+            mJobs.Submit(group, [system, &registry, this, deltaTime]() {
+                system->Run(registry, mJobs, deltaTime);
+            });
+        }
+
+        // Diğer sistemler bitmeden gruptan çıkılmaması için ilk sistemin istisnası bekleme sonrasına ertelenir
+        std::exception_ptr error;
+        try {
+            stage.front()->Run(registry, mJobs, deltaTime);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        mJobs.Wait(group);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Eşitleme noktası: sistemlerin kaydettiği yapısal değişiklikler tek geçişte uygulanır
+    registry.Commands().Apply(registry);
+}
+
+namespace {
+
+bool LocalTransformChanged(const Transform& before, const Transform& after) {
+    return before.mX != after.mX || before.mY != after.mY || before.mRotation != after.mRotation
+        || before.mScaleX != after.mScaleX || before.mScaleY != after.mScaleY
+        || before.mTeleported != after.mTeleported;
+}
+
+} // namespace
+
+void ComponentUpdateSystem::Run(Registry& registry, JobSystem&, float deltaTime) {
+    ComponentStore& store = registry.Store();
+    const ComponentPool<Transform>* transforms = store.FindPool<Transform>();
+    if (!transforms || !transforms->IsTracked()) {
+        registry.ForEach([deltaTime](GraphicalObject& object) {
+            object.Update(deltaTime);
+        });
+        return;
+    }
+
+    // Bileşenlerin Update'i dönüşüme yazabilir; hangi bileşenin yazdığı bilinmediğinden dönüşüm çağrıdan önceki
+    // haliyle karşılaştırılır ve değiştiyse izleyenlere bildirilir. Karşılaştırma, nesneler zaten tek tek
+    // gezildiğinden sisteme ek bir geçiş eklemez
+    registry.ForEach([&store, deltaTime](GraphicalObject& object) {
+        const Transform* transform = object.GetComponent<Transform>();
+        if (!transform) {
+            object.Update(deltaTime);
+            return;
+        }
+
+        const Transform before = *transform;
+        object.Update(deltaTime);
+        if (LocalTransformChanged(before, *transform)) {
+            store.MarkChanged<Transform>(object.GetId());
+        }
+    });
+}
+
+ComponentMask TransformSnapshotSystem::Reads() const {
+    return ComponentMaskOf<Transform>();
+}
+
+ComponentMask TransformSnapshotSystem::Writes() const {
+    return ComponentMaskOf<Transform>();
+}
+
+void TransformSnapshotSystem::Run(Registry& registry, JobSystem&, float) {
+    if (auto* transforms = registry.Store().FindPool<Transform>()) {
+        transforms->ForEach([](ObjectId, Transform& transform) {
+            transform.SnapshotPrevious();
+        });
+    }
+}
+
+ComponentMask SceneGraphSystem::Reads() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<WorldTransform>();
+}
+
+ComponentMask SceneGraphSystem::Writes() const {
+    // Transform yalnızca ışınlanma bilgisini temizlemek için yazılır
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<WorldTransform>();
+}
+
+void SceneGraphSystem::Run(Registry& registry, JobSystem&, float) {
+    registry.Hierarchy().Update(registry.Store());
+}
+
+SpatialGridSystem::SpatialGridSystem(float cellSize)
+    : mGrid(cellSize) {
+}
+
+ComponentMask SpatialGridSystem::Reads() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<WorldTransform>();
+}
+
+ComponentMask SpatialGridSystem::Writes() const {
+    return kSpatialGridResource;
+}
+
+void SpatialGridSystem::Run(Registry& registry, JobSystem& jobs, float) {
+    mGrid.Build(registry, &jobs);
+}
+
+ComponentMask CollisionSystem::Reads() const {
+    return ComponentMaskOf<Transform>() | ComponentMaskOf<WorldTransform>() | ComponentMaskOf<Collider>();
+}
+
+ComponentMask CollisionSystem::Writes() const {
+    return kCollisionWorldResource;
+}
+
+void CollisionSystem::Run(Registry& registry, JobSystem&, float) {
+    mWorld.Update(registry);
+}
@@ -0,0 +1,89 @@
+#include "viewport-culler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "registry.h"
+
+namespace {
+
+// Eşkenar üçgenin merkezinden köşelerine olan uzaklığın kenar uzunluğuna oranı (1 / sqrt(3), yuvarlanarak büyütülmüş)
+constexpr float kTriangleCircumradius = 0.578f;
+
+} // namespace
+
+ViewportCuller::ViewportCuller(float margin)
+    : mTree(margin) {
+}
+
+Aabb ViewportCuller::ComputeBounds(const ShapeDesc& shape, const Transform& transform) {
+    float halfWidth = 0.0f;
+    float halfHeight = 0.0f;
+    switch (shape.mType) {
+        case ShapeType::Rectangle:
+            halfWidth = std::fabs(shape.mWidth * transform.mScaleX) * 0.5f;
+            halfHeight = std::fabs(shape.mHeight * transform.mScaleY) * 0.5f;
+            break;
+        case ShapeType::Circle:
+            // CircleRenderer yarıçapları mScaleX ve mScaleY ile ayrı ölçekleyerek elips çizer
+            halfWidth = std::fabs(shape.mWidth * transform.mScaleX) * 0.5f;
+            halfHeight = std::fabs(shape.mWidth * transform.mScaleY) * 0.5f;
+            break;
+        case ShapeType::Triangle:
+            halfWidth = halfHeight = std::fabs(shape.mWidth * transform.mScaleX) * kTriangleCircumradius;
+            break;
+    }
+
+    return Aabb{
+        std::min(transform.mX, transform.mPrevX) - halfWidth, std::min(transform.mY, transform.mPrevY) - halfHeight,
+        std::max(transform.mX, transform.mPrevX) + halfWidth, std::max(transform.mY, transform.mPrevY) + halfHeight
+    };
+}
+
+void ViewportCuller::Update(Registry& registry) {
+    const ComponentStore& store = registry.Store();
+    TrackIfPresent<Transform>(store, mTransformChanges);
+    TrackIfPresent<WorldTransform>(store, mWorldChanges);
+    TrackIfPresent<RenderComponent>(store, mRenderChanges);
+
+    const auto* renders = store.FindPool<RenderComponent>();
+    Sync(renders, mRenderChanges);
+    Sync(renders, mTransformChanges);
+    Sync(renders, mWorldChanges);
+}
+
+void ViewportCuller::Sync(const ComponentPool<RenderComponent>* renders, ChangeList& changes) {
+    for (ObjectId id : changes.Ids()) {
+        const RenderComponent* render = renders ? renders->Get(id) : nullptr;
+        const Transform* transform = render ? render->GetBoundTransform() : nullptr;
+        if (id >= mProxyOf.size()) {
+            mProxyOf.resize(static_cast<size_t>(id) + 1, kNoProxy);
+        }
+
+        // Bileşeni silinmiş ya da çizilemez hale gelmiş nesnelerin yaprağı kaldırılır
+        if (!transform || !render->GetStrategy()) {
+            if (mProxyOf[id] != kNoProxy) {
+                mTree.DestroyProxy(mProxyOf[id]);
+                mProxyOf[id] = kNoProxy;
+            }
+            continue;
+        }
+
+        const Aabb box = ComputeBounds(render->GetStrategy()->GetShape(), *transform);
+        if (mProxyOf[id] == kNoProxy) {
+            mProxyOf[id] = mTree.CreateProxy(box, id);
+        } else {
+            mTree.MoveProxy(mProxyOf[id], box);
+        }
+    }
+    changes.Clear();
+}
+
+const std::vector<ObjectId>& ViewportCuller::Query(const Aabb& viewport) {
+    mVisible.clear();
+    mTree.Query(viewport, [this](uint32_t id) { mVisible.push_back(id); });
+
+    // Çizim sırası ağacın yapısından bağımsız olsun diye numaralara göre sıralanır
+    std::sort(mVisible.begin(), mVisible.end());
+    return mVisible;
+}
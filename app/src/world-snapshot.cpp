@@ -0,0 +1,644 @@
+#include "world-snapshot.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "collision.h"
+#include "registry.h"
+#include "render-strategies.h"
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'D', 'L', 'W', 'O', 'R', 'L', 'D'};
+constexpr uint32_t kByteOrderTag = 0x01020304;
+
+// Bölümler bu hizada başlar, böylece eşlenmiş bellekteki kayıtlar doğrudan okunabilir
+constexpr uint64_t kSectionAlignment = 16;
+constexpr uint32_t kNoIndex = std::numeric_limits<uint32_t>::max();
+
+enum class SectionKind : uint32_t {
+    Strategies = 1,
+    Transforms = 2,
+    Velocities = 3,
+    Renders = 4,
+    Colliders = 5,
+    Parents = 6,
+    RenderLayers = 7
+};
+
+struct FileHeader {
+    char mMagic[8];
+    uint32_t mByteOrder;
+    uint32_t mVersion;
+    uint64_t mObjectCount;
+    uint32_t mSectionCount;
+    uint32_t mReserved;
+};
+
+// Sahip dizisi olmayan bölümlerde (ör. stratejiler) mOwnersOffset sıfırdır
+struct SectionHeader {
+    uint32_t mKind;
+    uint32_t mRecordSize;
+    uint64_t mCount;
+    uint64_t mOwnersOffset;
+    uint64_t mRecordsOffset;
+};
+
+struct StrategyRecord {
+    uint32_t mType;
+    float mWidth;
+    float mHeight;
+    float mColor[4];
+};
+
+struct TransformRecord {
+    float mX;
+    float mY;
+    float mRotation;
+    float mScaleX;
+    float mScaleY;
+    float mPrevX;
+    float mPrevY;
+    float mPrevRotation;
+};
+
+struct VelocityRecord {
+    float mVx;
+    float mVy;
+};
+
+struct RenderRecord {
+    uint32_t mStrategy;
+};
+
+// Sürüm 2 ile eklendi; yalnızca varsayılan katmanda olmayan RenderComponent'ler yazılır
+struct RenderLayerRecord {
+    uint32_t mLayer;
+};
+
+struct ColliderRecord {
+    uint32_t mType;
+    float mWidth;
+    float mHeight;
+    uint32_t mLayer;
+    uint32_t mMask;
+};
+
+struct ParentRecord {
+    uint32_t mParent;
+};
+
+static_assert(std::is_trivially_copyable_v<TransformRecord> && std::is_trivially_copyable_v<ColliderRecord>);
+
+/**
+ * @brief Dosyayı salt okunur olarak belleğe eşler; nesne yok edilince eşleme kaldırılır.
+ */
+class MappedFile {
+private:
+    const unsigned char* mData = nullptr;
+    size_t mSize = 0;
+#if defined(_WIN32)
+    HANDLE mFile = INVALID_HANDLE_VALUE;
+    HANDLE mMapping = nullptr;
+#endif
+
+public:
+    explicit MappedFile(const std::string& path) {
+#if defined(_WIN32)
+        mFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (mFile == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open world snapshot: " + path);
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(mFile, &size)) {
+            Close();
+            throw std::runtime_error("Cannot read world snapshot size: " + path);
+        }
+        mSize = static_cast<size_t>(size.QuadPart);
+        if (mSize > 0) {
+            mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            void* view = mMapping ? MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (!view) {
+                Close();
+                throw std::runtime_error("Cannot map world snapshot: " + path);
+            }
+            mData = static_cast<const unsigned char*>(view);
+        }
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open world snapshot: " + path);
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw std::runtime_error("Cannot read world snapshot size: " + path);
+        }
+        mSize = static_cast<size_t>(info.st_size);
+        if (mSize > 0) {
+#if defined(__linux__)
+            // Sayfalar tek tek sayfa hatasıyla değil, eşleme sırasında topluca okunur
+            constexpr int kMapFlags = MAP_PRIVATE | MAP_POPULATE;
+#else
+            constexpr int kMapFlags = MAP_PRIVATE;
+#endif
+            void* memory = mmap(nullptr, mSize, PROT_READ, kMapFlags, fd, 0);
+            if (memory == MAP_FAILED) {
+                close(fd);
+                throw std::runtime_error("Cannot map world snapshot: " + path);
+            }
+            mData = static_cast<const unsigned char*>(memory);
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* Data() const { return mData; }
+    size_t Size() const { return mSize; }
+
+private:
+    void Close() {
+#if defined(_WIN32)
+        if (mData) {
+            UnmapViewOfFile(mData);
+        }
+        if (mMapping) {
+            CloseHandle(mMapping);
+        }
+        if (mFile != INVALID_HANDLE_VALUE) {
+            CloseHandle(mFile);
+        }
+        mMapping = nullptr;
+        mFile = INVALID_HANDLE_VALUE;
+#else
+        if (mData) {
+            munmap(const_cast<unsigned char*>(mData), mSize);
+        }
+#endif
+        mData = nullptr;
+    }
+};
+
+/**
+ * @brief Kaydedilecek bir bölümün sahip ve kayıt dizileridir.
+ */
+template<typename Record>
+struct SectionData {
+    SectionKind mKind;
+    std::vector<uint32_t> mOwners;
+    std::vector<Record> mRecords;
+};
+
+/**
+ * @brief Doğrulanmış bir bölüme eşlenmiş bellek üzerinden erişim sağlar.
+ */
+template<typename Record>
+struct SectionView {
+    const uint32_t* mOwners = nullptr;
+    const Record* mRecords = nullptr;
+    size_t mCount = 0;
+};
+
+uint64_t AlignUp(uint64_t value) {
+    return (value + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+}
+
+SDL_Color ToByteColor(const float color[4]) {
+    auto channel = [](float value) {
+        return static_cast<Uint8>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    };
+    return SDL_Color{channel(color[0]), channel(color[1]), channel(color[2]), channel(color[3])};
+}
+
+// make_shared PooledObject havuzunu atladığından stratejiler new ile oluşturulur
+std::shared_ptr<RenderStrategy> CreateStrategy(const StrategyRecord& record) {
+    switch (static_cast<ShapeType>(record.mType)) {
+        case ShapeType::Rectangle:
+            return std::shared_ptr<RenderStrategy>(new RectangleRenderer(ToByteColor(record.mColor),
+                                                                         static_cast<int32_t>(record.mWidth),
+                                                                         static_cast<int32_t>(record.mHeight)));
+        case ShapeType::Circle:
+            return std::shared_ptr<RenderStrategy>(new CircleRenderer(ToByteColor(record.mColor),
+                                                                      static_cast<int32_t>(record.mWidth * 0.5f)));
+        case ShapeType::Triangle:
+            return std::shared_ptr<RenderStrategy>(new TriangleRenderer(
+                SDL_FColor{record.mColor[0], record.mColor[1], record.mColor[2], record.mColor[3]}, record.mWidth));
+    }
+    return nullptr;
+}
+
+bool IsShapeType(uint32_t type) {
+    return type <= static_cast<uint32_t>(ShapeType::Triangle);
+}
+
+/**
+ * @brief Dosyayı doğrular ve bilinen bölümleri bulur. Hiçbir dizi dosyanın dışına taşamaz ve
+ *        hiçbir numara kendi dizisinin dışını göstermez; aksi halde std::runtime_error fırlatır.
+ */
+class SnapshotReader {
+private:
+    const MappedFile& mFile;
+    FileHeader mHeader{};
+
+public:
+    SectionView<StrategyRecord> mStrategies;
+    SectionView<TransformRecord> mTransforms;
+    SectionView<VelocityRecord> mVelocities;
+    SectionView<RenderRecord> mRenders;
+    SectionView<RenderLayerRecord> mRenderLayers;
+    SectionView<ColliderRecord> mColliders;
+    SectionView<ParentRecord> mParents;
+
+    explicit SnapshotReader(const MappedFile& file) : mFile(file) {
+        if (mFile.Size() < sizeof(FileHeader)) {
+            throw std::runtime_error("World snapshot is truncated");
+        }
+        std::memcpy(&mHeader, mFile.Data(), sizeof(FileHeader));
+        if (std::memcmp(mHeader.mMagic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("File is not a world snapshot");
+        }
+        if (mHeader.mByteOrder != kByteOrderTag) {
+            throw std::runtime_error("World snapshot was written with a different byte order");
+        }
+        if (mHeader.mVersion == 0 || mHeader.mVersion > WorldSnapshot::kVersion) {
+            throw std::runtime_error("Unsupported world snapshot version " + std::to_string(mHeader.mVersion));
+        }
+        if (mHeader.mObjectCount >= kNoIndex) {
+            throw std::runtime_error("World snapshot has too many objects");
+        }
+
+        const uint64_t tableEnd = sizeof(FileHeader) + uint64_t{mHeader.mSectionCount} * sizeof(SectionHeader);
+        if (tableEnd > mFile.Size()) {
+            throw std::runtime_error("World snapshot section table is truncated");
+        }
+
+        for (uint32_t i = 0; i < mHeader.mSectionCount; i++) {
+            SectionHeader section;
+            std::memcpy(&section, mFile.Data() + sizeof(FileHeader) + i * sizeof(SectionHeader), sizeof(section));
+            switch (static_cast<SectionKind>(section.mKind)) {
+                case SectionKind::Strategies: Bind(section, mStrategies, false); break;
+                case SectionKind::Transforms: Bind(section, mTransforms, true); break;
+                case SectionKind::Velocities: Bind(section, mVelocities, true); break;
+                case SectionKind::Renders: Bind(section, mRenders, true); break;
+                case SectionKind::Colliders: Bind(section, mColliders, true); break;
+                case SectionKind::Parents: Bind(section, mParents, true); break;
+                case SectionKind::RenderLayers: Bind(section, mRenderLayers, true); break;
+                default: break;
+            }
+        }
+
+        ValidateReferences();
+    }
+
+    size_t ObjectCount() const { return static_cast<size_t>(mHeader.mObjectCount); }
+
+private:
+    void CheckRange(uint64_t offset, uint64_t count, uint64_t elementSize) const {
+        if (offset % alignof(uint32_t) != 0 || offset > mFile.Size()
+            || count > (mFile.Size() - offset) / elementSize) {
+            throw std::runtime_error("World snapshot section is out of bounds");
+        }
+    }
+
+    template<typename Record>
+    void Bind(const SectionHeader& section, SectionView<Record>& view, bool hasOwners) {
+        if (section.mRecordSize != sizeof(Record)) {
+            throw std::runtime_error("World snapshot record size mismatch");
+        }
+        CheckRange(section.mRecordsOffset, section.mCount, sizeof(Record));
+        view.mRecords = reinterpret_cast<const Record*>(mFile.Data() + section.mRecordsOffset);
+        view.mCount = static_cast<size_t>(section.mCount);
+
+        if (hasOwners) {
+            CheckRange(section.mOwnersOffset, section.mCount, sizeof(uint32_t));
+            view.mOwners = reinterpret_cast<const uint32_t*>(mFile.Data() + section.mOwnersOffset);
+            for (size_t i = 0; i < view.mCount; i++) {
+                if (view.mOwners[i] >= mHeader.mObjectCount) {
+                    throw std::runtime_error("World snapshot references a missing object");
+                }
+            }
+        }
+    }
+
+    void ValidateReferences() const {
+        for (size_t i = 0; i < mStrategies.mCount; i++) {
+            if (!IsShapeType(mStrategies.mRecords[i].mType)) {
+                throw std::runtime_error("World snapshot has an unknown shape type");
+            }
+        }
+        for (size_t i = 0; i < mRenders.mCount; i++) {
+            if (mRenders.mRecords[i].mStrategy >= mStrategies.mCount) {
+                throw std::runtime_error("World snapshot references a missing render strategy");
+            }
+        }
+        for (size_t i = 0; i < mRenderLayers.mCount; i++) {
+            if (mRenderLayers.mRecords[i].mLayer > std::numeric_limits<uint8_t>::max()) {
+                throw std::runtime_error("World snapshot has an invalid render layer");
+            }
+        }
+        for (size_t i = 0; i < mColliders.mCount; i++) {
+            if (!IsShapeType(mColliders.mRecords[i].mType)) {
+                throw std::runtime_error("World snapshot has an unknown shape type");
+            }
+        }
+        ValidateHierarchy();
+    }
+
+    /**
+     * @brief Ebeveyn bağları yüklemenin ortasında SceneGraph'ın reddedeceği bir durum içermemelidir:
+     *        her nesnenin en fazla bir ebeveyni olur ve bağlar döngü oluşturmaz.
+     */
+    void ValidateHierarchy() const {
+        if (mParents.mCount == 0) {
+            return;
+        }
+
+        const size_t count = ObjectCount();
+        std::vector<uint32_t> parentOf(count, kNoIndex);
+        for (size_t i = 0; i < mParents.mCount; i++) {
+            const uint32_t child = mParents.mOwners[i];
+            const uint32_t parent = mParents.mRecords[i].mParent;
+            if (parent >= count || parentOf[child] != kNoIndex) {
+                throw std::runtime_error("World snapshot has an invalid parent link");
+            }
+            parentOf[child] = parent;
+        }
+
+        // 1: o an yürünen yolda, 2: kökü bulunmuş
+        std::vector<uint8_t> state(count, 0);
+        for (size_t i = 0; i < mParents.mCount; i++) {
+            uint32_t node = mParents.mOwners[i];
+            for (; node != kNoIndex && state[node] == 0; node = parentOf[node]) {
+                state[node] = 1;
+            }
+            if (node != kNoIndex && state[node] == 1) {
+                throw std::runtime_error("World snapshot has a cycle in the scene graph");
+            }
+            for (node = mParents.mOwners[i]; node != kNoIndex && state[node] == 1; node = parentOf[node]) {
+                state[node] = 2;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Bölüm kayıtlarından bileşenleri havuza toplu olarak ekler. make(record) kaydın bileşenini döner.
+ *        ids, sahiplerin Registry'deki numaraları için her bölümde yeniden kullanılan bir tampondur.
+ */
+template<typename T, typename Record, typename Make>
+void AddComponents(ComponentStore& store, const SectionView<Record>& section, const std::vector<Entity>& entities,
+                   const std::vector<GraphicalObject*>& objects, std::vector<ObjectId>& ids, Make&& make) {
+    ids.resize(section.mCount);
+    for (size_t i = 0; i < section.mCount; i++) {
+        ids[i] = entities[section.mOwners[i]].mIndex;
+    }
+
+    store.AddMany<T>(std::span<const ObjectId>(ids), [&](size_t i) {
+        T component = make(section.mRecords[i]);
+        component.mOwner = objects[section.mOwners[i]];
+        return component;
+    });
+}
+
+template<typename Record>
+void WriteSection(std::ofstream& out, uint64_t& offset, const SectionData<Record>& section,
+                  std::vector<SectionHeader>& headers, bool hasOwners) {
+    auto pad = [&out, &offset]() {
+        static const char sZeros[kSectionAlignment] = {};
+        const uint64_t aligned = AlignUp(offset);
+        out.write(sZeros, static_cast<std::streamsize>(aligned - offset));
+        offset = aligned;
+    };
+
+    SectionHeader& header = headers.emplace_back();
+    header.mKind = static_cast<uint32_t>(section.mKind);
+    header.mRecordSize = sizeof(Record);
+    header.mCount = section.mRecords.size();
+
+    if (hasOwners) {
+        pad();
+        header.mOwnersOffset = offset;
+        out.write(reinterpret_cast<const char*>(section.mOwners.data()),
+                  static_cast<std::streamsize>(section.mOwners.size() * sizeof(uint32_t)));
+        offset += section.mOwners.size() * sizeof(uint32_t);
+    } else {
+        header.mOwnersOffset = 0;
+    }
+
+    pad();
+    header.mRecordsOffset = offset;
+    out.write(reinterpret_cast<const char*>(section.mRecords.data()),
+              static_cast<std::streamsize>(section.mRecords.size() * sizeof(Record)));
+    offset += section.mRecords.size() * sizeof(Record);
+}
+
+} // namespace
+
+void WorldSnapshot::Save(Registry& registry, const std::string& path) {
+    ComponentStore& store = registry.Store();
+
+    // Nesneler yaşayan nesne sırasıyla 0'dan başlayarak yeniden numaralandırılır
+    std::vector<uint32_t> indexOf;
+    uint32_t objectCount = 0;
+    registry.ForEach([&indexOf, &objectCount](GraphicalObject& object) {
+        if (object.GetId() >= indexOf.size()) {
+            indexOf.resize(static_cast<size_t>(object.GetId()) + 1, kNoIndex);
+        }
+        indexOf[object.GetId()] = objectCount++;
+    });
+
+    // Bileşenler havuzdaki sıralarıyla yazılır, böylece yüklenen havuzlar da aynı sırada dolar
+    SectionData<TransformRecord> transforms{SectionKind::Transforms, {}, {}};
+    auto& transformPool = store.Pool<Transform>();
+    transforms.mOwners.reserve(transformPool.Size());
+    transforms.mRecords.reserve(transformPool.Size());
+    for (uint32_t i = 0; i < transformPool.Size(); i++) {
+        const Transform& t = transformPool.At(i);
+        transforms.mOwners.push_back(indexOf[transformPool.OwnerAt(i)]);
+        transforms.mRecords.push_back(TransformRecord{
+            t.mX, t.mY, t.mRotation, t.mScaleX, t.mScaleY, t.mPrevX, t.mPrevY, t.mPrevRotation});
+    }
+
+    SectionData<VelocityRecord> velocities{SectionKind::Velocities, {}, {}};
+    auto& velocityPool = store.Pool<Velocity>();
+    velocities.mOwners.reserve(velocityPool.Size());
+    velocities.mRecords.reserve(velocityPool.Size());
+    for (uint32_t i = 0; i < velocityPool.Size(); i++) {
+        const Velocity& v = velocityPool.At(i);
+        velocities.mOwners.push_back(indexOf[velocityPool.OwnerAt(i)]);
+        velocities.mRecords.push_back(VelocityRecord{v.mVx, v.mVy});
+    }
+
+    // Aynı strateji nesnesini paylaşan bileşenler aynı strateji kaydını gösterir
+    SectionData<StrategyRecord> strategies{SectionKind::Strategies, {}, {}};
+    SectionData<RenderRecord> renders{SectionKind::Renders, {}, {}};
+    SectionData<RenderLayerRecord> renderLayers{SectionKind::RenderLayers, {}, {}};
+    std::unordered_map<const RenderStrategy*, uint32_t> strategyIndex;
+    auto& renderPool = store.Pool<RenderComponent>();
+    renders.mOwners.reserve(renderPool.Size());
+    renders.mRecords.reserve(renderPool.Size());
+    for (uint32_t i = 0; i < renderPool.Size(); i++) {
+        const RenderStrategy* strategy = renderPool.At(i).GetStrategy().get();
+        if (!strategy) {
+            continue;
+        }
+
+        auto [it, inserted] = strategyIndex.try_emplace(strategy, static_cast<uint32_t>(strategies.mRecords.size()));
+        if (inserted) {
+            const ShapeDesc shape = strategy->GetShape();
+            const SDL_FColor color = strategy->GetColor();
+            strategies.mRecords.push_back(StrategyRecord{
+                static_cast<uint32_t>(shape.mType), shape.mWidth, shape.mHeight, {color.r, color.g, color.b, color.a}});
+        }
+        renders.mOwners.push_back(indexOf[renderPool.OwnerAt(i)]);
+        renders.mRecords.push_back(RenderRecord{it->second});
+        if (const uint8_t layer = renderPool.At(i).GetLayer(); layer != 0) {
+            renderLayers.mOwners.push_back(renders.mOwners.back());
+            renderLayers.mRecords.push_back(RenderLayerRecord{layer});
+        }
+    }
+
+    SectionData<ColliderRecord> colliders{SectionKind::Colliders, {}, {}};
+    auto& colliderPool = store.Pool<Collider>();
+    for (uint32_t i = 0; i < colliderPool.Size(); i++) {
+        const Collider& c = colliderPool.At(i);
+        colliders.mOwners.push_back(indexOf[colliderPool.OwnerAt(i)]);
+        colliders.mRecords.push_back(ColliderRecord{
+            static_cast<uint32_t>(c.mShape.mType), c.mShape.mWidth, c.mShape.mHeight, c.mLayer, c.mMask});
+    }
+
+    SectionData<ParentRecord> parents{SectionKind::Parents, {}, {}};
+    registry.ForEach([&registry, &indexOf, &parents](GraphicalObject& object) {
+        Entity parent = registry.GetParent(object.GetEntity());
+        if (!parent.IsNull()) {
+            parents.mOwners.push_back(indexOf[object.GetId()]);
+            parents.mRecords.push_back(ParentRecord{indexOf[parent.mIndex]});
+        }
+    });
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot create world snapshot: " + path);
+    }
+
+    constexpr uint32_t kSectionCount = 7;
+    FileHeader header{};
+    std::memcpy(header.mMagic, kMagic, sizeof(kMagic));
+    header.mByteOrder = kByteOrderTag;
+    header.mVersion = kVersion;
+    header.mObjectCount = objectCount;
+    header.mSectionCount = kSectionCount;
+
+    // Bölüm tablosu, bölümlerin yerleri belli olduktan sonra baştaki boş alanın üzerine yazılır
+    std::vector<SectionHeader> headers;
+    headers.reserve(kSectionCount);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    const std::vector<SectionHeader> placeholder(kSectionCount);
+    out.write(reinterpret_cast<const char*>(placeholder.data()), kSectionCount * sizeof(SectionHeader));
+
+    uint64_t offset = sizeof(FileHeader) + kSectionCount * sizeof(SectionHeader);
+    WriteSection(out, offset, strategies, headers, false);
+    WriteSection(out, offset, transforms, headers, true);
+    WriteSection(out, offset, velocities, headers, true);
+    WriteSection(out, offset, renders, headers, true);
+    WriteSection(out, offset, colliders, headers, true);
+    WriteSection(out, offset, parents, headers, true);
+    WriteSection(out, offset, renderLayers, headers, true);
+
+    out.seekp(sizeof(FileHeader));
+    out.write(reinterpret_cast<const char*>(headers.data()), kSectionCount * sizeof(SectionHeader));
+    if (!out) {
+        throw std::runtime_error("Cannot write world snapshot: " + path);
+    }
+}
+
+std::vector<Entity> WorldSnapshot::Load(Registry& registry, const std::string& path) {
+    MappedFile file(path);
+    SnapshotReader reader(file);
+
+    const size_t count = reader.ObjectCount();
+    ComponentStore& store = registry.Store();
+    registry.Reserve(registry.Size() + count);
+
+    std::vector<Entity> entities(count);
+    std::vector<GraphicalObject*> objects(count);
+    for (size_t i = 0; i < count; i++) {
+        entities[i] = registry.Create();
+        objects[i] = registry.Get(entities[i]);
+    }
+
+    std::vector<std::shared_ptr<RenderStrategy>> strategies(reader.mStrategies.mCount);
+    for (size_t i = 0; i < strategies.size(); i++) {
+        strategies[i] = CreateStrategy(reader.mStrategies.mRecords[i]);
+    }
+
+    std::vector<ObjectId> ids;
+    AddComponents<Transform>(store, reader.mTransforms, entities, objects, ids, [](const TransformRecord& r) {
+        Transform t(r.mX, r.mY);
+        t.mRotation = r.mRotation;
+        t.mScaleX = r.mScaleX;
+        t.mScaleY = r.mScaleY;
+        t.mPrevX = r.mPrevX;
+        t.mPrevY = r.mPrevY;
+        t.mPrevRotation = r.mPrevRotation;
+        return t;
+    });
+
+    AddComponents<Velocity>(store, reader.mVelocities, entities, objects, ids, [](const VelocityRecord& r) {
+        return Velocity(r.mVx, r.mVy);
+    });
+
+    AddComponents<RenderComponent>(store, reader.mRenders, entities, objects, ids,
+        [&strategies](const RenderRecord& r) {
+            return RenderComponent(strategies[r.mStrategy]);
+        });
+
+    AddComponents<Collider>(store, reader.mColliders, entities, objects, ids, [](const ColliderRecord& r) {
+        return Collider(ShapeDesc{static_cast<ShapeType>(r.mType), r.mWidth, r.mHeight}, r.mLayer, r.mMask);
+    });
+
+    // Katman kaydı olmayan nesneler (ve sürüm 1 dosyaları) varsayılan katmanda kalır
+    for (size_t i = 0; i < reader.mRenderLayers.mCount; i++) {
+        const ObjectId id = entities[reader.mRenderLayers.mOwners[i]].mIndex;
+        if (RenderComponent* render = store.Get<RenderComponent>(id)) {
+            render->SetLayer(static_cast<uint8_t>(reader.mRenderLayers.mRecords[i].mLayer));
+        }
+    }
+
+    // Bileşenler arası bağlar nesne nesne değil, tür bazında topluca çözülür
+    store.ResolvePool<Transform>();
+    store.ResolvePool<Velocity>();
+    store.ResolvePool<RenderComponent>();
+    store.ResolvePool<Collider>();
+
+    for (size_t i = 0; i < reader.mParents.mCount; i++) {
+        registry.SetParent(entities[reader.mParents.mOwners[i]], entities[reader.mParents.mRecords[i].mParent]);
+    }
+
+    return entities;
+}
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "collision.h"
+#include "registry.h"
+
+namespace {
+
+// Nesne yogunlugu sabit tutulur, boylece nesne sayisi arttikca temas sayisi dogrusal artar
+constexpr float kAreaPerBody = 900.0f;
+
+struct CollisionScene {
+    Registry mRegistry;
+    std::vector<Transform*> mTransforms;
+    std::vector<float> mVx, mVy;
+
+    explicit CollisionScene(size_t bodyCount) {
+        std::mt19937 random(7);
+        const float side = std::sqrt(kAreaPerBody * static_cast<float>(bodyCount));
+        std::uniform_real_distribution<float> position(0.0f, side);
+        std::uniform_real_distribution<float> speed(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> size(4.0f, 12.0f);
+
+        mRegistry.Reserve(bodyCount);
+        for (size_t i = 0; i < bodyCount; i++) {
+            Entity entity = mRegistry.Create();
+            GraphicalObject* object = mRegistry.Get(entity);
+            object->AddComponent<Transform>(position(random), position(random));
+            const float extent = size(random);
+            const ShapeType type = static_cast<ShapeType>(i % 3);
+            object->AddComponent<Collider>(ShapeDesc{type, extent, extent});
+            mVx.push_back(speed(random));
+            mVy.push_back(speed(random));
+        }
+        for (size_t i = 0; i < bodyCount; i++) {
+            mTransforms.push_back(mRegistry.Store().Pool<Transform>().Get(static_cast<ObjectId>(i)));
+        }
+    }
+
+    void Step() {
+        for (size_t i = 0; i < mTransforms.size(); i++) {
+            mTransforms[i]->mX += mVx[i];
+            mTransforms[i]->mY += mVy[i];
+        }
+    }
+};
+
+// Hareket eden karisik sekiller icin tum adim: sinir kutulari, SAP, dar asama ve siralama
+void BM_CollisionUpdate(benchmark::State& state) {
+    CollisionScene scene(static_cast<size_t>(state.range(0)));
+    CollisionWorld world;
+    world.Update(scene.mRegistry);
+
+    size_t contacts = 0;
+    for (auto _ : state) {
+        scene.Step();
+        world.Update(scene.mRegistry);
+        contacts = world.Contacts().size();
+        benchmark::DoNotOptimize(contacts);
+    }
+
+    state.counters["contacts"] = static_cast<double>(contacts);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_CollisionUpdate)->Arg(10000)->Arg(40000)->Arg(160000)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "component-store.h"
+
+namespace {
+
+constexpr int kObjectCount = 10000;
+
+template<int N>
+class BenchComponent : public Component {
+public:
+    float mValue = static_cast<float>(N);
+};
+
+// Onceki GraphicalObject gerceklemesi: bilesen listesi uzerinde dynamic_cast ile dogrusal arama
+class LegacyObject {
+private:
+    std::vector<std::unique_ptr<Component>> mComponents;
+
+public:
+    template<typename T>
+    void AddComponent() {
+        mComponents.push_back(std::make_unique<T>());
+    }
+
+    template<typename T>
+    T* GetComponent() const {
+        for (const auto& component : mComponents) {
+            if (auto* ptr = dynamic_cast<T*>(component.get())) {
+                return ptr;
+            }
+        }
+        return nullptr;
+    }
+};
+
+template<typename Adder, int... I>
+void AddComponents(Adder&& adder, int count, std::integer_sequence<int, I...>) {
+    ((I < count ? adder(BenchComponent<I>{}) : void()), ...);
+}
+
+using AllTypes = std::make_integer_sequence<int, 16>;
+
+// Aranan bilesen her zaman listeye en son eklenen bilesendir
+template<int Target>
+void BM_LegacyDynamicCastScan(benchmark::State& state) {
+    std::vector<LegacyObject> objects(kObjectCount);
+    for (auto& object : objects) {
+        AddComponents([&object](auto component) {
+            object.AddComponent<decltype(component)>();
+        }, Target + 1, AllTypes{});
+    }
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& object : objects) {
+            sum += object.GetComponent<BenchComponent<Target>>()->mValue;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kObjectCount);
+}
+
+template<int Target>
+void BM_ComponentStoreLookup(benchmark::State& state) {
+    ComponentStore store;
+    std::vector<ObjectId> objects;
+    for (int i = 0; i < kObjectCount; i++) {
+        ObjectId id = store.CreateObject();
+        AddComponents([&store, id](auto component) {
+            store.Add<decltype(component)>(id);
+        }, Target + 1, AllTypes{});
+        objects.push_back(id);
+    }
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (ObjectId id : objects) {
+            sum += store.Get<BenchComponent<Target>>(id)->mValue;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * kObjectCount);
+}
+
+} // namespace
+
+// Nesne basina 1, 4 ve 16 bilesen
+BENCHMARK(BM_LegacyDynamicCastScan<0>)->Name("LegacyDynamicCastScan/1");
+BENCHMARK(BM_LegacyDynamicCastScan<3>)->Name("LegacyDynamicCastScan/4");
+BENCHMARK(BM_LegacyDynamicCastScan<15>)->Name("LegacyDynamicCastScan/16");
+BENCHMARK(BM_ComponentStoreLookup<0>)->Name("ComponentStoreLookup/1");
+BENCHMARK(BM_ComponentStoreLookup<3>)->Name("ComponentStoreLookup/4");
+BENCHMARK(BM_ComponentStoreLookup<15>)->Name("ComponentStoreLookup/16");
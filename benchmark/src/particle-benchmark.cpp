@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "particle-system.h"
+#include "registry.h"
+
+namespace {
+
+constexpr float kDeltaTime = 1.0f / 60.0f;
+
+ParticleEmitter* CreateEmitter(Registry& registry, const ParticleEmitterSettings& settings) {
+    GraphicalObject* object = registry.Get(registry.Create());
+    object->AddComponent<Transform>(400.0f, 300.0f);
+    return object->AddComponent<ParticleEmitter>(settings);
+}
+
+// Yalnizca SoA cekirdegi; hicbir parcacik olmez
+void BM_ParticleKernel(benchmark::State& state, SimdLevel level) {
+    if (level == SimdLevel::Avx2 && MovementSystem::DetectSimdLevel() != SimdLevel::Avx2) {
+        state.SkipWithError("AVX2 desteklenmiyor");
+        return;
+    }
+
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<float> x(count, 1.0f), y(count, 2.0f), vx(count, 3.0f), vy(count, 4.0f);
+    std::vector<float> age(count, 0.0f), inverseLifetime(count, 1e-6f);
+
+    for (auto _ : state) {
+        ParticleSystem::Integrate(level, x.data(), y.data(), vx.data(), vy.data(), age.data(),
+                                  inverseLifetime.data(), count, kDeltaTime, 0.0f, 9.8f);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Kararli durumdaki bir yayici: her adimda parcaciklarin bir kismi olur ve yerlerine yenileri uretilir
+void BM_ParticleEmitterSimulate(benchmark::State& state) {
+    Registry registry;
+    ParticleEmitterSettings settings;
+    settings.mMaxParticles = static_cast<uint32_t>(state.range(0));
+    settings.mMinLifetime = 1.0f;
+    settings.mMaxLifetime = 2.0f;
+    settings.mRate = static_cast<float>(state.range(0)) / 1.5f;
+    settings.mGravityY = 100.0f;
+    ParticleEmitter* emitter = CreateEmitter(registry, settings);
+
+    // Yaklasik kararli duruma gelinceye kadar isitilir
+    for (int i = 0; i < 150; i++) {
+        emitter->Simulate(kDeltaTime);
+    }
+
+    for (auto _ : state) {
+        emitter->Simulate(kDeltaTime);
+    }
+
+    state.counters["live"] = static_cast<double>(emitter->Count());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(emitter->Count()));
+}
+
+// Tum parcaciklarin tek SDL_RenderGeometry cagrisina hazir koselere donusturulmesi
+void BM_ParticleBuildVertices(benchmark::State& state) {
+    Registry registry;
+    ParticleEmitterSettings settings;
+    settings.mMaxParticles = static_cast<uint32_t>(state.range(0));
+    settings.mMinLifetime = 1e6f;
+    settings.mMaxLifetime = 1e6f;
+    ParticleEmitter* emitter = CreateEmitter(registry, settings);
+    emitter->Burst(static_cast<size_t>(state.range(0)));
+    emitter->Simulate(kDeltaTime);
+    std::vector<SDL_Vertex> vertices;
+
+    for (auto _ : state) {
+        ParticleSystem::BuildVertices(registry.Store(), 0.5f, vertices);
+        benchmark::DoNotOptimize(vertices.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_ParticleKernel, Scalar, SimdLevel::Scalar)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ParticleKernel, Sse2, SimdLevel::Sse2)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ParticleKernel, Avx2, SimdLevel::Avx2)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParticleEmitterSimulate)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParticleBuildVertices)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "physics-system.h"
+#include "registry.h"
+
+namespace {
+
+constexpr float kDeltaTime = 1.0f / 60.0f;
+
+void CreateBodies(Registry& registry, size_t count) {
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> position(0.0f, 800.0f);
+    std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> mass(0.5f, 5.0f);
+    for (size_t i = 0; i < count; i++) {
+        auto* object = registry.Get(registry.Create());
+        object->AddComponent<Transform>(position(random), position(random));
+        object->AddComponent<Velocity>(speed(random), speed(random));
+        object->AddComponent<RigidBody>(mass(random), 0.5f);
+    }
+}
+
+// Yalnizca SoA cekirdegi
+void BM_PhysicsKernel(benchmark::State& state, IntegrationMethod method) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<float> x(count, 1.0f), y(count, 2.0f), vx(count, 3.0f), vy(count, 4.0f);
+    std::vector<float> ax(count, 0.5f), ay(count, 9.8f), drag(count, 0.1f);
+
+    for (auto _ : state) {
+        PhysicsSystem::Integrate(method, x.data(), y.data(), vx.data(), vy.data(), ax.data(), ay.data(), drag.data(),
+                                 count, kDeltaTime);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Toplama, cekirdek ve geri yazma dahil tum adimin 1..N is parcacigina olceklenmesi; sonuc her durumda aynidir
+void BM_PhysicsSystemScaling(benchmark::State& state, IntegrationMethod method) {
+    Registry registry;
+    PhysicsSystem physics(method, 0.0f, 98.0f);
+    JobSystem jobs(static_cast<uint32_t>(state.range(1)));
+    CreateBodies(registry, static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        physics.Update(registry.Store(), kDeltaTime, &jobs);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_PhysicsKernel, SemiImplicitEuler, IntegrationMethod::SemiImplicitEuler)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PhysicsKernel, VelocityVerlet, IntegrationMethod::VelocityVerlet)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PhysicsSystemScaling, SemiImplicitEuler, IntegrationMethod::SemiImplicitEuler)
+    ->ArgsProduct({{1 << 20}, {0, 1, 3, 7, 15}})
+    ->ArgNames({"bodies", "workers"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(BM_PhysicsSystemScaling, VelocityVerlet, IntegrationMethod::VelocityVerlet)
+    ->ArgsProduct({{1 << 20}, {0, 1, 3, 7, 15}})
+    ->ArgNames({"bodies", "workers"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
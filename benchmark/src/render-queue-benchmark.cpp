@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "render-queue.h"
+
+namespace {
+
+// Bir karedeki istekler: birkac katman, az sayida malzeme ve renk
+std::vector<RenderQueue::SortEntry> MakeEntries(size_t count) {
+    std::mt19937_64 random(7);
+    std::vector<RenderQueue::SortEntry> entries(count);
+    for (size_t i = 0; i < count; i++) {
+        const uint64_t layer = random() % 4;
+        const uint64_t material = random() % 8;
+        const uint64_t color = random() % 32;
+        entries[i] = RenderQueue::SortEntry{(layer << 56) | (material << 32) | color, static_cast<uint32_t>(i)};
+    }
+    return entries;
+}
+
+void BM_RenderQueueRadixSort(benchmark::State& state) {
+    const auto source = MakeEntries(static_cast<size_t>(state.range(0)));
+    std::vector<RenderQueue::SortEntry> entries(source.size());
+    std::vector<RenderQueue::SortEntry> scratch(source.size());
+
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), entries.begin());
+        benchmark::DoNotOptimize(RenderQueue::RadixSort(entries.data(), scratch.data(), entries.size()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Karsilastirma icin: standart kararli siralama
+void BM_RenderQueueStableSort(benchmark::State& state) {
+    const auto source = MakeEntries(static_cast<size_t>(state.range(0)));
+    std::vector<RenderQueue::SortEntry> entries(source.size());
+
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), entries.begin());
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const auto& a, const auto& b) { return a.mKey < b.mKey; });
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_RenderQueueRadixSort)->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RenderQueueStableSort)->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
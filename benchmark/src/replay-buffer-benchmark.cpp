@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <random>
+
+#include "movement-system.h"
+#include "registry.h"
+#include "replay-buffer.h"
+
+namespace {
+
+constexpr float kWidth = 800.0f;
+constexpr float kHeight = 600.0f;
+constexpr float kDeltaTime = 1.0f / 60.0f;
+
+void FillWorld(Registry& registry, size_t count, float movingRatio) {
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> position(0.0f, kWidth);
+    std::uniform_real_distribution<float> speed(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (size_t i = 0; i < count; i++) {
+        auto* object = registry.Get(registry.Create());
+        object->AddComponent<Transform>(position(random), position(random) * 0.75f);
+        const bool moving = unit(random) < movingRatio;
+        object->AddComponent<Velocity>(moving ? speed(random) : 0.0f, moving ? speed(random) : 0.0f);
+    }
+}
+
+// Her adimda yalnizca kayit suresi olculur; hareket sistemi olcume dahil edilmez
+void BM_ReplayRecord(benchmark::State& state) {
+    Registry registry;
+    MovementSystem movement(kWidth, kHeight);
+    ReplayBuffer replay;
+    FillWorld(registry, static_cast<size_t>(state.range(0)), static_cast<float>(state.range(1)) / 100.0f);
+
+    for (auto _ : state) {
+        movement.Update(registry.Store(), kDeltaTime);
+
+        const auto start = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(replay.Record(registry));
+        const auto end = std::chrono::steady_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    state.counters["bytes_per_tick"] = static_cast<double>(replay.UsedBytes()) / static_cast<double>(replay.FrameCount());
+}
+
+// En kotu durum: anahtar kareden sonra KeyframeInterval - 1 fark uygulanir
+void BM_ReplaySeekWorstCase(benchmark::State& state) {
+    Registry registry;
+    MovementSystem movement(kWidth, kHeight);
+    ReplayBuffer replay;
+    FillWorld(registry, static_cast<size_t>(state.range(0)), 1.0f);
+
+    for (uint32_t tick = 0; tick < 4 * replay.KeyframeInterval(); tick++) {
+        movement.Update(registry.Store(), kDeltaTime);
+        replay.Record(registry);
+    }
+    const uint64_t target = replay.NewestTick();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(replay.Seek(registry, target));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ReplayRecord)
+    ->ArgsProduct({{100, 1000, 10000}, {0, 10, 100}})
+    ->ArgNames({"objects", "moving%"})
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReplaySeekWorstCase)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "registry.h"
+#include "spatial-hash-grid.h"
+
+namespace {
+
+constexpr float kWidth = 4000.0f;
+constexpr float kHeight = 3000.0f;
+constexpr float kQueryRadius = 16.0f;
+
+Registry& BuildRegistry(size_t objectCount) {
+    static Registry* sRegistry = nullptr;
+    static size_t sObjectCount = 0;
+    if (!sRegistry || sObjectCount != objectCount) {
+        delete sRegistry;
+        sRegistry = new Registry();
+        sObjectCount = objectCount;
+        sRegistry->Reserve(objectCount);
+
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> x(0.0f, kWidth);
+        std::uniform_real_distribution<float> y(0.0f, kHeight);
+        for (size_t i = 0; i < objectCount; i++) {
+            Entity entity = sRegistry->Create();
+            sRegistry->Get(entity)->AddComponent<Transform>(x(random), y(random));
+        }
+    }
+    return *sRegistry;
+}
+
+// Tum konumlarin toplanmasi ve sayarak siralama ile yeniden dizilmesi: hedef 500k nokta icin 16 ms'nin cok altinda
+void BM_SpatialGridBuild(benchmark::State& state) {
+    Registry& registry = BuildRegistry(static_cast<size_t>(state.range(0)));
+    SpatialHashGrid grid(2.0f * kQueryRadius);
+
+    for (auto _ : state) {
+        grid.Build(registry);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Her noktanin cevresinde yaricap sorgusu; kaba kuvvetle bu O(N^2) olurdu
+void BM_SpatialGridRadiusQueries(benchmark::State& state) {
+    Registry& registry = BuildRegistry(static_cast<size_t>(state.range(0)));
+    SpatialHashGrid grid(2.0f * kQueryRadius);
+    grid.Build(registry);
+
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> x(0.0f, kWidth);
+    std::uniform_real_distribution<float> y(0.0f, kHeight);
+    std::vector<SDL_FPoint> queries(10000);
+    for (SDL_FPoint& query : queries) {
+        query = SDL_FPoint{x(random), y(random)};
+    }
+
+    for (auto _ : state) {
+        size_t found = 0;
+        for (const SDL_FPoint& query : queries) {
+            grid.ForEachInRadius(query.x, query.y, kQueryRadius, [&found](Entity) { found++; });
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(queries.size()));
+}
+
+BENCHMARK(BM_SpatialGridBuild)->Arg(100000)->Arg(500000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SpatialGridRadiusQueries)->Arg(500000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "registry.h"
+#include "render-strategies.h"
+
+namespace {
+
+// Havuz kullanmayan, karsilastirma amacli ayni boyutta bir strateji
+class HeapCircleRenderer : public RenderStrategy {
+private:
+    SDL_Color mColor;
+    int32_t mRadius;
+
+public:
+    HeapCircleRenderer(SDL_Color color, int32_t radius) : mColor(color), mRadius(radius) {}
+    void Render(SDL_Renderer*, const Transform&) override {}
+    ShapeDesc GetShape() const override { return ShapeDesc{ShapeType::Circle, 2.0f * mRadius, 2.0f * mRadius}; }
+    SDL_FColor GetColor() const override { return SDL_FColor{1.0f, 0.0f, 0.0f, 1.0f}; }
+};
+
+template<typename Strategy>
+void BM_StrategyChurn(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<std::unique_ptr<RenderStrategy>> strategies(count);
+
+    for (auto _ : state) {
+        for (auto& strategy : strategies) {
+            strategy = std::make_unique<Strategy>(SDL_Color{255, 0, 0, 255}, 25);
+        }
+        for (auto& strategy : strategies) {
+            strategy.reset();
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(BM_StrategyChurn, HeapCircleRenderer)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_StrategyChurn, CircleRenderer)->Arg(100000);
+
+// Ayni kayit uzerinde nesnelerin toplu olusturulup silinmesi; ilk turdan sonra tum yerler geri kullanilir
+void BM_SpawnBurst(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Registry registry(static_cast<PoolBacking>(state.range(1)));
+    std::vector<Entity> entities(count);
+
+    for (auto _ : state) {
+        for (auto& entity : entities) {
+            entity = registry.Create();
+            GraphicalObject* object = registry.Get(entity);
+            object->AddComponent<Transform>(10.0f, 20.0f);
+            object->AddComponent<Velocity>(1.0f, 2.0f);
+            object->AddComponent<RenderComponent>(std::make_unique<CircleRenderer>(SDL_Color{255, 0, 0, 255}, 25));
+        }
+        for (const auto& entity : entities) {
+            registry.Destroy(entity);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(BM_SpawnBurst)
+    ->Args({100000, static_cast<int64_t>(PoolBacking::Heap)})
+    ->Args({100000, static_cast<int64_t>(PoolBacking::HugePages)})
+    ->Unit(benchmark::kMillisecond);
+
+// Tek tek olusturma ile prefab uzerinden toplu olusturmanin karsilastirmasi. Dalga her turda ayni kayda
+// eklenip silinir, boylece olcum ilk bellek ayirma yerine calisan bir dunyadaki dalga maliyetini gosterir.
+template<typename SpawnFn>
+void RunSpawnWave(benchmark::State& state, SpawnFn&& spawn) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Registry registry;
+    std::vector<Entity> entities;
+
+    for (auto _ : state) {
+        spawn(registry, count, entities);
+
+        state.PauseTiming();
+        for (const auto& entity : entities) {
+            registry.Destroy(entity);
+        }
+        entities.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_SpawnOneByOne(benchmark::State& state) {
+    RunSpawnWave(state, [](Registry& registry, size_t count, std::vector<Entity>& entities) {
+        for (size_t i = 0; i < count; i++) {
+            entities.push_back(GraphicalObjectFactory::CreateCircle(registry, 10.0f, 20.0f));
+        }
+    });
+}
+
+void BM_SpawnManyPrefab(benchmark::State& state) {
+    std::vector<SDL_FPoint> positions(static_cast<size_t>(state.range(0)), SDL_FPoint{10.0f, 20.0f});
+
+    RunSpawnWave(state, [&positions](Registry& registry, size_t count, std::vector<Entity>& entities) {
+        entities = GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(),
+                                                     count, positions);
+    });
+}
+
+BENCHMARK(BM_SpawnOneByOne)->Arg(5000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SpawnManyPrefab)->Arg(5000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
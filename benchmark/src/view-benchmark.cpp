@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include "component-store.h"
+#include "view.h"
+
+namespace {
+
+// Nesnelerin yalnizca bir kismi hem Transform hem Velocity bilesenine sahiptir
+ComponentStore& BuildStore(size_t objectCount, size_t movingEvery) {
+    static ComponentStore* sStore = nullptr;
+    static size_t sObjectCount = 0;
+    if (!sStore || sObjectCount != objectCount) {
+        delete sStore;
+        sStore = new ComponentStore();
+        sObjectCount = objectCount;
+        for (size_t i = 0; i < objectCount; i++) {
+            ObjectId id = sStore->CreateObject();
+            sStore->Add<Transform>(id, 1.0f, 1.0f);
+            if (i % movingEvery == 0) {
+                sStore->Add<Velocity>(id, 1.0f, 1.0f);
+            }
+        }
+    }
+    return *sStore;
+}
+
+// Her nesnenin bilesenlerini tek tek sorgulama
+void BM_ProbeEveryObject(benchmark::State& state) {
+    ComponentStore& store = BuildStore(static_cast<size_t>(state.range(0)), 4);
+    auto& transforms = store.Pool<Transform>();
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (uint32_t i = 0; i < transforms.Size(); i++) {
+            ObjectId id = transforms.OwnerAt(i);
+            if (auto* velocity = store.Get<Velocity>(id)) {
+                sum += store.Get<Transform>(id)->mX * velocity->mVx;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Onbellege alinmis eslesme listesi uzerinden gezinme
+void BM_ViewIteration(benchmark::State& state) {
+    ComponentStore& store = BuildStore(static_cast<size_t>(state.range(0)), 4);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        View<Transform, Velocity> view(store);
+        view.ForEach([&sum](Transform& transform, Velocity& velocity) {
+            sum += transform.mX * velocity.mVx;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_ProbeEveryObject)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ViewIteration)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
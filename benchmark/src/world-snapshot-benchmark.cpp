@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "registry.h"
+#include "render-strategies.h"
+#include "world-snapshot.h"
+
+namespace {
+
+const std::filesystem::path kScenePath = std::filesystem::temp_directory_path() / "world-snapshot-benchmark.sdlw";
+
+std::vector<SDL_FPoint> ScenePositions(size_t count) {
+    std::mt19937 random(11);
+    std::uniform_real_distribution<float> position(0.0f, 20000.0f);
+    std::vector<SDL_FPoint> positions(count);
+    for (SDL_FPoint& point : positions) {
+        point = SDL_FPoint{position(random), position(random)};
+    }
+    return positions;
+}
+
+// Sahne bugunku gibi fabrika uzerinden nesne nesne kurulur
+void BM_SceneBuildWithFactory(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    const std::vector<SDL_FPoint> positions = ScenePositions(count);
+
+    for (auto _ : state) {
+        auto registry = std::make_unique<Registry>(static_cast<PoolBacking>(state.range(1)));
+        for (const SDL_FPoint& point : positions) {
+            GraphicalObjectFactory::Spawn(*registry, GraphicalObjectFactory::RectanglePrefab(), point.x, point.y);
+        }
+        benchmark::DoNotOptimize(registry->Size());
+
+        state.PauseTiming();
+        registry.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Ayni sahne diskteki dosyadan yuklenir
+void BM_SceneLoadSnapshot(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    {
+        Registry source;
+        const std::vector<SDL_FPoint> positions = ScenePositions(count);
+        GraphicalObjectFactory::SpawnMany(source, GraphicalObjectFactory::RectanglePrefab(), count, positions);
+        WorldSnapshot::Save(source, kScenePath.string());
+    }
+
+    for (auto _ : state) {
+        auto registry = std::make_unique<Registry>(static_cast<PoolBacking>(state.range(1)));
+        benchmark::DoNotOptimize(WorldSnapshot::Load(*registry, kScenePath.string()).size());
+
+        state.PauseTiming();
+        registry.reset();
+        state.ResumeTiming();
+    }
+
+    std::filesystem::remove(kScenePath);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_SceneSaveSnapshot(benchmark::State& state) {
+    const auto count = static_cast<size_t>(state.range(0));
+    Registry registry;
+    const std::vector<SDL_FPoint> positions = ScenePositions(count);
+    GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::RectanglePrefab(), count, positions);
+
+    for (auto _ : state) {
+        WorldSnapshot::Save(registry, kScenePath.string());
+    }
+
+    std::filesystem::remove(kScenePath);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_SceneBuildWithFactory)
+    ->Args({1000000, static_cast<int64_t>(PoolBacking::Heap)})
+    ->Args({1000000, static_cast<int64_t>(PoolBacking::HugePages)})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SceneLoadSnapshot)
+    ->Args({1000000, static_cast<int64_t>(PoolBacking::Heap)})
+    ->Args({1000000, static_cast<int64_t>(PoolBacking::HugePages)})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SceneSaveSnapshot)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+} // namespace
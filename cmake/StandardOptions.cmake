@@ -1,3 +1,4 @@
 option(BUILD_TESTING "Build tests" TRUE)
+option(BUILD_BENCHMARKS "Build benchmarks" FALSE)
 option(BUILD_SHARED_LIBS "Build shared libraries" FALSE)
 option(BUILD_WITH_MT "Build libraries as MultiThreaded DLL (Windows Only)" FALSE)
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "collision.h"
+#include "registry.h"
+
+namespace {
+
+ShapeDesc Box(float width, float height) {
+    return ShapeDesc{ShapeType::Rectangle, width, height};
+}
+
+ShapeDesc Circle(float radius) {
+    return ShapeDesc{ShapeType::Circle, 2.0f * radius, 2.0f * radius};
+}
+
+ShapeDesc Triangle(float edge) {
+    return ShapeDesc{ShapeType::Triangle, edge, edge * 0.866f};
+}
+
+} // namespace
+
+// Test fixture for CollisionWorld tests
+class CollisionTest : public ::testing::Test {
+protected:
+    Registry registry;
+    CollisionWorld world;
+
+    Entity CreateBody(const ShapeDesc& shape, float x, float y, uint32_t layer = 1, uint32_t mask = ~0u) {
+        Entity entity = registry.Create();
+        registry.Get(entity)->AddComponent<Transform>(x, y);
+        registry.Get(entity)->AddComponent<Collider>(shape, layer, mask);
+        return entity;
+    }
+
+    const std::vector<Contact>& Update() {
+        world.Update(registry);
+        return world.Contacts();
+    }
+};
+
+TEST_F(CollisionTest, OverlappingCirclesShouldProduceContactFromFirstToSecond) {
+    // Arrange
+    Entity first = CreateBody(Circle(10.0f), 0.0f, 0.0f);
+    Entity second = CreateBody(Circle(10.0f), 15.0f, 0.0f);
+
+    // Act
+    const auto& contacts = Update();
+
+    // Assert
+    ASSERT_EQ(contacts.size(), 1u);
+    EXPECT_EQ(contacts[0].mA, first);
+    EXPECT_EQ(contacts[0].mB, second);
+    EXPECT_FLOAT_EQ(contacts[0].mNormalX, 1.0f);
+    EXPECT_FLOAT_EQ(contacts[0].mNormalY, 0.0f);
+    EXPECT_FLOAT_EQ(contacts[0].mDepth, 5.0f);
+}
+
+TEST_F(CollisionTest, SeparatedShapesShouldNotCollide) {
+    // Arrange
+    CreateBody(Circle(10.0f), 0.0f, 0.0f);
+    CreateBody(Box(10.0f, 10.0f), 100.0f, 0.0f);
+    CreateBody(Triangle(20.0f), 0.0f, 100.0f);
+
+    // Act
+    const auto& contacts = Update();
+
+    // Assert
+    EXPECT_TRUE(contacts.empty());
+    EXPECT_EQ(world.CandidatePairCount(), 0u);
+}
+
+TEST_F(CollisionTest, CircleTouchingBoxCornerRegionShouldBeTestedExactly) {
+    // Arrange
+    CreateBody(Box(20.0f, 20.0f), 0.0f, 0.0f);
+    CreateBody(Circle(5.0f), 14.0f, 14.0f);
+
+    // Act
+    const auto& contacts = Update();
+
+    // Assert
+    EXPECT_EQ(world.CandidatePairCount(), 1u);
+    EXPECT_TRUE(contacts.empty());
+}
+
+TEST_F(CollisionTest, BoxAndCircleContactNormalShouldPointFromLowerIdToHigherId) {
+    // Arrange
+    Entity circle = CreateBody(Circle(5.0f), 13.0f, 0.0f);
+    Entity box = CreateBody(Box(20.0f, 20.0f), 0.0f, 0.0f);
+
+    // Act
+    const auto& contacts = Update();
+
+    // Assert
+    ASSERT_EQ(contacts.size(), 1u);
+    EXPECT_EQ(contacts[0].mA, circle);
+    EXPECT_EQ(contacts[0].mB, box);
+    EXPECT_FLOAT_EQ(contacts[0].mNormalX, -1.0f);
+    EXPECT_FLOAT_EQ(contacts[0].mDepth, 2.0f);
+}
+
+TEST_F(CollisionTest, OverlappingBoxesShouldSeparateAlongSmallestAxis) {
+    // Arrange
+    CreateBody(Box(20.0f, 20.0f), 0.0f, 0.0f);
+    CreateBody(Box(20.0f, 20.0f), 5.0f, 18.0f);
+
+    // Act
+    const auto& contacts = Update();
+
+    // Assert
+    ASSERT_EQ(contacts.size(), 1u);
+    EXPECT_FLOAT_EQ(contacts[0].mNormalX, 0.0f);
+    EXPECT_FLOAT_EQ(contacts[0].mNormalY, 1.0f);
+    EXPECT_FLOAT_EQ(contacts[0].mDepth, 2.0f);
+}
+
+TEST_F(CollisionTest, TriangleShouldCollideWithBoxAndCircleUsingRotatedVertices) {
+    // Arrange
+    Entity triangle = CreateBody(Triangle(30.0f), 0.0f, 0.0f);
+    CreateBody(Box(10.0f, 10.0f), 0.0f, -20.0f);
+    CreateBody(Circle(4.0f), 0.0f, 14.0f);
+
+    // Act
+    const size_t uprightContacts = Update().size();
+    registry.Get(triangle)->GetComponent<Transform>()->mRotation = 3.14159265f;
+    const size_t flippedContacts = Update().size();
+
+    // Assert
+    EXPECT_EQ(uprightContacts, 1u);
+    EXPECT_EQ(flippedContacts, 1u);
+}
+
+TEST_F(CollisionTest, LayerMasksShouldFilterPairs) {
+    // Arrange
+    CreateBody(Circle(10.0f), 0.0f, 0.0f, 0x1, 0x2);
+    CreateBody(Circle(10.0f), 5.0f, 0.0f, 0x1, 0x2);
+    CreateBody(Circle(10.0f), 10.0f, 0.0f, 0x2, 0x1);
+
+    // Act
+    const auto& contacts = Update();
+
+    // Assert
+    EXPECT_EQ(contacts.size(), 2u);
+}
+
+TEST_F(CollisionTest, RemovedColliderShouldNoLongerCollide) {
+    // Arrange
+    Entity first = CreateBody(Circle(10.0f), 0.0f, 0.0f);
+    CreateBody(Circle(10.0f), 5.0f, 0.0f);
+    Update();
+
+    // Act
+    registry.Get(first)->RemoveComponent<Collider>();
+    const auto& contacts = Update();
+
+    // Assert
+    EXPECT_TRUE(contacts.empty());
+}
+
+TEST_F(CollisionTest, SimdKernelsShouldMatchScalarResults) {
+    // Arrange
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> value(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> size(0.5f, 10.0f);
+    const size_t count = 103;
+    std::vector<float> ax(count), ay(count), ar(count), bx(count), by(count), br(count), bh(count);
+    for (size_t i = 0; i < count; i++) {
+        ax[i] = value(random); ay[i] = value(random); ar[i] = size(random);
+        bx[i] = value(random); by[i] = value(random); br[i] = size(random); bh[i] = size(random);
+    }
+    std::vector<uint8_t> circleHits(count), boxHits(count);
+
+    // Act
+    CollisionWorld::OverlapCircles(ax.data(), ay.data(), ar.data(), bx.data(), by.data(), br.data(), count,
+                                   circleHits.data());
+    CollisionWorld::OverlapBoxCircles(ax.data(), ay.data(), ar.data(), bh.data(), bx.data(), by.data(), br.data(),
+                                      count, boxHits.data());
+
+    // Assert
+    for (size_t i = 0; i < count; i++) {
+        const float dx = bx[i] - ax[i];
+        const float dy = by[i] - ay[i];
+        const float radius = ar[i] + br[i];
+        EXPECT_EQ(circleHits[i] != 0, dx * dx + dy * dy < radius * radius) << i;
+
+        const float ox = std::max(std::fabs(dx) - ar[i], 0.0f);
+        const float oy = std::max(std::fabs(dy) - bh[i], 0.0f);
+        EXPECT_EQ(boxHits[i] != 0, ox * ox + oy * oy < br[i] * br[i]) << i;
+    }
+}
+
+TEST_F(CollisionTest, ContactsShouldMatchBruteForceAcrossMovingFrames) {
+    // Arrange
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> position(0.0f, 400.0f);
+    std::uniform_real_distribution<float> step(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> size(2.0f, 8.0f);
+    struct Body { Entity mEntity; bool mCircle; float mHalf; };
+    std::vector<Body> bodies;
+    for (int i = 0; i < 600; i++) {
+        const bool circle = i % 2 == 0;
+        const float half = size(random);
+        bodies.push_back(Body{CreateBody(circle ? Circle(half) : Box(2.0f * half, 2.0f * half),
+                                         position(random), position(random)), circle, half});
+    }
+
+    for (int frame = 0; frame < 5; frame++) {
+        // Act
+        for (const Body& body : bodies) {
+            auto* transform = registry.Get(body.mEntity)->GetComponent<Transform>();
+            transform->mX += step(random);
+            transform->mY += step(random);
+        }
+        std::set<std::pair<uint32_t, uint32_t>> found;
+        for (const Contact& contact : Update()) {
+            found.emplace(contact.mA.mIndex, contact.mB.mIndex);
+        }
+
+        // Assert
+        std::set<std::pair<uint32_t, uint32_t>> expected;
+        for (size_t i = 0; i < bodies.size(); i++) {
+            for (size_t j = i + 1; j < bodies.size(); j++) {
+                const Body& a = bodies[i].mCircle || !bodies[j].mCircle ? bodies[i] : bodies[j];
+                const Body& b = &a == &bodies[i] ? bodies[j] : bodies[i];
+                const auto* ta = registry.Get(a.mEntity)->GetComponent<Transform>();
+                const auto* tb = registry.Get(b.mEntity)->GetComponent<Transform>();
+                const float dx = std::fabs(tb->mX - ta->mX);
+                const float dy = std::fabs(tb->mY - ta->mY);
+                bool hit = false;
+                if (a.mCircle && b.mCircle) {
+                    hit = dx * dx + dy * dy < (a.mHalf + b.mHalf) * (a.mHalf + b.mHalf);
+                } else if (!a.mCircle && !b.mCircle) {
+                    hit = dx < a.mHalf + b.mHalf && dy < a.mHalf + b.mHalf;
+                } else {
+                    // a daire, b kutu
+                    const float ox = std::max(dx - b.mHalf, 0.0f);
+                    const float oy = std::max(dy - b.mHalf, 0.0f);
+                    hit = ox * ox + oy * oy < a.mHalf * a.mHalf;
+                }
+                if (hit) {
+                    expected.emplace(std::min(a.mEntity.mIndex, b.mEntity.mIndex),
+                                     std::max(a.mEntity.mIndex, b.mEntity.mIndex));
+                }
+            }
+        }
+        EXPECT_EQ(found, expected) << "frame " << frame;
+    }
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "command-buffer.h"
+#include "job-system.h"
+#include "registry.h"
+#include "render-strategies.h"
+#include "system-scheduler.h"
+
+// Test fixture for CommandBuffer tests
+class CommandBufferTest : public ::testing::Test {
+protected:
+    Registry registry;
+    CommandBuffer& commands = registry.Commands();
+};
+
+TEST_F(CommandBufferTest, CommandsShouldNotTakeEffectBeforeApply) {
+    // Arrange
+    Entity entity = registry.Create();
+
+    // Act
+    commands.AddComponent<Transform>(entity, 1.0f, 2.0f);
+    commands.Spawn();
+
+    // Assert
+    EXPECT_EQ(commands.Size(), 2u);
+    EXPECT_EQ(registry.Size(), 1u);
+    EXPECT_EQ(registry.Get(entity)->GetComponent<Transform>(), nullptr);
+}
+
+TEST_F(CommandBufferTest, ApplyShouldSpawnAndAddComponentsToDeferredEntities) {
+    // Arrange
+    Entity deferred = commands.Spawn();
+    commands.AddComponent<Transform>(deferred, 5.0f, 6.0f);
+    commands.AddComponent<RenderComponent>(deferred, std::make_unique<CircleRenderer>(SDL_Color{0, 0, 0, 255}, 3));
+
+    // Act
+    commands.Apply(registry);
+
+    // Assert
+    EXPECT_TRUE(CommandBuffer::IsDeferred(deferred));
+    EXPECT_EQ(commands.Size(), 0u);
+    ASSERT_EQ(registry.Size(), 1u);
+
+    GraphicalObject* object = nullptr;
+    registry.ForEach([&object](GraphicalObject& current) { object = &current; });
+    auto* transform = object->GetComponent<Transform>();
+    ASSERT_NE(transform, nullptr);
+    EXPECT_FLOAT_EQ(transform->mX, 5.0f);
+    EXPECT_EQ(transform->mOwner, object);
+    EXPECT_EQ(object->GetComponent<RenderComponent>()->GetBoundTransform(), transform);
+}
+
+TEST_F(CommandBufferTest, ApplyShouldSpawnFromPrefab) {
+    // Act
+    commands.Spawn(GraphicalObjectFactory::CirclePrefab(), 10.0f, 20.0f);
+    commands.Apply(registry);
+
+    // Assert
+    ASSERT_EQ(registry.Size(), 1u);
+    registry.ForEach([](GraphicalObject& object) {
+        EXPECT_FLOAT_EQ(object.GetComponent<Transform>()->mY, 20.0f);
+        EXPECT_EQ(object.GetComponent<RenderComponent>()->GetStrategy(),
+                  GraphicalObjectFactory::CirclePrefab().mStrategy);
+    });
+}
+
+TEST_F(CommandBufferTest, ApplyShouldRemoveComponentsAndDestroyEntities) {
+    // Arrange
+    Entity kept = registry.Create();
+    Entity destroyed = registry.Create();
+    registry.Get(kept)->AddComponent<Transform>();
+    registry.Get(kept)->AddComponent<Velocity>();
+    registry.Get(destroyed)->AddComponent<Transform>();
+
+    // Act
+    commands.RemoveComponent<Velocity>(kept);
+    commands.Destroy(destroyed);
+    commands.Apply(registry);
+
+    // Assert
+    EXPECT_NE(registry.Get(kept)->GetComponent<Transform>(), nullptr);
+    EXPECT_EQ(registry.Get(kept)->GetComponent<Velocity>(), nullptr);
+    EXPECT_FALSE(registry.IsAlive(destroyed));
+}
+
+TEST_F(CommandBufferTest, RemoveThenAddShouldKeepTheNewComponent) {
+    // Arrange
+    Entity entity = registry.Create();
+    registry.Get(entity)->AddComponent<Velocity>(1.0f, 1.0f);
+
+    // Act
+    commands.RemoveComponent<Velocity>(entity);
+    commands.AddComponent<Velocity>(entity, 7.0f, 8.0f);
+    commands.Apply(registry);
+
+    // Assert
+    auto* velocity = registry.Get(entity)->GetComponent<Velocity>();
+    ASSERT_NE(velocity, nullptr);
+    EXPECT_FLOAT_EQ(velocity->mVx, 7.0f);
+    EXPECT_FLOAT_EQ(velocity->mVy, 8.0f);
+}
+
+TEST_F(CommandBufferTest, AddThenRemoveShouldLeaveNoComponent) {
+    // Arrange
+    Entity entity = registry.Create();
+
+    // Act
+    commands.AddComponent<Velocity>(entity, 7.0f, 8.0f);
+    commands.RemoveComponent<Velocity>(entity);
+    commands.Apply(registry);
+
+    // Assert
+    EXPECT_EQ(registry.Get(entity)->GetComponent<Velocity>(), nullptr);
+}
+
+TEST_F(CommandBufferTest, CommandsForStaleEntitiesShouldBeIgnored) {
+    // Arrange
+    Entity stale = registry.Create();
+    registry.Destroy(stale);
+    Entity reused = registry.Create();
+
+    // Act
+    commands.AddComponent<Transform>(stale, 1.0f, 1.0f);
+    commands.Destroy(stale);
+    commands.Apply(registry);
+
+    // Assert
+    EXPECT_TRUE(registry.IsAlive(reused));
+    EXPECT_EQ(registry.Get(reused)->GetComponent<Transform>(), nullptr);
+}
+
+TEST_F(CommandBufferTest, ClearShouldDropCommandsWithoutApplying) {
+    // Arrange
+    auto strategy = std::make_shared<CircleRenderer>(SDL_Color{0, 0, 0, 255}, 3);
+    Entity entity = registry.Create();
+    commands.AddComponent<RenderComponent>(entity, strategy);
+
+    // Act
+    commands.Clear();
+
+    // Assert
+    EXPECT_EQ(commands.Size(), 0u);
+    EXPECT_EQ(strategy.use_count(), 1);
+    EXPECT_EQ(registry.Get(entity)->GetComponent<RenderComponent>(), nullptr);
+}
+
+TEST_F(CommandBufferTest, RecordingFromWorkerThreadsShouldApplyEveryCommand) {
+    // Arrange
+    JobSystem jobs(3);
+
+    // Act
+    jobs.ParallelFor(4000, 100, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Entity entity = commands.Spawn();
+            commands.AddComponent<Transform>(entity, static_cast<float>(i), 0.0f);
+        }
+    });
+    commands.Apply(registry);
+
+    // Assert
+    ASSERT_EQ(registry.Size(), 4000u);
+    std::vector<bool> seen(4000, false);
+    registry.ForEach([&seen](GraphicalObject& object) {
+        seen[static_cast<size_t>(object.GetComponent<Transform>()->mX)] = true;
+    });
+    for (bool value : seen) {
+        EXPECT_TRUE(value);
+    }
+}
+
+namespace {
+
+class SpawningSystem : public System {
+public:
+    ComponentMask Reads() const override { return 0; }
+    ComponentMask Writes() const override { return 0; }
+    void Run(Registry& registry, JobSystem&, float) override {
+        registry.ForEach([&registry](GraphicalObject& object) {
+            registry.Commands().Destroy(object.GetEntity());
+            registry.Commands().Spawn();
+        });
+    }
+};
+
+} // namespace
+
+TEST_F(CommandBufferTest, SchedulerRunShouldApplyCommandsAtTheEnd) {
+    // Arrange
+    JobSystem jobs(0);
+    SystemScheduler scheduler(jobs);
+    scheduler.AddSystem(std::make_unique<SpawningSystem>());
+    Entity first = registry.Create();
+    registry.Create();
+
+    // Act
+    scheduler.Run(registry, 0.016f);
+
+    // Assert
+    EXPECT_EQ(registry.Size(), 2u);
+    EXPECT_FALSE(registry.IsAlive(first));
+    EXPECT_EQ(commands.Size(), 0u);
+}
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "component-store.h"
+#include "graphical-object-factory.h"
+
+// Test fixture for ComponentStore tests
+class ComponentStoreTest : public ::testing::Test {
+protected:
+    ComponentStore store;
+};
+
+// Pool Tests
+TEST_F(ComponentStoreTest, AddShouldStoreComponentAndGetShouldReturnIt) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+
+    // Act
+    auto* transform = store.Add<Transform>(id, 10.0f, 20.0f);
+
+    // Assert
+    ASSERT_NE(transform, nullptr);
+    EXPECT_EQ(store.Get<Transform>(id), transform);
+    EXPECT_FLOAT_EQ(transform->mX, 10.0f);
+    EXPECT_FLOAT_EQ(transform->mY, 20.0f);
+}
+
+TEST_F(ComponentStoreTest, GetShouldReturnNullForMissingComponent) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    store.Add<Transform>(id);
+
+    // Act & Assert
+    EXPECT_EQ(store.Get<Velocity>(id), nullptr);
+    EXPECT_EQ(store.Get<Transform>(id + 100), nullptr);
+}
+
+TEST_F(ComponentStoreTest, ComponentsOfSameTypeShouldBeContiguous) {
+    // Arrange
+    std::vector<Transform*> transforms;
+
+    // Act
+    for (int i = 0; i < 16; i++) {
+        transforms.push_back(store.Add<Transform>(store.CreateObject(), static_cast<float>(i), 0.0f));
+    }
+
+    // Assert
+    for (size_t i = 1; i < transforms.size(); i++) {
+        EXPECT_EQ(transforms[i], transforms[i - 1] + 1);
+    }
+}
+
+TEST_F(ComponentStoreTest, GrowingPoolShouldNotMoveExistingComponents) {
+    // Arrange
+    ObjectId first = store.CreateObject();
+    auto* transform = store.Add<Transform>(first, 1.0f, 2.0f);
+
+    // Act
+    for (uint32_t i = 0; i < ComponentPool<Transform>::kPageSize * 3; i++) {
+        store.Add<Transform>(store.CreateObject());
+    }
+
+    // Assert
+    EXPECT_EQ(store.Get<Transform>(first), transform);
+    EXPECT_FLOAT_EQ(transform->mX, 1.0f);
+}
+
+TEST_F(ComponentStoreTest, RemoveShouldKeepRemainingComponentsReachable) {
+    // Arrange
+    ObjectId a = store.CreateObject();
+    ObjectId b = store.CreateObject();
+    ObjectId c = store.CreateObject();
+    store.Add<Velocity>(a, 1.0f, 0.0f);
+    store.Add<Velocity>(b, 2.0f, 0.0f);
+    store.Add<Velocity>(c, 3.0f, 0.0f);
+
+    // Act
+    store.Remove<Velocity>(a);
+
+    // Assert
+    EXPECT_EQ(store.Get<Velocity>(a), nullptr);
+    EXPECT_FLOAT_EQ(store.Get<Velocity>(b)->mVx, 2.0f);
+    EXPECT_FLOAT_EQ(store.Get<Velocity>(c)->mVx, 3.0f);
+    EXPECT_EQ(store.Pool<Velocity>().Size(), 2u);
+}
+
+TEST_F(ComponentStoreTest, DestroyObjectShouldRemoveAllComponentsAndRecycleId) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    store.Add<Transform>(id);
+    store.Add<Velocity>(id);
+
+    // Act
+    store.DestroyObject(id);
+    ObjectId recycled = store.CreateObject();
+
+    // Assert
+    EXPECT_EQ(recycled, id);
+    EXPECT_EQ(store.Get<Transform>(recycled), nullptr);
+    EXPECT_EQ(store.Get<Velocity>(recycled), nullptr);
+}
+
+TEST_F(ComponentStoreTest, ForEachShouldVisitEveryComponentWithItsOwner) {
+    // Arrange
+    for (int i = 0; i < 5; i++) {
+        ObjectId id = store.CreateObject();
+        store.Add<Velocity>(id, static_cast<float>(id), 0.0f);
+    }
+
+    // Act
+    int visited = 0;
+    store.Pool<Velocity>().ForEach([&visited](ObjectId id, Velocity& velocity) {
+        EXPECT_FLOAT_EQ(velocity.mVx, static_cast<float>(id));
+        visited++;
+    });
+
+    // Assert
+    EXPECT_EQ(visited, 5);
+}
+
+// GraphicalObject view Tests
+TEST_F(ComponentStoreTest, GraphicalObjectShouldAddComponentsIntoStore) {
+    // Arrange
+    GraphicalObject object(store, Entity{store.CreateObject(), 0});
+
+    // Act
+    auto* transform = object.AddComponent<Transform>(3.0f, 4.0f);
+
+    // Assert
+    EXPECT_EQ(transform->mOwner, &object);
+    EXPECT_EQ(object.GetComponent<Transform>(), transform);
+    EXPECT_EQ(store.Get<Transform>(object.GetId()), transform);
+    EXPECT_EQ(object.GetComponent<Velocity>(), nullptr);
+}
+
+TEST_F(ComponentStoreTest, GraphicalObjectRemoveComponentShouldReleaseIt) {
+    // Arrange
+    GraphicalObject object(store, Entity{store.CreateObject(), 0});
+    object.AddComponent<Transform>();
+
+    // Act
+    object.RemoveComponent<Transform>();
+
+    // Assert
+    EXPECT_EQ(object.GetComponent<Transform>(), nullptr);
+    EXPECT_EQ(store.Pool<Transform>().Size(), 0u);
+}
+
+// Type id and mask Tests
+TEST_F(ComponentStoreTest, ComponentTypeIdsShouldBeStableAndDistinct) {
+    // Act & Assert
+    EXPECT_EQ(ComponentTypeOf<Transform>(), ComponentTypeOf<Transform>());
+    EXPECT_NE(ComponentTypeOf<Transform>(), ComponentTypeOf<Velocity>());
+    EXPECT_LT(ComponentTypeOf<RenderComponent>(), kMaxComponentTypes);
+}
+
+TEST_F(ComponentStoreTest, MaskShouldTrackAddedAndRemovedComponents) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+
+    // Act
+    store.Add<Transform>(id);
+    store.Add<Velocity>(id);
+    store.Remove<Transform>(id);
+
+    // Assert
+    EXPECT_EQ(store.GetMask(id), ComponentMaskOf<Velocity>());
+}
+
+TEST_F(ComponentStoreTest, ForEachComponentShouldVisitOnlyOwnedComponents) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    ObjectId other = store.CreateObject();
+    store.Add<Transform>(id);
+    store.Add<Velocity>(id);
+    store.Add<Transform>(other);
+
+    // Act
+    int visited = 0;
+    store.ForEachComponent(id, [&visited](Component&) { visited++; });
+
+    // Assert
+    EXPECT_EQ(visited, 2);
+}
+
+TEST_F(ComponentStoreTest, FindPoolShouldNotCreateMissingPool) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    store.Add<Transform>(id);
+
+    // Act
+    ComponentPool<Velocity>* missing = store.FindPool<Velocity>();
+    ComponentPool<Transform>* existing = store.FindPool<Transform>();
+
+    // Assert
+    EXPECT_EQ(missing, nullptr);
+    EXPECT_EQ(store.FindPool<Velocity>(), nullptr);
+    EXPECT_EQ(existing, &store.Pool<Transform>());
+}
+
+TEST_F(ComponentStoreTest, ChangeListShouldCollectAddsRemovesAndMarksOnce) {
+    // Arrange
+    ObjectId existing = store.CreateObject();
+    ObjectId added = store.CreateObject();
+    ObjectId untouched = store.CreateObject();
+    store.Add<Transform>(existing);
+    store.Add<Transform>(untouched);
+    ChangeList changes;
+    store.Track<Transform>(changes);
+    changes.Clear();
+
+    // Act
+    store.Add<Transform>(added);
+    store.MarkChanged<Transform>(existing);
+    store.MarkChanged<Transform>(existing);
+    store.Remove<Transform>(added);
+
+    // Assert
+    std::vector<ObjectId> ids(changes.Ids().begin(), changes.Ids().end());
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, (std::vector<ObjectId>{existing, added}));
+}
+
+TEST_F(ComponentStoreTest, ChangeListsShouldNotClearEachOther) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    ChangeList first;
+    ChangeList second;
+    store.Track<Transform>(first);
+    store.Track<Transform>(second);
+
+    // Act
+    store.Add<Transform>(id);
+    first.Clear();
+
+    // Assert
+    EXPECT_TRUE(first.Ids().empty());
+    ASSERT_EQ(second.Ids().size(), 1u);
+    EXPECT_EQ(second.Ids()[0], id);
+}
+
+TEST_F(ComponentStoreTest, TrackingShouldStartWithExistingComponentsAndSurviveStoreDestruction) {
+    // Arrange
+    ChangeList changes;
+    auto local = std::make_unique<ComponentStore>();
+    ObjectId id = local->CreateObject();
+    local->Add<Velocity>(id);
+
+    // Act
+    local->Track<Velocity>(changes);
+    const size_t seeded = changes.Ids().size();
+    local.reset();
+
+    // Assert
+    EXPECT_EQ(seeded, 1u);
+    EXPECT_FALSE(changes.IsTracking());
+}
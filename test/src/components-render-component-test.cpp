@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "registry.h"
+#include "render-strategies.h"
+
+// Test fixture for RenderComponent dependency binding tests
+class RenderComponentTest : public ::testing::Test {
+protected:
+    Registry registry;
+
+    GraphicalObject& CreateObject() {
+        return *registry.Get(registry.Create());
+    }
+
+    static std::unique_ptr<RenderStrategy> MakeStrategy() {
+        return std::make_unique<RectangleRenderer>(SDL_Color{0, 255, 0, 255}, 10, 10);
+    }
+};
+
+TEST_F(RenderComponentTest, ShouldBindTransformWhenAttached) {
+    // Arrange
+    auto& object = CreateObject();
+    auto* transform = object.AddComponent<Transform>(1.0f, 2.0f);
+
+    // Act
+    auto* render = object.AddComponent<RenderComponent>(MakeStrategy());
+
+    // Assert
+    EXPECT_EQ(render->GetBoundTransform(), transform);
+}
+
+TEST_F(RenderComponentTest, ShouldBindTransformAddedAfterIt) {
+    // Arrange
+    auto& object = CreateObject();
+    auto* render = object.AddComponent<RenderComponent>(MakeStrategy());
+    EXPECT_EQ(render->GetBoundTransform(), nullptr);
+
+    // Act
+    auto* transform = object.AddComponent<Transform>();
+
+    // Assert
+    EXPECT_EQ(render->GetBoundTransform(), transform);
+}
+
+TEST_F(RenderComponentTest, ShouldUnbindWhenTransformRemoved) {
+    // Arrange
+    auto& object = CreateObject();
+    object.AddComponent<Transform>();
+    auto* render = object.AddComponent<RenderComponent>(MakeStrategy());
+
+    // Act
+    object.RemoveComponent<Transform>();
+
+    // Assert
+    EXPECT_EQ(render->GetBoundTransform(), nullptr);
+}
+
+TEST_F(RenderComponentTest, ShouldRebindWhenTransformIsRelocatedInPool) {
+    // Arrange
+    Entity first = registry.Create();
+    registry.Get(first)->AddComponent<Transform>();
+
+    auto& second = CreateObject();
+    second.AddComponent<Transform>(5.0f, 6.0f);
+    second.AddComponent<RenderComponent>(MakeStrategy());
+
+    // Act: ilk nesnenin silinmesi ikinci nesnenin dönüşümünü havuzda boşalan yere taşır
+    registry.Destroy(first);
+
+    // Assert
+    auto* render = second.GetComponent<RenderComponent>();
+    EXPECT_EQ(render->GetBoundTransform(), second.GetComponent<Transform>());
+    EXPECT_FLOAT_EQ(render->GetBoundTransform()->mX, 5.0f);
+}
+
+TEST_F(RenderComponentTest, RelocatedRenderComponentShouldKeepValidBinding) {
+    // Arrange
+    auto& first = CreateObject();
+    first.AddComponent<Transform>();
+    first.AddComponent<RenderComponent>(MakeStrategy());
+
+    auto& second = CreateObject();
+    auto* transform = second.AddComponent<Transform>(7.0f, 8.0f);
+    second.AddComponent<RenderComponent>(MakeStrategy());
+
+    // Act
+    first.RemoveComponent<RenderComponent>();
+
+    // Assert
+    EXPECT_EQ(second.GetComponent<RenderComponent>()->GetBoundTransform(), transform);
+}
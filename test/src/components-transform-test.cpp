@@ -346,4 +346,35 @@ TEST_F(TransformTest, PolymorphicDestructionShouldWorkCorrectly) {
     
     // Assert
     EXPECT_TRUE(destructorCalled);
-}
\ No newline at end of file
+}
+
+// Interpolation Tests
+TEST_F(TransformTest, InterpolatedShouldBlendPreviousAndCurrentState) {
+    // Arrange
+    Transform transform(0.0f, 10.0f);
+    transform.SnapshotPrevious();
+    transform.mX = 100.0f;
+    transform.mY = 20.0f;
+    transform.mRotation = 1.0f;
+
+    // Act
+    Transform halfway = transform.Interpolated(0.5f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(halfway.mX, 50.0f);
+    EXPECT_FLOAT_EQ(halfway.mY, 15.0f);
+    EXPECT_FLOAT_EQ(halfway.mRotation, 0.5f);
+    EXPECT_FLOAT_EQ(transform.Interpolated(1.0f).mX, 100.0f);
+}
+
+TEST_F(TransformTest, TeleportShouldDisableInterpolation) {
+    // Arrange
+    Transform transform(0.0f, 0.0f);
+    transform.mX = 700.0f;
+
+    // Act
+    transform.Teleport();
+
+    // Assert
+    EXPECT_FLOAT_EQ(transform.Interpolated(0.25f).mX, 700.0f);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "dynamic-aabb-tree.h"
+
+// Test fixture for DynamicAabbTree tests
+class DynamicAabbTreeTest : public ::testing::Test {
+protected:
+    DynamicAabbTree tree{0.0f};
+
+    std::vector<uint32_t> Collect(const Aabb& box) {
+        std::vector<uint32_t> result;
+        tree.Query(box, [&result](uint32_t userData) { result.push_back(userData); });
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+TEST_F(DynamicAabbTreeTest, QueryShouldReturnOnlyOverlappingProxies) {
+    // Arrange
+    tree.CreateProxy(Aabb{0.0f, 0.0f, 10.0f, 10.0f}, 1);
+    tree.CreateProxy(Aabb{20.0f, 20.0f, 30.0f, 30.0f}, 2);
+    tree.CreateProxy(Aabb{5.0f, 5.0f, 25.0f, 25.0f}, 3);
+
+    // Act
+    std::vector<uint32_t> result = Collect(Aabb{-5.0f, -5.0f, 6.0f, 6.0f});
+
+    // Assert
+    EXPECT_EQ(result, (std::vector<uint32_t>{1, 3}));
+    EXPECT_TRUE(tree.Validate());
+}
+
+TEST_F(DynamicAabbTreeTest, MoveWithinFatBoxShouldNotRestructureTree) {
+    // Arrange
+    DynamicAabbTree fatTree(5.0f);
+    int32_t proxy = fatTree.CreateProxy(Aabb{0.0f, 0.0f, 10.0f, 10.0f}, 7);
+
+    // Act
+    bool smallMove = fatTree.MoveProxy(proxy, Aabb{2.0f, 2.0f, 12.0f, 12.0f});
+    bool largeMove = fatTree.MoveProxy(proxy, Aabb{100.0f, 100.0f, 110.0f, 110.0f});
+
+    // Assert
+    EXPECT_FALSE(smallMove);
+    EXPECT_TRUE(largeMove);
+    EXPECT_TRUE(fatTree.GetFatBox(proxy).Contains(Aabb{100.0f, 100.0f, 110.0f, 110.0f}));
+}
+
+TEST_F(DynamicAabbTreeTest, RandomOperationsShouldMatchBruteForceAndStayBalanced) {
+    // Arrange
+    std::mt19937 random(9);
+    std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> size(1.0f, 20.0f);
+    std::vector<Aabb> boxes;
+    std::vector<int32_t> proxies;
+    std::vector<bool> alive;
+    auto randomBox = [&]() {
+        const float x = position(random);
+        const float y = position(random);
+        return Aabb{x, y, x + size(random), y + size(random)};
+    };
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        boxes.push_back(randomBox());
+        proxies.push_back(tree.CreateProxy(boxes.back(), i));
+        alive.push_back(true);
+    }
+
+    // Act
+    for (uint32_t i = 0; i < 2000; i += 3) {
+        boxes[i] = randomBox();
+        tree.MoveProxy(proxies[i], boxes[i]);
+    }
+    for (uint32_t i = 1; i < 2000; i += 5) {
+        tree.DestroyProxy(proxies[i]);
+        alive[i] = false;
+    }
+
+    // Assert
+    ASSERT_TRUE(tree.Validate());
+    EXPECT_EQ(tree.ProxyCount(), 1600u);
+    EXPECT_LE(tree.Height(), 2 * static_cast<int32_t>(std::ceil(std::log2(1600.0))));
+
+    for (int query = 0; query < 30; query++) {
+        const Aabb box = randomBox().Expanded(40.0f);
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < boxes.size(); i++) {
+            if (alive[i] && boxes[i].Overlaps(box)) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(Collect(box), expected);
+    }
+}
+
+TEST_F(DynamicAabbTreeTest, DestroyingAllProxiesShouldEmptyTree) {
+    // Arrange
+    int32_t first = tree.CreateProxy(Aabb{0.0f, 0.0f, 1.0f, 1.0f}, 1);
+    int32_t second = tree.CreateProxy(Aabb{2.0f, 2.0f, 3.0f, 3.0f}, 2);
+
+    // Act
+    tree.DestroyProxy(first);
+    tree.DestroyProxy(second);
+
+    // Assert
+    EXPECT_EQ(tree.ProxyCount(), 0u);
+    EXPECT_TRUE(Collect(Aabb{-100.0f, -100.0f, 100.0f, 100.0f}).empty());
+    EXPECT_TRUE(tree.Validate());
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "fixed-timestep.h"
+#include "job-system.h"
+#include "registry.h"
+#include "system-scheduler.h"
+
+// Test fixture for FixedTimestep tests
+class FixedTimestepTest : public ::testing::Test {
+protected:
+    FixedTimestep timestep{100.0, 4};
+};
+
+TEST_F(FixedTimestepTest, AdvanceShouldRunOneStepPerElapsedTick) {
+    // Act & Assert
+    EXPECT_EQ(timestep.Advance(0.005), 0u);
+    EXPECT_EQ(timestep.Advance(0.005), 1u);
+    EXPECT_EQ(timestep.Advance(0.025), 2u);
+    EXPECT_EQ(timestep.TickCount(), 3u);
+    EXPECT_FLOAT_EQ(timestep.StepSeconds(), 0.01f);
+}
+
+TEST_F(FixedTimestepTest, AlphaShouldBeRemainingFractionOfAStep) {
+    // Act
+    timestep.Advance(0.0125);
+
+    // Assert
+    EXPECT_NEAR(timestep.Alpha(), 0.25f, 1e-4f);
+}
+
+TEST_F(FixedTimestepTest, StallShouldBeCappedAndExcessDropped) {
+    // Act
+    uint32_t steps = timestep.Advance(1.0);
+
+    // Assert
+    EXPECT_EQ(steps, 4u);
+    EXPECT_FLOAT_EQ(timestep.Alpha(), 0.0f);
+    EXPECT_EQ(timestep.Advance(0.0), 0u);
+}
+
+TEST_F(FixedTimestepTest, SameFrameTimesShouldGiveSameTickCount) {
+    // Arrange
+    FixedTimestep other{100.0, 4};
+    const double frames[] = {0.016, 0.017, 0.033, 0.001, 0.1, 0.016};
+
+    // Act
+    for (double frame : frames) {
+        EXPECT_EQ(timestep.Advance(frame), other.Advance(frame));
+    }
+
+    // Assert
+    EXPECT_EQ(timestep.TickCount(), other.TickCount());
+}
+
+TEST_F(FixedTimestepTest, NonPositiveTickRateShouldThrow) {
+    // Act & Assert
+    EXPECT_THROW(FixedTimestep(0.0), std::runtime_error);
+    EXPECT_THROW(timestep.SetTickRate(-1.0), std::runtime_error);
+}
+
+TEST(TransformSnapshotSystemTest, RunShouldStoreCurrentStateAsPrevious) {
+    // Arrange
+    Registry registry;
+    JobSystem jobs(0);
+    TransformSnapshotSystem system;
+    Entity entity = registry.Create();
+    auto* transform = registry.Get(entity)->AddComponent<Transform>(1.0f, 2.0f);
+    transform->mX = 5.0f;
+
+    // Act
+    system.Run(registry, jobs, 0.01f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(transform->mPrevX, 5.0f);
+    EXPECT_FLOAT_EQ(transform->mPrevY, 2.0f);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include "geometry-batch.h"
+
+// Test fixture for GeometryBatch tests
+class GeometryBatchTest : public ::testing::Test {
+protected:
+    GeometryBatch batch;
+    SDL_FColor red{1.0f, 0.0f, 0.0f, 1.0f};
+};
+
+TEST_F(GeometryBatchTest, ShapesShouldShareOneSegmentWithOffsetIndices) {
+    // Act
+    batch.AddRect(SDL_FRect{10.0f, 20.0f, 30.0f, 40.0f}, red);
+    batch.AddTriangle(SDL_FPoint{0.0f, 0.0f}, SDL_FPoint{1.0f, 0.0f}, SDL_FPoint{0.0f, 1.0f}, red);
+    batch.AddRect(SDL_FRect{0.0f, 0.0f, 1.0f, 1.0f}, red);
+
+    // Assert
+    EXPECT_EQ(batch.VertexCount(), 11u);
+    EXPECT_EQ(batch.IndexCount(), 15u);
+    EXPECT_EQ(batch.SegmentCount(), 1u);
+}
+
+TEST_F(GeometryBatchTest, AppendedIndicesShouldReferToStreamVertices) {
+    // Arrange
+    batch.AddRect(SDL_FRect{10.0f, 20.0f, 30.0f, 40.0f}, red);
+
+    // Act
+    SDL_Vertex* vertices = batch.AppendVertices(3);
+    int* indices = batch.AppendIndices(3);
+    indices[0] = 4;
+
+    // Assert
+    EXPECT_EQ(batch.VertexCount(), 7u);
+    EXPECT_EQ(batch.IndexCount(), 9u);
+    EXPECT_NE(vertices, nullptr);
+    EXPECT_EQ(indices[0], 4);
+}
+
+TEST_F(GeometryBatchTest, TextureChangesShouldOpenNewSegments) {
+    // Arrange
+    auto* texture = reinterpret_cast<SDL_Texture*>(0x10);
+
+    // Act
+    batch.AddRect(SDL_FRect{0.0f, 0.0f, 1.0f, 1.0f}, red);
+    batch.AppendIndices(6, texture);
+    batch.AppendIndices(6, texture);
+    batch.AddTriangle(SDL_FPoint{0.0f, 0.0f}, SDL_FPoint{1.0f, 0.0f}, SDL_FPoint{0.0f, 1.0f}, red);
+
+    // Assert
+    EXPECT_EQ(batch.SegmentCount(), 3u);
+}
+
+TEST_F(GeometryBatchTest, ClearShouldDropShapesWithoutDrawing) {
+    // Arrange
+    batch.AddRect(SDL_FRect{0.0f, 0.0f, 1.0f, 1.0f}, red);
+
+    // Act
+    batch.Clear();
+
+    // Assert
+    EXPECT_TRUE(batch.Empty());
+    EXPECT_EQ(batch.VertexCount(), 0u);
+    EXPECT_EQ(batch.SegmentCount(), 0u);
+}
+
+TEST_F(GeometryBatchTest, TexturedRectsWithSameTextureShouldMerge) {
+    // Arrange
+    auto* texture = reinterpret_cast<SDL_Texture*>(0x10);
+
+    // Act
+    batch.AddTexturedRect(SDL_FRect{0.0f, 0.0f, 8.0f, 8.0f}, texture);
+    batch.AddTexturedRect(SDL_FRect{10.0f, 0.0f, 8.0f, 8.0f}, texture);
+
+    // Assert
+    EXPECT_EQ(batch.VertexCount(), 8u);
+    EXPECT_EQ(batch.IndexCount(), 12u);
+    EXPECT_EQ(batch.SegmentCount(), 1u);
+}
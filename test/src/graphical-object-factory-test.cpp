@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "graphical-object-factory.h"
+#include "registry.h"
+#include "render-strategies.h"
+
+// Test fixture for GraphicalObjectFactory tests
+class GraphicalObjectFactoryTest : public ::testing::Test {
+protected:
+    Registry registry;
+};
+
+TEST_F(GraphicalObjectFactoryTest, SpawnManyShouldCreateObjectsAtGivenPositions) {
+    // Arrange
+    std::vector<SDL_FPoint> positions = {{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
+
+    // Act
+    auto entities = GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(),
+                                                      positions.size(), positions);
+
+    // Assert
+    ASSERT_EQ(entities.size(), 3u);
+    EXPECT_EQ(registry.Size(), 3u);
+    for (size_t i = 0; i < entities.size(); i++) {
+        auto* transform = registry.Get(entities[i])->GetComponent<Transform>();
+        ASSERT_NE(transform, nullptr);
+        EXPECT_FLOAT_EQ(transform->mX, positions[i].x);
+        EXPECT_FLOAT_EQ(transform->mY, positions[i].y);
+        EXPECT_FLOAT_EQ(registry.Get(entities[i])->GetComponent<Velocity>()->mVx, 100.0f);
+    }
+}
+
+TEST_F(GraphicalObjectFactoryTest, SpawnManyShouldShareStrategyAndBindTransforms) {
+    // Act
+    auto entities = GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::TrianglePrefab(), 100);
+
+    // Assert
+    const auto& strategy = GraphicalObjectFactory::TrianglePrefab().mStrategy;
+    for (const Entity& entity : entities) {
+        auto* object = registry.Get(entity);
+        auto* render = object->GetComponent<RenderComponent>();
+        EXPECT_EQ(render->GetStrategy(), strategy);
+        EXPECT_EQ(render->GetBoundTransform(), object->GetComponent<Transform>());
+    }
+}
+
+TEST_F(GraphicalObjectFactoryTest, SpawnManyShouldPlaceComponentsContiguously) {
+    // Act
+    auto entities = GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(), 500);
+
+    // Assert
+    auto* first = registry.Get(entities.front())->GetComponent<Transform>();
+    for (size_t i = 1; i < entities.size(); i++) {
+        EXPECT_EQ(registry.Get(entities[i])->GetComponent<Transform>(), first + i);
+    }
+}
+
+TEST_F(GraphicalObjectFactoryTest, SpawnManyShouldRejectTooFewPositions) {
+    // Arrange
+    std::vector<SDL_FPoint> positions = {{1.0f, 2.0f}};
+
+    // Act & Assert
+    EXPECT_THROW(GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(), 2, positions),
+                 std::runtime_error);
+    EXPECT_EQ(registry.Size(), 0u);
+}
+
+TEST_F(GraphicalObjectFactoryTest, CustomPrefabShouldUseItsOwnStrategy) {
+    // Arrange
+    Prefab prefab{Velocity(1.0f, -1.0f), std::make_shared<RectangleRenderer>(SDL_Color{1, 2, 3, 255}, 4, 4)};
+
+    // Act
+    Entity entity = GraphicalObjectFactory::Spawn(registry, prefab, 7.0f, 8.0f);
+
+    // Assert
+    auto* object = registry.Get(entity);
+    EXPECT_EQ(object->GetComponent<RenderComponent>()->GetStrategy(), prefab.mStrategy);
+    EXPECT_FLOAT_EQ(object->GetComponent<Velocity>()->mVy, -1.0f);
+    EXPECT_EQ(prefab.mStrategy.use_count(), 2);
+}
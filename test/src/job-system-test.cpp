@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "job-system.h"
+#include "system-scheduler.h"
+#include "registry.h"
+
+// Test fixture for JobSystem tests
+class JobSystemTest : public ::testing::TestWithParam<uint32_t> {
+};
+
+TEST_P(JobSystemTest, WaitShouldReturnAfterAllJobsRan) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    WaitGroup group;
+    std::atomic<int> counter{0};
+
+    // Act
+    for (int i = 0; i < 1000; i++) {
+        jobs.Submit(group, [&counter]() { counter++; });
+    }
+    jobs.Wait(group);
+
+    // Assert
+    EXPECT_TRUE(group.IsDone());
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST_P(JobSystemTest, JobsShouldBeAbleToSubmitNestedJobs) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    WaitGroup group;
+    std::atomic<int> counter{0};
+
+    // Act
+    for (int i = 0; i < 10; i++) {
+        jobs.Submit(group, [&jobs, &counter]() {
+            WaitGroup nested;
+            for (int j = 0; j < 10; j++) {
+                jobs.Submit(nested, [&counter]() { counter++; });
+            }
+            jobs.Wait(nested);
+        });
+    }
+    jobs.Wait(group);
+
+    // Assert
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST_P(JobSystemTest, ConcurrentSubmittersShouldAllFinish) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    std::atomic<int> counter{0};
+    std::vector<std::thread> submitters;
+
+    // Act
+    for (int t = 0; t < 4; t++) {
+        submitters.emplace_back([&jobs, &counter]() {
+            for (int round = 0; round < 200; round++) {
+                WaitGroup group;
+                for (int i = 0; i < 8; i++) {
+                    jobs.Submit(group, [&counter]() { counter++; });
+                }
+                jobs.Wait(group);
+            }
+        });
+    }
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+
+    // Assert
+    EXPECT_EQ(counter.load(), 4 * 200 * 8);
+}
+
+TEST_P(JobSystemTest, WaitShouldSleepUntilLongJobsFinish) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    WaitGroup group;
+    std::atomic<int> finished{0};
+
+    // Act
+    for (int i = 0; i < 4; i++) {
+        jobs.Submit(group, [&finished]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            finished++;
+        });
+    }
+    jobs.Wait(group);
+
+    // Assert
+    EXPECT_TRUE(group.IsDone());
+    EXPECT_EQ(finished.load(), 4);
+}
+
+TEST_P(JobSystemTest, ParallelForShouldVisitEveryIndexExactlyOnce) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    std::vector<std::atomic<int>> visits(100003);
+
+    // Act
+    jobs.ParallelFor(visits.size(), 1000, [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    });
+
+    // Assert
+    for (const auto& visit : visits) {
+        ASSERT_EQ(visit.load(), 1);
+    }
+}
+
+TEST_P(JobSystemTest, WaitShouldRethrowExceptionFromJob) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    WaitGroup group;
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 16; i++) {
+        jobs.Submit(group, [&counter, i]() {
+            if (i == 3) {
+                throw std::runtime_error("job failed");
+            }
+            counter++;
+        });
+    }
+
+    // Act & Assert
+    EXPECT_THROW(jobs.Wait(group), std::runtime_error);
+    EXPECT_TRUE(group.IsDone());
+    EXPECT_EQ(counter.load(), 15);
+}
+
+TEST_P(JobSystemTest, ParallelForShouldFinishEveryChunkBeforeRethrowing) {
+    // Arrange
+    JobSystem jobs(GetParam());
+    constexpr size_t kCount = 64000;
+
+    for (size_t failing : {size_t{0}, kCount - 1}) {
+        std::atomic<size_t> visited{0};
+        std::atomic<size_t> skipped{0};
+
+        // Act
+        auto run = [&]() {
+            jobs.ParallelFor(kCount, 1000, [&visited, &skipped, failing](size_t begin, size_t end) {
+                if (failing >= begin && failing < end) {
+                    skipped = end - begin;
+                    throw std::runtime_error("chunk failed");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                visited += end - begin;
+            });
+        };
+
+        // Assert
+        EXPECT_THROW(run(), std::runtime_error);
+        EXPECT_EQ(visited.load() + skipped.load(), kCount);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(WorkerCounts, JobSystemTest, ::testing::Values(0u, 1u, 4u));
+
+// Scheduler Tests
+namespace {
+
+class RecordingSystem : public System {
+private:
+    ComponentMask mReads;
+    ComponentMask mWrites;
+    std::atomic<int>& mRuns;
+
+public:
+    RecordingSystem(ComponentMask reads, ComponentMask writes, std::atomic<int>& runs)
+        : mReads(reads), mWrites(writes), mRuns(runs) {}
+
+    ComponentMask Reads() const override { return mReads; }
+    ComponentMask Writes() const override { return mWrites; }
+    void Run(Registry&, JobSystem&, float) override { mRuns++; }
+};
+
+} // namespace
+
+class SystemSchedulerTest : public ::testing::Test {
+protected:
+    JobSystem jobs{2};
+    SystemScheduler scheduler{jobs};
+    Registry registry;
+    std::atomic<int> runs{0};
+
+    System& Add(ComponentMask reads, ComponentMask writes) {
+        return scheduler.AddSystem(std::make_unique<RecordingSystem>(reads, writes, runs));
+    }
+};
+
+TEST_F(SystemSchedulerTest, ReadOnlySystemsShouldShareAStage) {
+    // Act
+    Add(ComponentMaskOf<Transform>(), 0);
+    Add(ComponentMaskOf<Transform>() | ComponentMaskOf<Velocity>(), 0);
+
+    // Assert
+    EXPECT_EQ(scheduler.StageCount(), 1u);
+}
+
+TEST_F(SystemSchedulerTest, WriterShouldRunAfterEarlierReader) {
+    // Act
+    System& reader = Add(ComponentMaskOf<Transform>(), 0);
+    System& writer = Add(0, ComponentMaskOf<Transform>());
+
+    // Assert
+    ASSERT_EQ(scheduler.StageCount(), 2u);
+    EXPECT_EQ(scheduler.GetStage(0).front(), &reader);
+    EXPECT_EQ(scheduler.GetStage(1).front(), &writer);
+}
+
+TEST_F(SystemSchedulerTest, IndependentSystemShouldJoinEarliestStage) {
+    // Act
+    Add(ComponentMaskOf<Transform>(), ComponentMaskOf<Transform>());
+    Add(ComponentMaskOf<Transform>(), ComponentMaskOf<Transform>());
+    System& independent = Add(ComponentMaskOf<Velocity>(), ComponentMaskOf<Velocity>());
+
+    // Assert
+    ASSERT_EQ(scheduler.StageCount(), 2u);
+    ASSERT_EQ(scheduler.GetStage(0).size(), 2u);
+    EXPECT_EQ(scheduler.GetStage(0).back(), &independent);
+}
+
+TEST_F(SystemSchedulerTest, GridQueriesShouldRunAfterTheGridRebuild) {
+    // Act
+    System& grid = scheduler.AddSystem(std::make_unique<SpatialGridSystem>());
+    System& query = Add(ComponentMaskOf<Velocity>() | kSpatialGridResource, 0);
+
+    // Assert
+    ASSERT_EQ(scheduler.StageCount(), 2u);
+    EXPECT_EQ(scheduler.GetStage(0).front(), &grid);
+    EXPECT_EQ(scheduler.GetStage(1).front(), &query);
+}
+
+TEST_F(SystemSchedulerTest, ContactReadersShouldRunAfterCollisionDetection) {
+    // Act
+    System& collisions = scheduler.AddSystem(std::make_unique<CollisionSystem>());
+    System& reader = Add(ComponentMaskOf<Velocity>() | kCollisionWorldResource, ComponentMaskOf<Velocity>());
+
+    // Assert
+    ASSERT_EQ(scheduler.StageCount(), 2u);
+    EXPECT_EQ(scheduler.GetStage(0).front(), &collisions);
+    EXPECT_EQ(scheduler.GetStage(1).front(), &reader);
+}
+
+TEST_F(SystemSchedulerTest, RunShouldRunEverySystemOnce) {
+    // Arrange
+    Add(ComponentMaskOf<Transform>(), 0);
+    Add(ComponentMaskOf<Velocity>(), 0);
+    Add(0, ComponentMaskOf<Transform>());
+
+    // Act
+    scheduler.Run(registry, 0.016f);
+
+    // Assert
+    EXPECT_EQ(runs.load(), 3);
+}
+
+TEST_F(SystemSchedulerTest, ParallelReadOnlySystemsShouldNotCreatePools) {
+    // Arrange
+    Entity entity = registry.Create();
+    registry.Get(entity)->AddComponent<Transform>(1.0f, 2.0f);
+    auto& grid = static_cast<SpatialGridSystem&>(scheduler.AddSystem(std::make_unique<SpatialGridSystem>()));
+    scheduler.AddSystem(std::make_unique<CollisionSystem>());
+
+    // Act
+    scheduler.Run(registry, 0.016f);
+
+    // Assert
+    ASSERT_EQ(scheduler.StageCount(), 1u);
+    EXPECT_EQ(registry.Store().FindPool<WorldTransform>(), nullptr);
+    EXPECT_EQ(registry.Store().FindPool<Collider>(), nullptr);
+    EXPECT_EQ(grid.Grid().Size(), 1u);
+}
+
+TEST_F(SystemSchedulerTest, CollisionSystemShouldOwnTheContactsItComputes) {
+    // Arrange
+    for (float x : {0.0f, 15.0f}) {
+        Entity entity = registry.Create();
+        registry.Get(entity)->AddComponent<Transform>(x, 0.0f);
+        registry.Get(entity)->AddComponent<Collider>(ShapeDesc{ShapeType::Circle, 20.0f, 20.0f});
+    }
+    auto& collisions = static_cast<CollisionSystem&>(scheduler.AddSystem(std::make_unique<CollisionSystem>()));
+
+    // Act
+    scheduler.Run(registry, 0.016f);
+
+    // Assert
+    EXPECT_EQ(collisions.World().Contacts().size(), 1u);
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "movement-system.h"
+
+// Test fixture for MovementSystem tests
+class MovementSystemTest : public ::testing::Test {
+protected:
+    static constexpr float kWidth = 800.0f;
+    static constexpr float kHeight = 600.0f;
+
+    std::vector<SimdLevel> SupportedLevels() const {
+        std::vector<SimdLevel> levels{SimdLevel::Scalar};
+        SimdLevel detected = MovementSystem::DetectSimdLevel();
+        if (detected != SimdLevel::Scalar) {
+            levels.push_back(SimdLevel::Sse2);
+        }
+        if (detected == SimdLevel::Avx2) {
+            levels.push_back(SimdLevel::Avx2);
+        }
+        return levels;
+    }
+};
+
+TEST_F(MovementSystemTest, IntegrateShouldAdvancePositionByVelocity) {
+    // Arrange
+    float x = 100.0f, y = 200.0f;
+    float vx = 10.0f, vy = -20.0f;
+
+    // Act
+    MovementSystem::Integrate(&x, &y, &vx, &vy, 1, 0.5f, kWidth, kHeight);
+
+    // Assert
+    EXPECT_FLOAT_EQ(x, 105.0f);
+    EXPECT_FLOAT_EQ(y, 190.0f);
+}
+
+TEST_F(MovementSystemTest, IntegrateShouldWrapAtBoundaries) {
+    // Arrange
+    std::vector<float> x{-1.0f, 801.0f, 400.0f, 400.0f};
+    std::vector<float> y{300.0f, 300.0f, -5.0f, 605.0f};
+    std::vector<float> v(4, 0.0f);
+
+    for (SimdLevel level : SupportedLevels()) {
+        auto px = x, py = y;
+
+        // Act
+        MovementSystem::Integrate(level, px.data(), py.data(), v.data(), v.data(), px.size(), 0.016f, kWidth, kHeight);
+
+        // Assert
+        EXPECT_FLOAT_EQ(px[0], kWidth);
+        EXPECT_FLOAT_EQ(px[1], 0.0f);
+        EXPECT_FLOAT_EQ(py[2], kHeight);
+        EXPECT_FLOAT_EQ(py[3], 0.0f);
+    }
+}
+
+TEST_F(MovementSystemTest, SimdPathsShouldMatchScalarPath) {
+    // Arrange
+    constexpr size_t kCount = 1037; // SIMD genisliginin kati olmayan bir sayi
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-50.0f, 850.0f);
+    std::uniform_real_distribution<float> speed(-500.0f, 500.0f);
+
+    std::vector<float> x(kCount), y(kCount), vx(kCount), vy(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        x[i] = position(random);
+        y[i] = position(random);
+        vx[i] = speed(random);
+        vy[i] = speed(random);
+    }
+
+    auto expectedX = x, expectedY = y;
+    MovementSystem::Integrate(SimdLevel::Scalar, expectedX.data(), expectedY.data(), vx.data(), vy.data(),
+                              kCount, 0.1f, kWidth, kHeight);
+
+    for (SimdLevel level : SupportedLevels()) {
+        auto px = x, py = y;
+
+        // Act
+        MovementSystem::Integrate(level, px.data(), py.data(), vx.data(), vy.data(), kCount, 0.1f, kWidth, kHeight);
+
+        // Assert
+        EXPECT_EQ(px, expectedX);
+        EXPECT_EQ(py, expectedY);
+    }
+}
+
+TEST_F(MovementSystemTest, UpdateShouldMoveOnlyObjectsWithTransformAndVelocity) {
+    // Arrange
+    ComponentStore store;
+    MovementSystem system(kWidth, kHeight);
+
+    ObjectId moving = store.CreateObject();
+    auto* movingTransform = store.Add<Transform>(moving, 10.0f, 10.0f);
+    store.Add<Velocity>(moving, 100.0f, 0.0f);
+
+    ObjectId still = store.CreateObject();
+    auto* stillTransform = store.Add<Transform>(still, 10.0f, 10.0f);
+
+    ObjectId orphan = store.CreateObject();
+    store.Add<Velocity>(orphan, 100.0f, 100.0f);
+
+    // Act
+    system.Update(store, 1.0f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(movingTransform->mX, 110.0f);
+    EXPECT_FLOAT_EQ(stillTransform->mX, 10.0f);
+}
+
+TEST_F(MovementSystemTest, UpdateShouldTeleportWrappedObjects) {
+    // Arrange
+    ComponentStore store;
+    MovementSystem system(kWidth, kHeight);
+
+    ObjectId wrapping = store.CreateObject();
+    auto* wrappingTransform = store.Add<Transform>(wrapping, kWidth - 1.0f, 10.0f);
+    store.Add<Velocity>(wrapping, 100.0f, 0.0f);
+
+    ObjectId moving = store.CreateObject();
+    auto* movingTransform = store.Add<Transform>(moving, 10.0f, 10.0f);
+    store.Add<Velocity>(moving, 100.0f, 0.0f);
+
+    // Act
+    system.Update(store, 0.1f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(wrappingTransform->mX, 0.0f);
+    EXPECT_FLOAT_EQ(wrappingTransform->mPrevX, 0.0f);
+    EXPECT_FLOAT_EQ(movingTransform->mX, 20.0f);
+    EXPECT_FLOAT_EQ(movingTransform->mPrevX, 10.0f);
+}
+
+TEST_F(MovementSystemTest, UpdateShouldMoveEveryObjectAcrossBlockBoundaries) {
+    // Arrange
+    ComponentStore store;
+    MovementSystem system(kWidth, kHeight);
+    constexpr size_t kCount = 1500;
+    std::vector<Transform*> transforms;
+    for (size_t i = 0; i < kCount; i++) {
+        ObjectId id = store.CreateObject();
+        transforms.push_back(store.Add<Transform>(id, 10.0f, 20.0f));
+        store.Add<Velocity>(id, static_cast<float>(i % 7), 1.0f);
+    }
+
+    // Act
+    system.Update(store, 1.0f);
+
+    // Assert
+    for (size_t i = 0; i < kCount; i++) {
+        EXPECT_FLOAT_EQ(transforms[i]->mX, 10.0f + static_cast<float>(i % 7));
+        EXPECT_FLOAT_EQ(transforms[i]->mY, 21.0f);
+    }
+}
+
+TEST_F(MovementSystemTest, UpdateShouldNotifyOnlyObjectsWhosePositionChanged) {
+    // Arrange
+    ComponentStore store;
+    MovementSystem system(kWidth, kHeight);
+
+    ObjectId resting = store.CreateObject();
+    store.Add<Transform>(resting, 10.0f, 10.0f);
+    store.Add<Velocity>(resting, 0.0f, 0.0f);
+
+    ObjectId moving = store.CreateObject();
+    store.Add<Transform>(moving, 10.0f, 10.0f);
+    store.Add<Velocity>(moving, 0.0f, 5.0f);
+
+    ObjectId wrapping = store.CreateObject();
+    store.Add<Transform>(wrapping, kWidth - 1.0f, 10.0f);
+    store.Add<Velocity>(wrapping, 100.0f, 0.0f);
+
+    ChangeList changes;
+    store.Track<Transform>(changes);
+    changes.Clear();
+
+    // Act
+    system.Update(store, 0.1f);
+
+    // Assert
+    std::vector<ObjectId> ids(changes.Ids().begin(), changes.Ids().end());
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, (std::vector<ObjectId>{moving, wrapping}));
+}
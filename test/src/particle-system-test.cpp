@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "job-system.h"
+#include "particle-system.h"
+#include "registry.h"
+
+// Test fixture for ParticleSystem tests
+class ParticleSystemTest : public ::testing::Test {
+protected:
+    Registry registry;
+
+    std::vector<SimdLevel> SupportedLevels() const {
+        std::vector<SimdLevel> levels{SimdLevel::Scalar};
+        SimdLevel detected = MovementSystem::DetectSimdLevel();
+        if (detected != SimdLevel::Scalar) {
+            levels.push_back(SimdLevel::Sse2);
+        }
+        if (detected == SimdLevel::Avx2) {
+            levels.push_back(SimdLevel::Avx2);
+        }
+        return levels;
+    }
+
+    ParticleEmitter* CreateEmitter(float x, float y, const ParticleEmitterSettings& settings) {
+        GraphicalObject* object = registry.Get(registry.Create());
+        object->AddComponent<Transform>(x, y);
+        return object->AddComponent<ParticleEmitter>(settings);
+    }
+};
+
+TEST_F(ParticleSystemTest, SimdPathsShouldMatchScalarPath) {
+    // Arrange
+    const size_t count = 37;
+    std::vector<float> x(count), y(count), vx(count), vy(count), age(count), inverseLifetime(count);
+    for (size_t i = 0; i < count; i++) {
+        x[i] = static_cast<float>(i) * 3.0f;
+        y[i] = static_cast<float>(i) * -2.0f;
+        vx[i] = static_cast<float>(i % 7) * 10.0f - 30.0f;
+        vy[i] = static_cast<float>(i % 5) * 5.0f;
+        inverseLifetime[i] = 1.0f / (1.0f + static_cast<float>(i % 3));
+    }
+    auto expectedX = x, expectedY = y, expectedVx = vx, expectedVy = vy, expectedAge = age;
+    ParticleSystem::Integrate(SimdLevel::Scalar, expectedX.data(), expectedY.data(), expectedVx.data(),
+                              expectedVy.data(), expectedAge.data(), inverseLifetime.data(), count, 0.016f, 3.0f, 9.8f);
+
+    for (SimdLevel level : SupportedLevels()) {
+        auto actualX = x, actualY = y, actualVx = vx, actualVy = vy, actualAge = age;
+
+        // Act
+        ParticleSystem::Integrate(level, actualX.data(), actualY.data(), actualVx.data(), actualVy.data(),
+                                  actualAge.data(), inverseLifetime.data(), count, 0.016f, 3.0f, 9.8f);
+
+        // Assert
+        EXPECT_EQ(actualX, expectedX);
+        EXPECT_EQ(actualY, expectedY);
+        EXPECT_EQ(actualVx, expectedVx);
+        EXPECT_EQ(actualVy, expectedVy);
+        EXPECT_EQ(actualAge, expectedAge);
+    }
+}
+
+TEST_F(ParticleSystemTest, CompactShouldKeepLiveParticlesInOrder) {
+    // Arrange
+    std::vector<float> x{0, 1, 2, 3, 4, 5};
+    std::vector<float> y = x, vx = x, vy = x, inverseLifetime = x;
+    std::vector<float> age{0.5f, 1.0f, 0.1f, 1.5f, 1.0f, 0.9f};
+
+    // Act
+    size_t alive = ParticleSystem::Compact(x.data(), y.data(), vx.data(), vy.data(), age.data(),
+                                           inverseLifetime.data(), x.size());
+
+    // Assert
+    ASSERT_EQ(alive, 3u);
+    EXPECT_EQ(x[0], 0.0f);
+    EXPECT_EQ(x[1], 2.0f);
+    EXPECT_EQ(x[2], 5.0f);
+    EXPECT_EQ(age[2], 0.9f);
+}
+
+TEST_F(ParticleSystemTest, EmitterShouldSpawnAtRateFromOwnerPosition) {
+    // Arrange
+    ParticleEmitterSettings settings;
+    settings.mRate = 100.0f;
+    settings.mMinSpeed = 0.0f;
+    settings.mMaxSpeed = 0.0f;
+    ParticleEmitter* emitter = CreateEmitter(40.0f, 60.0f, settings);
+
+    // Act
+    for (int i = 0; i < 10; i++) {
+        emitter->Simulate(0.025f);
+    }
+
+    // Assert
+    EXPECT_EQ(emitter->Count(), 25u);
+    EXPECT_FLOAT_EQ(emitter->X(0), 40.0f);
+    EXPECT_FLOAT_EQ(emitter->Y(24), 60.0f);
+}
+
+TEST_F(ParticleSystemTest, EmitterShouldNotExceedCapacity) {
+    // Arrange
+    ParticleEmitterSettings settings;
+    settings.mRate = 100000.0f;
+    settings.mMaxParticles = 64;
+    ParticleEmitter* emitter = CreateEmitter(0.0f, 0.0f, settings);
+
+    // Act
+    emitter->Simulate(0.1f);
+    emitter->Burst(10);
+
+    // Assert
+    EXPECT_EQ(emitter->Count(), 64u);
+    EXPECT_EQ(emitter->Capacity(), 64u);
+}
+
+TEST_F(ParticleSystemTest, ParticlesShouldDieAfterLifetime) {
+    // Arrange
+    ParticleEmitterSettings settings;
+    settings.mMinLifetime = 0.5f;
+    settings.mMaxLifetime = 0.5f;
+    ParticleEmitter* emitter = CreateEmitter(0.0f, 0.0f, settings);
+    emitter->SetEmitting(false);
+    emitter->Burst(100);
+
+    // Act
+    emitter->Simulate(0.25f);
+    size_t halfway = emitter->Count();
+    float halfwayAge = emitter->Age(0);
+    emitter->Simulate(0.25f);
+
+    // Assert
+    EXPECT_EQ(halfway, 100u);
+    EXPECT_FLOAT_EQ(halfwayAge, 0.5f);
+    EXPECT_EQ(emitter->Count(), 0u);
+}
+
+TEST_F(ParticleSystemTest, RunShouldUpdateEveryEmitterAndBuildOneVertexBatch) {
+    // Arrange
+    ParticleEmitterSettings settings;
+    settings.mRate = 0.0f;
+    settings.mStartColor = SDL_FColor{1.0f, 0.0f, 0.0f, 1.0f};
+    settings.mEndColor = SDL_FColor{0.0f, 0.0f, 1.0f, 0.0f};
+    settings.mMinLifetime = 1.0f;
+    settings.mMaxLifetime = 1.0f;
+    settings.mMinSpeed = 0.0f;
+    settings.mMaxSpeed = 0.0f;
+    ParticleEmitter* first = CreateEmitter(0.0f, 0.0f, settings);
+    ParticleEmitter* second = CreateEmitter(100.0f, 100.0f, settings);
+    first->Burst(10);
+    second->Burst(5);
+    JobSystem jobs(2);
+    ParticleSystem system;
+    std::vector<SDL_Vertex> vertices;
+
+    // Act
+    system.Run(registry, jobs, 0.5f);
+    ParticleSystem::BuildVertices(registry.Store(), 1.0f, vertices);
+
+    // Assert
+    ASSERT_EQ(vertices.size(), 45u);
+    EXPECT_FLOAT_EQ(vertices[0].color.r, 0.5f);
+    EXPECT_FLOAT_EQ(vertices[0].color.b, 0.5f);
+    EXPECT_FLOAT_EQ(vertices[44].color.a, 0.5f);
+    EXPECT_FLOAT_EQ(vertices[0].position.y, -2.0f);
+    EXPECT_FLOAT_EQ(vertices[1].position.x, 1.7320508f);
+    EXPECT_FLOAT_EQ(vertices[2].position.y, 1.0f);
+    EXPECT_FLOAT_EQ(vertices[2].color.g, 0.0f);
+    EXPECT_FLOAT_EQ(vertices[2].tex_coord.x, 0.0f);
+    EXPECT_FLOAT_EQ(vertices[30].position.x, 100.0f);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "job-system.h"
+#include "movement-system.h"
+#include "physics-system.h"
+#include "registry.h"
+
+// Test fixture for PhysicsSystem tests
+class PhysicsSystemTest : public ::testing::Test {
+protected:
+    Registry registry;
+
+    GraphicalObject* CreateBody(float x, float y, float mass, float drag = 0.0f) {
+        GraphicalObject* object = registry.Get(registry.Create());
+        object->AddComponent<Transform>(x, y);
+        object->AddComponent<Velocity>();
+        object->AddComponent<RigidBody>(mass, drag);
+        return object;
+    }
+};
+
+TEST_F(PhysicsSystemTest, SemiImplicitEulerShouldApplyForceBeforePosition) {
+    // Arrange
+    PhysicsSystem physics(IntegrationMethod::SemiImplicitEuler);
+    GraphicalObject* body = CreateBody(0.0f, 0.0f, 2.0f);
+    body->GetComponent<RigidBody>()->AddForce(4.0f, -8.0f);
+
+    // Act
+    physics.Update(registry.Store(), 0.5f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(body->GetComponent<Velocity>()->mVx, 1.0f);
+    EXPECT_FLOAT_EQ(body->GetComponent<Velocity>()->mVy, -2.0f);
+    EXPECT_FLOAT_EQ(body->GetComponent<Transform>()->mX, 0.5f);
+    EXPECT_FLOAT_EQ(body->GetComponent<Transform>()->mY, -1.0f);
+    EXPECT_FLOAT_EQ(body->GetComponent<RigidBody>()->mForceX, 0.0f);
+}
+
+TEST_F(PhysicsSystemTest, VelocityVerletShouldBeExactUnderConstantAcceleration) {
+    // Arrange
+    PhysicsSystem physics(IntegrationMethod::VelocityVerlet, 0.0f, 10.0f);
+    GraphicalObject* body = CreateBody(0.0f, 0.0f, 1.0f);
+    body->GetComponent<Velocity>()->mVx = 3.0f;
+
+    // Act
+    for (int i = 0; i < 100; i++) {
+        physics.Update(registry.Store(), 0.01f);
+    }
+
+    // Assert: y = g t^2 / 2, x = vx t
+    EXPECT_NEAR(body->GetComponent<Transform>()->mY, 5.0f, 1e-3f);
+    EXPECT_NEAR(body->GetComponent<Transform>()->mX, 3.0f, 1e-3f);
+    EXPECT_NEAR(body->GetComponent<Velocity>()->mVy, 10.0f, 1e-3f);
+}
+
+TEST_F(PhysicsSystemTest, VelocityVerletShouldTrackDragDecayMoreCloselyThanEuler) {
+    // Arrange
+    PhysicsSystem euler(IntegrationMethod::SemiImplicitEuler);
+    PhysicsSystem verlet(IntegrationMethod::VelocityVerlet);
+    GraphicalObject* body = CreateBody(0.0f, 0.0f, 1.0f, 2.0f);
+    const float expected = 100.0f * std::exp(-2.0f);
+    float eulerSpeed = 0.0f;
+    float verletSpeed = 0.0f;
+
+    // Act
+    for (PhysicsSystem* physics : {&euler, &verlet}) {
+        body->GetComponent<Velocity>()->mVx = 100.0f;
+        for (int i = 0; i < 10; i++) {
+            physics->Update(registry.Store(), 0.1f);
+        }
+        (physics == &euler ? eulerSpeed : verletSpeed) = body->GetComponent<Velocity>()->mVx;
+    }
+
+    // Assert
+    EXPECT_LT(std::fabs(verletSpeed - expected), std::fabs(eulerSpeed - expected));
+    EXPECT_NEAR(verletSpeed, expected, 0.5f);
+}
+
+TEST_F(PhysicsSystemTest, StaticBodiesShouldIgnoreForcesAndGravity) {
+    // Arrange
+    PhysicsSystem physics(IntegrationMethod::VelocityVerlet, 0.0f, 10.0f);
+    GraphicalObject* body = CreateBody(5.0f, 5.0f, 0.0f, 1.0f);
+    body->GetComponent<RigidBody>()->AddForce(100.0f, 100.0f);
+
+    // Act
+    physics.Update(registry.Store(), 0.1f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(body->GetComponent<RigidBody>()->GetMass(), 0.0f);
+    EXPECT_FLOAT_EQ(body->GetComponent<Transform>()->mX, 5.0f);
+    EXPECT_FLOAT_EQ(body->GetComponent<Transform>()->mY, 5.0f);
+}
+
+TEST_F(PhysicsSystemTest, MovementSystemShouldLeaveRigidBodiesToPhysics) {
+    // Arrange
+    MovementSystem movement(800.0f, 600.0f);
+    GraphicalObject* body = CreateBody(10.0f, 10.0f, 1.0f);
+    body->GetComponent<Velocity>()->mVx = 50.0f;
+
+    // Act
+    movement.Update(registry.Store(), 0.1f);
+
+    // Assert
+    EXPECT_FLOAT_EQ(body->GetComponent<Transform>()->mX, 10.0f);
+}
+
+// Determinism tests run with different worker counts
+class PhysicsSystemDeterminismTest : public ::testing::TestWithParam<uint32_t> {
+protected:
+    static std::vector<float> Simulate(JobSystem* jobs) {
+        Registry registry;
+        PhysicsSystem physics(IntegrationMethod::VelocityVerlet, 0.0f, 9.8f);
+        for (int i = 0; i < 10000; i++) {
+            GraphicalObject* object = registry.Get(registry.Create());
+            object->AddComponent<Transform>(static_cast<float>(i % 800), static_cast<float>(i % 600));
+            object->AddComponent<Velocity>(static_cast<float>(i % 13) - 6.0f, static_cast<float>(i % 7) - 3.0f);
+            object->AddComponent<RigidBody>(1.0f + static_cast<float>(i % 5), 0.1f * static_cast<float>(i % 3));
+        }
+
+        std::vector<float> result;
+        for (int step = 0; step < 30; step++) {
+            registry.Store().Pool<RigidBody>().ForEach([step](ObjectId id, RigidBody& body) {
+                body.AddForce(std::sin(static_cast<float>(id + step)), std::cos(static_cast<float>(id)));
+            });
+            physics.Update(registry.Store(), 1.0f / 60.0f, jobs);
+        }
+        registry.Store().Pool<Transform>().ForEach([&result](ObjectId, Transform& transform) {
+            result.push_back(transform.mX);
+            result.push_back(transform.mY);
+        });
+        return result;
+    }
+};
+
+TEST_P(PhysicsSystemDeterminismTest, ResultsShouldNotDependOnWorkerCount) {
+    // Arrange
+    JobSystem jobs(GetParam());
+
+    // Act
+    std::vector<float> serial = Simulate(nullptr);
+    std::vector<float> parallel = Simulate(&jobs);
+
+    // Assert
+    EXPECT_EQ(serial, parallel);
+}
+
+INSTANTIATE_TEST_SUITE_P(WorkerCounts, PhysicsSystemDeterminismTest, ::testing::Values(0u, 1u, 3u));
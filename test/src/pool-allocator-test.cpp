@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "pool-allocator.h"
+#include "registry.h"
+#include "render-strategies.h"
+
+// Test fixture for FixedBlockPool tests
+class FixedBlockPoolTest : public ::testing::Test {
+protected:
+    FixedBlockPool pool{24, 8, 4};
+};
+
+TEST_F(FixedBlockPoolTest, AllocateShouldReturnDistinctAlignedBlocks) {
+    // Act
+    std::set<void*> blocks;
+    for (int i = 0; i < 10; i++) {
+        blocks.insert(pool.Allocate());
+    }
+
+    // Assert
+    EXPECT_EQ(blocks.size(), 10u);
+    for (void* block : blocks) {
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % 8, 0u);
+    }
+}
+
+TEST_F(FixedBlockPoolTest, DeallocatedBlockShouldBeReused) {
+    // Arrange
+    void* first = pool.Allocate();
+    pool.Allocate();
+
+    // Act
+    pool.Deallocate(first);
+    void* reused = pool.Allocate();
+
+    // Assert
+    EXPECT_EQ(reused, first);
+    EXPECT_EQ(pool.GetStats().mChunkCount, 1u);
+}
+
+TEST_F(FixedBlockPoolTest, StatsShouldTrackOccupancyAndPeak) {
+    // Arrange
+    std::vector<void*> blocks;
+    for (int i = 0; i < 6; i++) {
+        blocks.push_back(pool.Allocate());
+    }
+
+    // Act
+    pool.Deallocate(blocks[0]);
+    pool.Deallocate(blocks[1]);
+    PoolStats stats = pool.GetStats();
+
+    // Assert
+    EXPECT_EQ(stats.mBlockSize, 24u);
+    EXPECT_EQ(stats.mInUse, 4u);
+    EXPECT_EQ(stats.mPeakInUse, 6u);
+    EXPECT_EQ(stats.mCapacity, 8u);
+    EXPECT_EQ(stats.mChunkCount, 2u);
+}
+
+TEST_F(FixedBlockPoolTest, ReserveShouldGrowCapacityUpFront) {
+    // Act
+    pool.Reserve(9);
+
+    // Assert
+    EXPECT_EQ(pool.GetStats().mCapacity, 12u);
+    EXPECT_EQ(pool.GetStats().mInUse, 0u);
+}
+
+TEST(FixedBlockPoolBackingTest, HugePageBackedPoolShouldServeBlocks) {
+    // Arrange
+    FixedBlockPool hugePool(64, 64, 16, PoolBacking::HugePages);
+
+    // Act
+    auto* block = static_cast<uint8_t*>(hugePool.Allocate());
+    block[0] = 1;
+    block[63] = 2;
+
+    // Assert
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % 64, 0u);
+    EXPECT_GE(hugePool.GetStats().mCapacity, 16u);
+    hugePool.Deallocate(block);
+    EXPECT_EQ(hugePool.GetStats().mInUse, 0u);
+}
+
+TEST(TypedPoolTest, CreateAndDestroyShouldRunConstructorAndDestructor) {
+    // Arrange
+    TypedPool<std::vector<int>> pool(8);
+
+    // Act
+    std::vector<int>* values = pool.Create(3, 7);
+
+    // Assert
+    ASSERT_EQ(values->size(), 3u);
+    EXPECT_EQ((*values)[2], 7);
+    EXPECT_EQ(pool.GetStats().mInUse, 1u);
+
+    pool.Destroy(values);
+    EXPECT_EQ(pool.GetStats().mInUse, 0u);
+}
+
+TEST(PooledObjectTest, RenderStrategiesShouldComeFromTheirPool) {
+    // Arrange
+    const size_t before = CircleRenderer::GetPoolStats().mInUse;
+
+    // Act
+    std::unique_ptr<RenderStrategy> strategy = std::make_unique<CircleRenderer>(SDL_Color{255, 0, 0, 255}, 10);
+
+    // Assert
+    EXPECT_EQ(CircleRenderer::GetPoolStats().mInUse, before + 1);
+    strategy.reset();
+    EXPECT_EQ(CircleRenderer::GetPoolStats().mInUse, before);
+}
+
+TEST(ComponentPoolStatsTest, RemovedSlotsShouldBeReusedWithoutGrowing) {
+    // Arrange
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 100; i++) {
+        entities.push_back(registry.Create());
+        registry.Get(entities.back())->AddComponent<Transform>();
+    }
+
+    // Act
+    for (int i = 0; i < 50; i++) {
+        registry.Destroy(entities[i]);
+    }
+    for (int i = 0; i < 50; i++) {
+        registry.Get(registry.Create())->AddComponent<Transform>();
+    }
+    PoolStats stats = registry.Store().Pool<Transform>().GetStats();
+
+    // Assert
+    EXPECT_EQ(stats.mInUse, 100u);
+    EXPECT_EQ(stats.mPeakInUse, 100u);
+    EXPECT_EQ(stats.mCapacity, ComponentPool<Transform>::kPageSize);
+    EXPECT_EQ(registry.GetObjectPoolStats().mInUse, 100u);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "registry.h"
+
+// Test fixture for Registry tests
+class RegistryTest : public ::testing::Test {
+protected:
+    Registry registry;
+};
+
+TEST_F(RegistryTest, CreateShouldReturnDistinctAliveEntities) {
+    // Act
+    Entity first = registry.Create();
+    Entity second = registry.Create();
+
+    // Assert
+    EXPECT_NE(first, second);
+    EXPECT_TRUE(registry.IsAlive(first));
+    EXPECT_TRUE(registry.IsAlive(second));
+    EXPECT_EQ(registry.Size(), 2u);
+}
+
+TEST_F(RegistryTest, DefaultEntityShouldBeNullAndNotAlive) {
+    // Arrange
+    Entity entity;
+
+    // Act & Assert
+    EXPECT_TRUE(entity.IsNull());
+    EXPECT_FALSE(registry.IsAlive(entity));
+    EXPECT_EQ(registry.Get(entity), nullptr);
+}
+
+TEST_F(RegistryTest, DestroyShouldInvalidateHandle) {
+    // Arrange
+    Entity entity = registry.Create();
+    registry.Get(entity)->AddComponent<Transform>();
+
+    // Act
+    registry.Destroy(entity);
+
+    // Assert
+    EXPECT_FALSE(registry.IsAlive(entity));
+    EXPECT_EQ(registry.Get(entity), nullptr);
+    EXPECT_EQ(registry.Store().Pool<Transform>().Size(), 0u);
+    EXPECT_EQ(registry.Size(), 0u);
+}
+
+TEST_F(RegistryTest, StaleHandleShouldNotResolveToReusedSlot) {
+    // Arrange
+    Entity stale = registry.Create();
+    registry.Destroy(stale);
+
+    // Act
+    Entity reused = registry.Create();
+
+    // Assert
+    EXPECT_EQ(reused.mIndex, stale.mIndex);
+    EXPECT_NE(reused.mGeneration, stale.mGeneration);
+    EXPECT_EQ(registry.Get(stale), nullptr);
+    EXPECT_NE(registry.Get(reused), nullptr);
+}
+
+TEST_F(RegistryTest, ObjectAddressesShouldStayStableWhileRegistryGrows) {
+    // Arrange
+    Entity first = registry.Create();
+    GraphicalObject* object = registry.Get(first);
+
+    // Act
+    for (int i = 0; i < 10000; i++) {
+        registry.Create();
+    }
+
+    // Assert
+    EXPECT_EQ(registry.Get(first), object);
+    EXPECT_EQ(object->GetEntity(), first);
+}
+
+TEST_F(RegistryTest, ForEachShouldVisitOnlyAliveObjects) {
+    // Arrange
+    std::vector<Entity> entities;
+    for (int i = 0; i < 5; i++) {
+        entities.push_back(registry.Create());
+    }
+    registry.Destroy(entities[1]);
+    registry.Destroy(entities[3]);
+
+    // Act
+    std::vector<Entity> visited;
+    registry.ForEach([&visited](GraphicalObject& object) {
+        visited.push_back(object.GetEntity());
+    });
+
+    // Assert
+    ASSERT_EQ(visited.size(), 3u);
+    for (const Entity& entity : visited) {
+        EXPECT_TRUE(registry.IsAlive(entity));
+    }
+}
+
+TEST_F(RegistryTest, ChurnShouldReuseSlots) {
+    // Arrange
+    std::vector<Entity> entities;
+    for (int i = 0; i < 100; i++) {
+        entities.push_back(registry.Create());
+    }
+
+    // Act
+    for (int round = 0; round < 10; round++) {
+        for (Entity& entity : entities) {
+            registry.Destroy(entity);
+            entity = registry.Create();
+        }
+    }
+
+    // Assert
+    for (const Entity& entity : entities) {
+        EXPECT_LT(entity.mIndex, 100u);
+        EXPECT_TRUE(registry.IsAlive(entity));
+    }
+}
+
+TEST_F(RegistryTest, FactoryShouldCreateEntityWithComponents) {
+    // Act
+    Entity entity = GraphicalObjectFactory::CreateCircle(registry, 10.0f, 20.0f);
+
+    // Assert
+    auto* object = registry.Get(entity);
+    ASSERT_NE(object, nullptr);
+    ASSERT_NE(object->GetComponent<Transform>(), nullptr);
+    EXPECT_FLOAT_EQ(object->GetComponent<Transform>()->mX, 10.0f);
+    EXPECT_NE(object->GetComponent<Velocity>(), nullptr);
+    EXPECT_NE(object->GetComponent<RenderComponent>(), nullptr);
+    EXPECT_EQ(object->GetComponent<RenderComponent>()->mOwner, object);
+}
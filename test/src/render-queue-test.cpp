@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "components.h"
+#include "render-queue.h"
+#include "render-strategies.h"
+#include "shape-texture-cache.h"
+
+// Test fixture for RenderQueue tests
+class RenderQueueTest : public ::testing::Test {
+protected:
+    RenderQueue queue;
+    RectangleRenderer red{SDL_Color{255, 0, 0, 255}, 10, 10};
+    RectangleRenderer blue{SDL_Color{0, 0, 255, 255}, 10, 10};
+    CircleRenderer circle{SDL_Color{255, 0, 0, 255}, 5};
+};
+
+TEST_F(RenderQueueTest, RadixSortShouldMatchStableSort) {
+    // Arrange
+    std::mt19937_64 random(42);
+    std::vector<RenderQueue::SortEntry> entries(5000);
+    for (size_t i = 0; i < entries.size(); i++) {
+        // Az sayida farkli anahtar, esitlerin sirasinin da sinanmasini saglar
+        entries[i] = RenderQueue::SortEntry{(random() % 16) << ((i % 3) * 20), static_cast<uint32_t>(i)};
+    }
+    std::vector<RenderQueue::SortEntry> expected = entries;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& a, const auto& b) { return a.mKey < b.mKey; });
+    std::vector<RenderQueue::SortEntry> scratch(entries.size());
+
+    // Act
+    RenderQueue::SortEntry* sorted = RenderQueue::RadixSort(entries.data(), scratch.data(), entries.size());
+
+    // Assert
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(sorted[i].mKey, expected[i].mKey) << i;
+        ASSERT_EQ(sorted[i].mIndex, expected[i].mIndex) << i;
+    }
+}
+
+TEST_F(RenderQueueTest, RadixSortShouldHandleEmptyAndUniformInput) {
+    // Arrange
+    std::vector<RenderQueue::SortEntry> entries{{7, 0}, {7, 1}, {7, 2}};
+    std::vector<RenderQueue::SortEntry> scratch(entries.size());
+
+    // Act
+    RenderQueue::SortEntry* empty = RenderQueue::RadixSort(entries.data(), scratch.data(), 0);
+    RenderQueue::SortEntry* uniform = RenderQueue::RadixSort(entries.data(), scratch.data(), entries.size());
+
+    // Assert
+    EXPECT_EQ(empty, entries.data());
+    EXPECT_EQ(uniform, entries.data());
+    EXPECT_EQ(uniform[2].mIndex, 2u);
+}
+
+TEST_F(RenderQueueTest, LayerShouldDominateStateInOrder) {
+    // Arrange
+    queue.Push(&blue, Transform(0.0f, 0.0f), 1);
+    queue.Push(&red, Transform(1.0f, 0.0f), 0);
+    queue.Push(&blue, Transform(2.0f, 0.0f), 0);
+    queue.Push(&red, Transform(3.0f, 0.0f), 0);
+
+    // Act
+    queue.Sort();
+
+    // Assert
+    ASSERT_EQ(queue.Size(), 4u);
+    EXPECT_EQ(queue.IndexAt(0), 2u);
+    EXPECT_EQ(queue.IndexAt(1), 1u);
+    EXPECT_EQ(queue.IndexAt(2), 3u);
+    EXPECT_EQ(queue.IndexAt(3), 0u);
+}
+
+TEST_F(RenderQueueTest, KeysShouldSeparateLayerBlendShapeAndColor) {
+    // Arrange
+    const Transform transform;
+    const uint64_t key = RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, red, transform);
+
+    // Act & Assert
+    EXPECT_EQ(key, RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, RectangleRenderer(SDL_Color{255, 0, 0, 255}, 10, 10),
+                                        transform));
+    EXPECT_NE(key, RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, blue, transform));
+    EXPECT_NE(key, RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, circle, transform));
+    EXPECT_LT(RenderQueue::MakeKey(0, SDL_BLENDMODE_BLEND, blue, transform),
+              RenderQueue::MakeKey(1, SDL_BLENDMODE_NONE, red, transform));
+    EXPECT_LT(RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, circle, transform),
+              RenderQueue::MakeKey(0, SDL_BLENDMODE_BLEND, red, transform));
+    EXPECT_EQ(RenderQueue::MakeKey(255, SDL_BLENDMODE_NONE, red, transform) >> 56, 255u);
+}
+
+TEST_F(RenderQueueTest, CircleMaterialShouldFollowScaledTextureSize) {
+    // Arrange
+    Transform unit;
+    Transform stretched;
+    stretched.mScaleY = 3.0f;
+    Transform nearlyUnit;
+    nearlyUnit.mScaleX = 1.05f;
+    Transform tripled;
+    tripled.mScaleX = tripled.mScaleY = 3.0f;
+    const CircleRenderer wide{SDL_Color{255, 0, 0, 255}, 15};
+
+    // Act
+    const uint64_t key = RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, circle, unit);
+
+    // Assert
+    const SDL_Color color{255, 0, 0, 255};
+    EXPECT_EQ(circle.MaterialKey(unit), ShapeTextureCache::MakeKey(ShapeType::Circle, 11, 11, color));
+    EXPECT_EQ(circle.MaterialKey(stretched), ShapeTextureCache::MakeKey(ShapeType::Circle, 11, 31, color));
+    EXPECT_NE(key, RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, circle, stretched));
+    EXPECT_EQ(key, RenderQueue::MakeKey(0, SDL_BLENDMODE_NONE, circle, nearlyUnit));
+    EXPECT_EQ(wide.MaterialKey(unit), circle.MaterialKey(tripled));
+}
+
+TEST_F(RenderQueueTest, ClearShouldKeepQueueReusable) {
+    // Arrange
+    queue.Push(&red, Transform(), 3);
+    queue.Sort();
+
+    // Act
+    queue.Clear();
+    queue.Push(&blue, Transform(), 1);
+    queue.Push(&red, Transform(), 0);
+    queue.Sort();
+
+    // Assert
+    ASSERT_EQ(queue.Size(), 2u);
+    EXPECT_EQ(queue.IndexAt(0), 1u);
+    EXPECT_EQ(queue.KeyAt(0) >> 56, 0u);
+}
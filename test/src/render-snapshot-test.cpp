@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+#include "registry.h"
+#include "render-snapshot.h"
+#include "render-strategies.h"
+
+// Test fixture for RenderSnapshot tests
+class RenderSnapshotTest : public ::testing::Test {
+protected:
+    Registry registry;
+    RenderSnapshot snapshot;
+
+    std::vector<ObjectId> IdsOf(const std::vector<Entity>& entities) {
+        std::vector<ObjectId> ids;
+        for (Entity entity : entities) {
+            ids.push_back(entity.mIndex);
+        }
+        return ids;
+    }
+};
+
+TEST_F(RenderSnapshotTest, CaptureShouldCopyTransformsAndShareStrategies) {
+    // Arrange
+    std::vector<SDL_FPoint> positions{{10.0f, 20.0f}, {30.0f, 40.0f}, {50.0f, 60.0f}};
+    std::vector<Entity> entities =
+        GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(), 3, positions);
+    entities.push_back(GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::RectanglePrefab(), 70.0f, 80.0f));
+
+    // Act
+    snapshot.Capture(registry, IdsOf(entities));
+
+    // Assert
+    ASSERT_EQ(snapshot.mItems.size(), 4u);
+    EXPECT_EQ(snapshot.mStrategies.size(), 2u);
+    EXPECT_EQ(snapshot.mItems[0].mStrategy, snapshot.mItems[2].mStrategy);
+    EXPECT_NE(snapshot.mItems[0].mStrategy, snapshot.mItems[3].mStrategy);
+    EXPECT_FLOAT_EQ(snapshot.mItems[1].mTransform.mX, 30.0f);
+    EXPECT_FLOAT_EQ(snapshot.mItems[3].mTransform.mY, 80.0f);
+    EXPECT_EQ(snapshot.mItems[0].mTransform.mOwner, nullptr);
+}
+
+TEST_F(RenderSnapshotTest, CapturedStateShouldOutliveSimulationChanges) {
+    // Arrange
+    Entity entity = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::TrianglePrefab(), 5.0f, 5.0f);
+    snapshot.Capture(registry, IdsOf({entity}));
+
+    // Act
+    registry.Get(entity)->GetComponent<Transform>()->mX = 500.0f;
+    registry.Destroy(entity);
+
+    // Assert
+    ASSERT_EQ(snapshot.mItems.size(), 1u);
+    EXPECT_FLOAT_EQ(snapshot.mItems[0].mTransform.mX, 5.0f);
+    EXPECT_EQ(snapshot.mStrategies[0]->GetShape().mType, ShapeType::Triangle);
+}
+
+TEST_F(RenderSnapshotTest, RecaptureShouldReplacePreviousContents) {
+    // Arrange
+    Entity first = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::CirclePrefab(), 1.0f, 1.0f);
+    Entity second = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::RectanglePrefab(), 2.0f, 2.0f);
+    snapshot.Capture(registry, IdsOf({first, second}));
+
+    // Act
+    snapshot.Capture(registry, IdsOf({second}));
+
+    // Assert
+    ASSERT_EQ(snapshot.mItems.size(), 1u);
+    EXPECT_EQ(snapshot.mStrategies.size(), 1u);
+    EXPECT_EQ(snapshot.mItems[0].mStrategy, 0u);
+    EXPECT_FLOAT_EQ(snapshot.mItems[0].mTransform.mX, 2.0f);
+}
+
+TEST_F(RenderSnapshotTest, InterleavedStrategiesShouldMapToTheirOwnIndex) {
+    // Arrange
+    Entity circle = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::CirclePrefab(), 1.0f, 1.0f);
+    Entity triangle = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::TrianglePrefab(), 2.0f, 2.0f);
+    Entity rectangle = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::RectanglePrefab(), 3.0f, 3.0f);
+    Entity secondCircle = GraphicalObjectFactory::Spawn(registry, GraphicalObjectFactory::CirclePrefab(), 4.0f, 4.0f);
+
+    // Act
+    snapshot.Capture(registry, IdsOf({circle, triangle, rectangle, secondCircle, triangle}));
+
+    // Assert
+    ASSERT_EQ(snapshot.mItems.size(), 5u);
+    ASSERT_EQ(snapshot.mStrategies.size(), 3u);
+    EXPECT_EQ(snapshot.mStrategies[snapshot.mItems[0].mStrategy]->GetShape().mType, ShapeType::Circle);
+    EXPECT_EQ(snapshot.mStrategies[snapshot.mItems[1].mStrategy]->GetShape().mType, ShapeType::Triangle);
+    EXPECT_EQ(snapshot.mStrategies[snapshot.mItems[2].mStrategy]->GetShape().mType, ShapeType::Rectangle);
+    EXPECT_EQ(snapshot.mItems[3].mStrategy, snapshot.mItems[0].mStrategy);
+    EXPECT_EQ(snapshot.mItems[4].mStrategy, snapshot.mItems[1].mStrategy);
+}
+
+TEST_F(RenderSnapshotTest, AlphaShouldAdvanceWithElapsedTimeAndClamp) {
+    // Arrange
+    snapshot.mAlpha = 0.25f;
+    snapshot.mStepSeconds = 0.1f;
+    snapshot.mPublishTime = std::chrono::steady_clock::time_point{};
+
+    // Act
+    float atPublish = snapshot.AlphaAt(snapshot.mPublishTime);
+    float halfStep = snapshot.AlphaAt(snapshot.mPublishTime + std::chrono::milliseconds(50));
+    float late = snapshot.AlphaAt(snapshot.mPublishTime + std::chrono::seconds(1));
+
+    // Assert
+    EXPECT_FLOAT_EQ(atPublish, 0.25f);
+    EXPECT_NEAR(halfStep, 0.75f, 1e-4f);
+    EXPECT_FLOAT_EQ(late, 1.0f);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "components.h"
+#include "render-strategies.h"
+
+// Test fixture for RenderStrategy tests
+class RenderStrategiesTest : public ::testing::Test {
+protected:
+    std::vector<SDL_FRect> spans;
+
+    // Eski piksel piksel dolduran algoritmanin kapsadigi piksel sayisi
+    static int64_t BruteForcePixelCount(int64_t radiusX, int64_t radiusY) {
+        int64_t count = 0;
+        for (int64_t y = -radiusY; y <= radiusY; y++) {
+            for (int64_t x = -radiusX; x <= radiusX; x++) {
+                count += x * x * radiusY * radiusY + y * y * radiusX * radiusX <= radiusX * radiusX * radiusY * radiusY;
+            }
+        }
+        return count;
+    }
+
+    int64_t SpanPixelCount() const {
+        int64_t count = 0;
+        for (const SDL_FRect& span : spans) {
+            count += static_cast<int64_t>(span.w);
+        }
+        return count;
+    }
+};
+
+TEST_F(RenderStrategiesTest, CircleSpansShouldCoverSamePixelsAsPerPixelFill) {
+    for (int32_t radius : {0, 1, 2, 5, 25, 100}) {
+        // Act
+        CircleRenderer::BuildSpans(100, 200, radius, radius, spans);
+
+        // Assert
+        ASSERT_EQ(spans.size(), static_cast<size_t>(2 * radius + 1));
+        EXPECT_EQ(SpanPixelCount(), BruteForcePixelCount(radius, radius)) << "radius " << radius;
+        EXPECT_FLOAT_EQ(spans[radius].x, 100.0f - radius);
+        EXPECT_FLOAT_EQ(spans[radius].y, 200.0f);
+        EXPECT_FLOAT_EQ(spans[radius].w, 2.0f * radius + 1.0f);
+        EXPECT_FLOAT_EQ(spans[0].h, 1.0f);
+    }
+}
+
+TEST_F(RenderStrategiesTest, SpansShouldBeSymmetricAroundCenter) {
+    // Act
+    CircleRenderer::BuildSpans(50, 50, 13, 13, spans);
+
+    // Assert
+    for (size_t i = 0; i < spans.size(); i++) {
+        const SDL_FRect& span = spans[i];
+        const SDL_FRect& mirrored = spans[spans.size() - 1 - i];
+        EXPECT_FLOAT_EQ(span.w, mirrored.w);
+        EXPECT_FLOAT_EQ(span.x + span.w / 2.0f, 50.5f);
+    }
+}
+
+TEST_F(RenderStrategiesTest, DifferentScalesShouldProduceEllipse) {
+    // Act
+    CircleRenderer::BuildSpans(0, 0, 20, 10, spans);
+
+    // Assert
+    ASSERT_EQ(spans.size(), 21u);
+    EXPECT_FLOAT_EQ(spans[10].w, 41.0f);
+    EXPECT_FLOAT_EQ(spans[0].y, -10.0f);
+    EXPECT_LT(spans[0].w, spans[5].w);
+    EXPECT_EQ(SpanPixelCount(), BruteForcePixelCount(20, 10));
+}
+
+TEST_F(RenderStrategiesTest, ZeroHeightShouldProduceSingleLine) {
+    // Act
+    CircleRenderer::BuildSpans(10, 10, 4, 0, spans);
+
+    // Assert
+    ASSERT_EQ(spans.size(), 1u);
+    EXPECT_FLOAT_EQ(spans[0].x, 6.0f);
+    EXPECT_FLOAT_EQ(spans[0].w, 9.0f);
+}
+
+TEST_F(RenderStrategiesTest, TriangleVerticesShouldFollowTransform) {
+    // Arrange
+    TriangleRenderer triangle(SDL_FColor{1.0f, 0.0f, 1.0f, 1.0f}, 100.0f);
+    Transform transform(50.0f, 60.0f);
+
+    // Act
+    std::array<SDL_Vertex, 3> upright = triangle.MakeVertices(transform);
+    transform.mX = 150.0f;
+    std::array<SDL_Vertex, 3> moved = triangle.MakeVertices(transform);
+    transform.mRotation = 3.14159265f;
+    std::array<SDL_Vertex, 3> rotated = triangle.MakeVertices(transform);
+
+    // Assert
+    EXPECT_FLOAT_EQ(upright[0].position.x, 50.0f);
+    EXPECT_NEAR(upright[0].position.y, 60.0f - 86.6f * 0.667f, 1e-3f);
+    EXPECT_FLOAT_EQ(upright[1].position.x, 0.0f);
+    EXPECT_FLOAT_EQ(upright[2].position.x, 100.0f);
+    EXPECT_FLOAT_EQ(upright[2].color.b, 1.0f);
+    EXPECT_FLOAT_EQ(moved[1].position.x, 100.0f);
+    EXPECT_FLOAT_EQ(moved[1].position.y, upright[1].position.y);
+    EXPECT_NEAR(rotated[0].position.y, 60.0f + 86.6f * 0.667f, 1e-3f);
+    EXPECT_NEAR(rotated[1].position.x, 200.0f, 1e-3f);
+}
+
+TEST_F(RenderStrategiesTest, SharedTriangleStrategyShouldServeDifferentTransforms) {
+    // Arrange
+    TriangleRenderer triangle(SDL_FColor{1.0f, 1.0f, 1.0f, 1.0f}, 10.0f);
+    Transform first(0.0f, 0.0f);
+    Transform second(0.0f, 0.0f);
+    second.mScaleX = 2.0f;
+
+    // Act
+    float firstWidth = triangle.MakeVertices(first)[2].position.x - triangle.MakeVertices(first)[1].position.x;
+    float secondWidth = triangle.MakeVertices(second)[2].position.x - triangle.MakeVertices(second)[1].position.x;
+    float firstAgain = triangle.MakeVertices(first)[2].position.x;
+
+    // Assert
+    EXPECT_FLOAT_EQ(firstWidth, 10.0f);
+    EXPECT_FLOAT_EQ(secondWidth, 20.0f);
+    EXPECT_FLOAT_EQ(firstAgain, 5.0f);
+}
+
+TEST_F(RenderStrategiesTest, TriangleOffsetCacheShouldSkipTrigForUnchangedRotationAndScale) {
+    // Arrange
+    TriangleRenderer triangle(SDL_FColor{1.0f, 0.0f, 0.0f, 1.0f}, 20.0f);
+    TriangleOffsetCache cache;
+    Transform transform(10.0f, 10.0f);
+    transform.mRotation = 0.5f;
+
+    // Act
+    std::array<SDL_Vertex, 3> first = triangle.MakeVertices(transform, &cache);
+    transform.mX = 200.0f;
+    std::array<SDL_Vertex, 3> moved = triangle.MakeVertices(transform, &cache);
+    const size_t missesAfterMove = cache.Misses();
+    transform.mRotation = 1.0f;
+    triangle.MakeVertices(transform, &cache);
+
+    // Assert
+    EXPECT_EQ(missesAfterMove, 1u);
+    EXPECT_EQ(cache.Misses(), 2u);
+    transform.mRotation = 0.5f;
+    std::array<SDL_Vertex, 3> uncached = triangle.MakeVertices(transform);
+    for (size_t i = 0; i < first.size(); i++) {
+        EXPECT_FLOAT_EQ(moved[i].position.x - first[i].position.x, 190.0f);
+        EXPECT_FLOAT_EQ(moved[i].position.x, uncached[i].position.x);
+        EXPECT_FLOAT_EQ(moved[i].position.y, uncached[i].position.y);
+    }
+}
+
+TEST_F(RenderStrategiesTest, FanSegmentsShouldKeepChordErrorBelowHalfPixel) {
+    for (float radius : {0.0f, 1.0f, 5.0f, 25.0f, 100.0f, 1000.0f}) {
+        // Act
+        uint32_t segments = CircleRenderer::FanSegments(radius);
+
+        // Assert
+        EXPECT_GE(segments, 8u);
+        EXPECT_LE(segments, 128u);
+        if (segments < 128u) {
+            EXPECT_LE(radius * (1.0f - std::cos(3.14159265f / static_cast<float>(segments))), 0.5f + 1e-4f);
+        }
+    }
+    EXPECT_LT(CircleRenderer::FanSegments(5.0f), CircleRenderer::FanSegments(100.0f));
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "registry.h"
+#include "render-strategies.h"
+#include "replay-buffer.h"
+
+// Test fixture for ReplayBuffer tests
+class ReplayBufferTest : public ::testing::Test {
+protected:
+    Registry registry;
+    std::vector<Entity> entities;
+
+    void SetUp() override {
+        std::vector<SDL_FPoint> positions{{0.0f, 0.0f}, {100.0f, 50.0f}, {300.0f, 200.0f}};
+        entities = GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(), 3, positions);
+        // Ortadaki nesne durağandır, böylece farklarda değişmeyen bloklar da bulunur
+        registry.Get(entities[1])->GetComponent<Velocity>()->mVx = 0.0f;
+        registry.Get(entities[1])->GetComponent<Velocity>()->mVy = 0.0f;
+    }
+
+    void Step() {
+        for (Entity entity : entities) {
+            GraphicalObject* object = registry.Get(entity);
+            if (!object) {
+                continue;
+            }
+            auto* transform = object->GetComponent<Transform>();
+            auto* velocity = object->GetComponent<Velocity>();
+            transform->SnapshotPrevious();
+            transform->mX += velocity->mVx * 0.01f;
+            transform->mY += velocity->mVy * 0.01f;
+            velocity->mVy += 1.0f;
+        }
+    }
+
+    Transform TransformOf(Entity entity) {
+        return *registry.Get(entity)->GetComponent<Transform>();
+    }
+};
+
+TEST_F(ReplayBufferTest, SeekShouldRestoreEveryRecordedTick) {
+    // Arrange
+    ReplayBuffer replay(4);
+    std::vector<float> xs;
+    std::vector<float> vys;
+    for (int tick = 0; tick < 20; tick++) {
+        Step();
+        replay.Record(registry);
+        xs.push_back(TransformOf(entities[0]).mX);
+        vys.push_back(registry.Get(entities[2])->GetComponent<Velocity>()->mVy);
+    }
+
+    // Act & Assert
+    for (int tick = 19; tick >= 0; tick--) {
+        ASSERT_TRUE(replay.Seek(registry, static_cast<uint64_t>(tick)));
+        EXPECT_EQ(TransformOf(entities[0]).mX, xs[tick]);
+        EXPECT_EQ(registry.Get(entities[2])->GetComponent<Velocity>()->mVy, vys[tick]);
+        EXPECT_EQ(replay.NewestTick(), static_cast<uint64_t>(tick));
+    }
+}
+
+TEST_F(ReplayBufferTest, RecordingAfterSeekShouldReplayIdentically) {
+    // Arrange
+    ReplayBuffer replay(8);
+    for (int tick = 0; tick < 10; tick++) {
+        Step();
+        replay.Record(registry);
+    }
+    const Transform expected = TransformOf(entities[2]);
+
+    // Act
+    replay.Seek(registry, 4);
+    for (int tick = 5; tick < 10; tick++) {
+        Step();
+        EXPECT_EQ(replay.Record(registry), static_cast<uint64_t>(tick));
+    }
+
+    // Assert
+    EXPECT_EQ(TransformOf(entities[2]).mX, expected.mX);
+    EXPECT_EQ(TransformOf(entities[2]).mY, expected.mY);
+    EXPECT_EQ(TransformOf(entities[2]).mPrevY, expected.mPrevY);
+}
+
+TEST_F(ReplayBufferTest, MemoryShouldStayWithinCapacityAndKeepRecentTicks) {
+    // Arrange
+    ReplayBuffer replay(5, 1024);
+
+    // Act
+    for (int tick = 0; tick < 500; tick++) {
+        Step();
+        replay.Record(registry);
+        ASSERT_LE(replay.UsedBytes(), replay.CapacityBytes());
+    }
+
+    // Assert
+    EXPECT_EQ(replay.NewestTick(), 499u);
+    EXPECT_GT(replay.OldestTick(), 0u);
+    EXPECT_FALSE(replay.Seek(registry, 0));
+    EXPECT_TRUE(replay.Seek(registry, replay.OldestTick()));
+}
+
+TEST_F(ReplayBufferTest, ChangedObjectCountShouldStartNewKeyframe) {
+    // Arrange
+    ReplayBuffer replay(100);
+    Step();
+    replay.Record(registry);
+    const float before = TransformOf(entities[0]).mX;
+    entities.push_back(GraphicalObjectFactory::CreateRectangle(registry, 10.0f, 10.0f));
+    Step();
+    replay.Record(registry);
+    Step();
+    replay.Record(registry);
+
+    // Act
+    const bool found = replay.Seek(registry, 0);
+
+    // Assert
+    ASSERT_TRUE(found);
+    EXPECT_EQ(TransformOf(entities[0]).mX, before);
+    EXPECT_EQ(replay.FrameCount(), 1u);
+}
+
+TEST_F(ReplayBufferTest, SeekShouldSkipObjectsWhoseIdWasReused) {
+    // Arrange
+    ReplayBuffer replay(100);
+    Step();
+    replay.Record(registry);
+    registry.Destroy(entities[0]);
+    Entity reused = GraphicalObjectFactory::CreateRectangle(registry, 500.0f, 400.0f);
+    ASSERT_EQ(reused.mIndex, entities[0].mIndex);
+    Step();
+    replay.Record(registry);
+
+    // Act
+    const bool found = replay.Seek(registry, 0);
+
+    // Assert
+    ASSERT_TRUE(found);
+    EXPECT_EQ(TransformOf(reused).mX, 500.0f);
+    EXPECT_EQ(TransformOf(reused).mY, 400.0f);
+}
+
+TEST_F(ReplayBufferTest, OversizeKeyframeShouldBeCountedAsDropped) {
+    // Arrange
+    ReplayBuffer replay(5, 64);
+    ASSERT_GT(ReplayBuffer::KeyframeBytes(registry), replay.CapacityBytes());
+
+    // Act
+    Step();
+    const uint64_t tick = replay.Record(registry);
+
+    // Assert
+    EXPECT_EQ(tick, 0u);
+    EXPECT_EQ(replay.DroppedTicks(), 1u);
+    EXPECT_TRUE(replay.Empty());
+    EXPECT_FALSE(replay.Seek(registry, 0));
+}
+
+TEST_F(ReplayBufferTest, RecordingShouldResumeOnceKeyframesFitAgain) {
+    // Arrange
+    ReplayBuffer replay(5, 64);
+    Step();
+    replay.Record(registry);
+    registry.Destroy(entities[1]);
+    registry.Destroy(entities[2]);
+    ASSERT_LE(ReplayBuffer::KeyframeBytes(registry), replay.CapacityBytes());
+
+    // Act
+    Step();
+    const uint64_t tick = replay.Record(registry);
+
+    // Assert
+    EXPECT_EQ(replay.DroppedTicks(), 1u);
+    EXPECT_EQ(replay.FrameCount(), 1u);
+    EXPECT_TRUE(replay.Seek(registry, tick));
+}
+
+TEST_F(ReplayBufferTest, CapacityBelowEmptyKeyframeShouldBeRejected) {
+    // Act & Assert
+    EXPECT_THROW(ReplayBuffer(5, 4), std::runtime_error);
+}
+
+TEST_F(ReplayBufferTest, TicksOutsideBufferShouldNotBeFound) {
+    // Arrange
+    ReplayBuffer replay;
+    Step();
+    replay.Record(registry);
+
+    // Act & Assert
+    EXPECT_FALSE(replay.Seek(registry, 1));
+    EXPECT_TRUE(replay.Seek(registry, 0));
+}
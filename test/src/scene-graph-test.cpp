@@ -0,0 +1,397 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "job-system.h"
+#include "movement-system.h"
+#include "registry.h"
+#include "scene-graph.h"
+#include "system-scheduler.h"
+
+// Update sırasında sahibinin dönüşümünü yazan bileşen
+class SlidingComponent : public Component {
+public:
+    void Update(float deltaTime) override {
+        mOwner->GetComponent<Transform>()->mX += 10.0f * deltaTime;
+    }
+};
+
+// Test fixture for SceneGraph tests
+class SceneGraphTest : public ::testing::Test {
+protected:
+    Registry registry;
+
+    Entity CreateNode(float x, float y) {
+        Entity entity = registry.Create();
+        registry.Get(entity)->AddComponent<Transform>(x, y);
+        return entity;
+    }
+
+    WorldTransform* World(Entity entity) {
+        return registry.Get(entity)->GetComponent<WorldTransform>();
+    }
+
+    Transform* Write(Entity entity) {
+        registry.Get(entity)->MarkChanged<Transform>();
+        return registry.Get(entity)->GetComponent<Transform>();
+    }
+
+    void Update() {
+        registry.Hierarchy().Update(registry.Store());
+    }
+};
+
+TEST_F(SceneGraphTest, ChildWorldTransformShouldCombineParentAndLocal) {
+    // Arrange
+    Entity parent = CreateNode(100.0f, 50.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.Get(parent)->GetComponent<Transform>()->mRotation = std::numbers::pi_v<float> / 2.0f;
+    registry.Get(parent)->GetComponent<Transform>()->mScaleX = 2.0f;
+    registry.Get(parent)->GetComponent<Transform>()->mScaleY = 2.0f;
+
+    // Act
+    registry.SetParent(child, parent);
+    Update();
+
+    // Assert
+    auto* world = World(child);
+    ASSERT_NE(world, nullptr);
+    EXPECT_NEAR(world->mX, 100.0f, 1e-4f);
+    EXPECT_NEAR(world->mY, 70.0f, 1e-4f);
+    EXPECT_NEAR(world->mRotation, std::numbers::pi_v<float> / 2.0f, 1e-5f);
+    EXPECT_NEAR(world->mScaleX, 2.0f, 1e-5f);
+    EXPECT_EQ(registry.GetParent(child), parent);
+}
+
+TEST_F(SceneGraphTest, ParentMovementShouldPropagateToGrandchildren) {
+    // Arrange
+    Entity root = CreateNode(0.0f, 0.0f);
+    Entity middle = CreateNode(10.0f, 0.0f);
+    Entity leaf = CreateNode(0.0f, 5.0f);
+    registry.SetParent(middle, root);
+    registry.SetParent(leaf, middle);
+    Update();
+
+    // Act
+    Write(root)->mX = 100.0f;
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(middle)->mX, 110.0f);
+    EXPECT_FLOAT_EQ(World(leaf)->mX, 110.0f);
+    EXPECT_FLOAT_EQ(World(leaf)->mY, 5.0f);
+}
+
+TEST_F(SceneGraphTest, UntouchedSubtreeShouldKeepItsWorldTransform) {
+    // Arrange
+    Entity first = CreateNode(0.0f, 0.0f);
+    Entity firstChild = CreateNode(1.0f, 0.0f);
+    Entity second = CreateNode(50.0f, 0.0f);
+    Entity secondChild = CreateNode(1.0f, 0.0f);
+    registry.SetParent(firstChild, first);
+    registry.SetParent(secondChild, second);
+    Update();
+
+    // Act
+    World(secondChild)->mX = -1.0f;
+    Write(first)->mX = 10.0f;
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(firstChild)->mX, 11.0f);
+    EXPECT_FLOAT_EQ(World(secondChild)->mX, -1.0f);
+}
+
+TEST_F(SceneGraphTest, WorldMatricesShouldBeLaidOutBreadthFirst) {
+    // Arrange
+    Entity root = CreateNode(0.0f, 0.0f);
+    Entity a = CreateNode(0.0f, 0.0f);
+    Entity b = CreateNode(0.0f, 0.0f);
+    Entity aChild = CreateNode(0.0f, 0.0f);
+    registry.SetParent(aChild, a);
+    registry.SetParent(a, root);
+    registry.SetParent(b, root);
+
+    // Act
+    Update();
+
+    // Assert
+    const SceneGraph& graph = registry.Hierarchy();
+    EXPECT_EQ(graph.NodeCount(), 4u);
+    const Affine2D* rootMatrix = graph.GetWorldMatrix(root.mIndex);
+    EXPECT_LT(rootMatrix, graph.GetWorldMatrix(a.mIndex));
+    EXPECT_LT(rootMatrix, graph.GetWorldMatrix(b.mIndex));
+    EXPECT_LT(graph.GetWorldMatrix(a.mIndex), graph.GetWorldMatrix(aChild.mIndex));
+    EXPECT_LT(graph.GetWorldMatrix(b.mIndex), graph.GetWorldMatrix(aChild.mIndex));
+}
+
+TEST_F(SceneGraphTest, AttachShouldRejectCycles) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(0.0f, 0.0f);
+    registry.SetParent(child, parent);
+
+    // Act & Assert
+    EXPECT_THROW(registry.SetParent(parent, child), std::runtime_error);
+    EXPECT_THROW(registry.SetParent(parent, parent), std::runtime_error);
+}
+
+TEST_F(SceneGraphTest, DestroyShouldRemoveWholeSubtree) {
+    // Arrange
+    Entity root = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(0.0f, 0.0f);
+    Entity grandchild = CreateNode(0.0f, 0.0f);
+    Entity other = CreateNode(0.0f, 0.0f);
+    registry.SetParent(child, root);
+    registry.SetParent(grandchild, child);
+
+    // Act
+    registry.Destroy(root);
+    Update();
+
+    // Assert
+    EXPECT_FALSE(registry.IsAlive(child));
+    EXPECT_FALSE(registry.IsAlive(grandchild));
+    EXPECT_TRUE(registry.IsAlive(other));
+    EXPECT_EQ(registry.Hierarchy().NodeCount(), 0u);
+}
+
+TEST_F(SceneGraphTest, ClearParentShouldRenderWithLocalTransformAgain) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(3.0f, 4.0f);
+    registry.SetParent(child, parent);
+
+    // Act
+    registry.ClearParent(child);
+
+    // Assert
+    EXPECT_EQ(World(child), nullptr);
+    EXPECT_TRUE(registry.GetParent(child).IsNull());
+}
+
+TEST_F(SceneGraphTest, MovedChildShouldInterpolateFromPreviousWorldPosition) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+
+    // Act
+    auto* parentTransform = Write(parent);
+    parentTransform->SnapshotPrevious();
+    parentTransform->mX = 20.0f;
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mPrevX, 10.0f);
+    EXPECT_FLOAT_EQ(World(child)->mX, 30.0f);
+    EXPECT_FLOAT_EQ(World(child)->Interpolated(0.5f).mX, 20.0f);
+}
+
+TEST_F(SceneGraphTest, CommandBufferTransformWriteShouldReachChildren) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+
+    // Act
+    registry.Commands().AddComponent<Transform>(parent, 5.0f, 0.0f);
+    registry.Commands().Apply(registry);
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mX, 15.0f);
+}
+
+TEST_F(SceneGraphTest, RemovingAnotherTransformShouldKeepNodesTracked) {
+    // Arrange
+    Entity unrelated = CreateNode(0.0f, 0.0f);
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+
+    // Act
+    registry.Get(unrelated)->RemoveComponent<Transform>();
+    Write(parent)->mX = 7.0f;
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mX, 17.0f);
+}
+
+TEST_F(SceneGraphTest, StationaryChildUnderMovingParentShouldInterpolate) {
+    // Arrange
+    Entity parent = CreateNode(100.0f, 100.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.Get(parent)->AddComponent<Velocity>(60.0f, 0.0f);
+    registry.Get(child)->AddComponent<Velocity>(0.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+    MovementSystem movement(800.0f, 600.0f);
+
+    // Act
+    for (int step = 0; step < 3; step++) {
+        registry.Store().Pool<Transform>().ForEach([](ObjectId, Transform& transform) {
+            transform.SnapshotPrevious();
+        });
+        movement.Update(registry.Store(), 0.5f);
+        Update();
+    }
+
+    // Assert
+    const WorldTransform* world = World(child);
+    EXPECT_FLOAT_EQ(world->mPrevX, 170.0f);
+    EXPECT_FLOAT_EQ(world->mX, 200.0f);
+    const float halfway = world->Interpolated(0.5f).mX;
+    EXPECT_GT(halfway, world->mPrevX);
+    EXPECT_LT(halfway, world->mX);
+}
+
+TEST_F(SceneGraphTest, TeleportedParentShouldNotInterpolateChildren) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+
+    // Act
+    auto* parentTransform = Write(parent);
+    parentTransform->mX = 500.0f;
+    parentTransform->Teleport();
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mPrevX, 510.0f);
+    EXPECT_FLOAT_EQ(World(child)->mX, 510.0f);
+    EXPECT_FALSE(parentTransform->mTeleported);
+}
+
+TEST_F(SceneGraphTest, MovementSystemMovesShouldReachChildren) {
+    // Arrange
+    Entity parent = CreateNode(100.0f, 100.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.Get(parent)->AddComponent<Velocity>(60.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+    MovementSystem movement(800.0f, 600.0f);
+
+    // Act
+    movement.Update(registry.Store(), 0.5f);
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mX, 140.0f);
+}
+
+TEST_F(SceneGraphTest, UnmarkedNodesShouldNotBeRecomputed) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    Entity other = CreateNode(0.0f, 0.0f);
+    Entity otherChild = CreateNode(10.0f, 0.0f);
+    registry.SetParent(child, parent);
+    registry.SetParent(otherChild, other);
+    Update();
+
+    // Act
+    registry.Get(parent)->GetComponent<Transform>()->mX = 50.0f;
+    Write(other)->mX = 20.0f;
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mX, 10.0f);
+    EXPECT_FLOAT_EQ(World(otherChild)->mX, 30.0f);
+}
+
+TEST_F(SceneGraphTest, NodesMarkedFromParallelChunksShouldAllBeRecomputed) {
+    // Arrange
+    Entity root = CreateNode(0.0f, 0.0f);
+    std::vector<Entity> children;
+    for (int i = 0; i < 256; i++) {
+        children.push_back(CreateNode(0.0f, 0.0f));
+        registry.SetParent(children.back(), root);
+    }
+    Update();
+    JobSystem jobs(4);
+
+    // Act
+    jobs.ParallelFor(children.size(), 8, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            registry.Store().MarkChanged<Transform>(children[i].mIndex);
+            registry.Get(children[i])->GetComponent<Transform>()->mX = static_cast<float>(i);
+        }
+    });
+    Update();
+
+    // Assert
+    for (size_t i = 0; i < children.size(); i++) {
+        EXPECT_FLOAT_EQ(World(children[i])->mX, static_cast<float>(i));
+    }
+}
+
+TEST_F(SceneGraphTest, ComponentUpdateMovingParentShouldReachChildren) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(5.0f, 0.0f);
+    registry.Get(parent)->AddComponent<SlidingComponent>();
+    registry.SetParent(child, parent);
+    Update();
+    JobSystem jobs(1);
+    ComponentUpdateSystem components;
+
+    // Act
+    components.Run(registry, jobs, 1.0f);
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mX, 15.0f);
+}
+
+TEST_F(SceneGraphTest, TeleportShouldMarkNodeWithoutExplicitNotification) {
+    // Arrange
+    Entity parent = CreateNode(0.0f, 0.0f);
+    Entity child = CreateNode(10.0f, 0.0f);
+    registry.SetParent(child, parent);
+    Update();
+
+    // Act
+    auto* parentTransform = registry.Get(parent)->GetComponent<Transform>();
+    parentTransform->mX = 300.0f;
+    parentTransform->Teleport();
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(child)->mX, 310.0f);
+    EXPECT_FLOAT_EQ(World(child)->mPrevX, 310.0f);
+}
+
+TEST_F(SceneGraphTest, DirtyNodesShouldRecomputeOnlyTheirSubtrees) {
+    // Arrange
+    Entity root = CreateNode(0.0f, 0.0f);
+    Entity left = CreateNode(10.0f, 0.0f);
+    Entity right = CreateNode(20.0f, 0.0f);
+    Entity leftLeaf = CreateNode(1.0f, 0.0f);
+    Entity rightLeaf = CreateNode(2.0f, 0.0f);
+    registry.SetParent(left, root);
+    registry.SetParent(right, root);
+    registry.SetParent(leftLeaf, left);
+    registry.SetParent(rightLeaf, right);
+    Update();
+
+    // Act
+    World(rightLeaf)->mX = -1.0f;
+    Write(left)->mX = 100.0f;
+    Write(leftLeaf)->mX = 3.0f;
+    Update();
+
+    // Assert
+    EXPECT_FLOAT_EQ(World(left)->mX, 100.0f);
+    EXPECT_FLOAT_EQ(World(leftLeaf)->mX, 103.0f);
+    EXPECT_FLOAT_EQ(World(right)->mX, 20.0f);
+    EXPECT_FLOAT_EQ(World(rightLeaf)->mX, -1.0f);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "render-strategies.h"
+#include "shape-texture-cache.h"
+
+// Test fixture for ShapeTextureCache tests
+class ShapeTextureCacheTest : public ::testing::Test {
+protected:
+    std::vector<SDL_Color> pixels;
+    std::vector<SDL_FRect> spans;
+    SDL_Color red{255, 0, 0, 255};
+
+    size_t OpaqueCount() const {
+        size_t count = 0;
+        for (const SDL_Color& pixel : pixels) {
+            count += pixel.a != 0;
+        }
+        return count;
+    }
+};
+
+TEST_F(ShapeTextureCacheTest, CircleRasterShouldCoverSamePixelsAsSpans) {
+    for (int32_t radius : {0, 1, 5, 20}) {
+        // Arrange
+        CircleRenderer::BuildSpans(0, 0, radius, radius, spans);
+        size_t expected = 0;
+        for (const SDL_FRect& span : spans) {
+            expected += static_cast<size_t>(span.w);
+        }
+
+        // Act
+        bool rasterized = ShapeTextureCache::Rasterize(ShapeType::Circle, 2 * radius + 1, 2 * radius + 1, red, pixels);
+
+        // Assert
+        ASSERT_TRUE(rasterized);
+        EXPECT_EQ(pixels.size(), static_cast<size_t>((2 * radius + 1) * (2 * radius + 1)));
+        EXPECT_EQ(OpaqueCount(), expected) << "radius " << radius;
+    }
+}
+
+TEST_F(ShapeTextureCacheTest, CircleRasterShouldLeaveCornersTransparent) {
+    // Act
+    ShapeTextureCache::Rasterize(ShapeType::Circle, 11, 11, red, pixels);
+
+    // Assert
+    EXPECT_EQ(pixels[0].a, 0);
+    EXPECT_EQ(pixels[5 * 11 + 5].r, 255);
+    EXPECT_EQ(pixels[5 * 11 + 5].a, 255);
+    EXPECT_EQ(pixels[5].a, 255);
+}
+
+TEST_F(ShapeTextureCacheTest, RectangleRasterShouldBeFullyOpaque) {
+    // Act
+    bool rasterized = ShapeTextureCache::Rasterize(ShapeType::Rectangle, 4, 3, red, pixels);
+
+    // Assert
+    EXPECT_TRUE(rasterized);
+    EXPECT_EQ(OpaqueCount(), 12u);
+}
+
+TEST_F(ShapeTextureCacheTest, TriangleRasterShouldNotBeSupported) {
+    // Act & Assert
+    EXPECT_FALSE(ShapeTextureCache::Rasterize(ShapeType::Triangle, 4, 4, red, pixels));
+}
+
+TEST_F(ShapeTextureCacheTest, KeysShouldDifferByShapeSizeAndColor) {
+    // Arrange
+    const uint64_t key = ShapeTextureCache::MakeKey(ShapeType::Circle, 21, 21, red);
+
+    // Act & Assert
+    EXPECT_EQ(key, ShapeTextureCache::MakeKey(ShapeType::Circle, 21, 21, red));
+    EXPECT_NE(key, ShapeTextureCache::MakeKey(ShapeType::Rectangle, 21, 21, red));
+    EXPECT_NE(key, ShapeTextureCache::MakeKey(ShapeType::Circle, 21, 23, red));
+    EXPECT_NE(key, ShapeTextureCache::MakeKey(ShapeType::Circle, 23, 21, red));
+    EXPECT_NE(key, ShapeTextureCache::MakeKey(ShapeType::Circle, 21, 21, SDL_Color{255, 0, 0, 128}));
+}
+
+TEST_F(ShapeTextureCacheTest, AcquireShouldRejectShapesItCannotCache) {
+    // Arrange
+    ShapeTextureCache cache(64);
+
+    // Act & Assert
+    EXPECT_EQ(cache.Acquire(nullptr, ShapeType::Circle, 3, 3, red), nullptr);
+    EXPECT_EQ(cache.Acquire(nullptr, ShapeType::Circle, 0, 3, red), nullptr);
+    EXPECT_EQ(cache.Acquire(nullptr, ShapeType::Circle, ShapeTextureCache::kMaxSide + 1, 3, red), nullptr);
+    EXPECT_EQ(cache.Size(), 0u);
+    EXPECT_EQ(cache.Bytes(), 0u);
+}
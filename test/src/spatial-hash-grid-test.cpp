@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "job-system.h"
+#include "registry.h"
+#include "spatial-hash-grid.h"
+
+namespace {
+
+bool ByIndex(const Entity& first, const Entity& second) {
+    return first.mIndex < second.mIndex;
+}
+
+} // namespace
+
+// Test fixture for SpatialHashGrid tests
+class SpatialHashGridTest : public ::testing::Test {
+protected:
+    SpatialHashGrid grid{10.0f, 16};
+
+    std::vector<Entity> CollectRadius(float x, float y, float radius) {
+        std::vector<Entity> result;
+        grid.ForEachInRadius(x, y, radius, [&result](Entity entity) { result.push_back(entity); });
+        std::sort(result.begin(), result.end(), ByIndex);
+        return result;
+    }
+};
+
+TEST_F(SpatialHashGridTest, RadiusQueryShouldReturnOnlyPointsInsideCircle) {
+    // Arrange
+    grid.Insert(Entity{0, 0}, 0.0f, 0.0f);
+    grid.Insert(Entity{1, 0}, 4.0f, 3.0f);
+    grid.Insert(Entity{2, 0}, 6.0f, 0.0f);
+    grid.Insert(Entity{3, 0}, -3.0f, -4.0f);
+
+    // Act
+    grid.Build();
+    std::vector<Entity> result = CollectRadius(0.0f, 0.0f, 5.0f);
+
+    // Assert
+    ASSERT_EQ(result.size(), 3u);
+    EXPECT_EQ(result[0].mIndex, 0u);
+    EXPECT_EQ(result[1].mIndex, 1u);
+    EXPECT_EQ(result[2].mIndex, 3u);
+}
+
+TEST_F(SpatialHashGridTest, BoxQueryShouldWriteIntoCallerBuffer) {
+    // Arrange
+    grid.Insert(Entity{0, 0}, 5.0f, 5.0f);
+    grid.Insert(Entity{1, 0}, 25.0f, 5.0f);
+    grid.Insert(Entity{2, 0}, 15.0f, 15.0f);
+    grid.Build();
+    std::array<Entity, 1> buffer{};
+
+    // Act
+    size_t found = grid.QueryBox(0.0f, 0.0f, 20.0f, 20.0f, buffer);
+
+    // Assert
+    EXPECT_EQ(found, 2u);
+    EXPECT_TRUE(buffer[0].mIndex == 0u || buffer[0].mIndex == 2u);
+}
+
+TEST_F(SpatialHashGridTest, QueriesShouldMatchBruteForceWithoutDuplicates) {
+    // Arrange
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::vector<std::array<float, 2>> points(2000);
+    for (uint32_t i = 0; i < points.size(); i++) {
+        points[i] = {position(random), position(random)};
+        grid.Insert(Entity{i, 0}, points[i][0], points[i][1]);
+    }
+
+    // Act
+    grid.Build();
+
+    // Assert
+    for (int query = 0; query < 50; query++) {
+        const float x = position(random);
+        const float y = position(random);
+        const float radius = 5.0f + static_cast<float>(query) * 2.0f;
+
+        std::vector<Entity> expected;
+        for (uint32_t i = 0; i < points.size(); i++) {
+            const float dx = points[i][0] - x;
+            const float dy = points[i][1] - y;
+            if (dx * dx + dy * dy <= radius * radius) {
+                expected.push_back(Entity{i, 0});
+            }
+        }
+
+        EXPECT_EQ(CollectRadius(x, y, radius), expected);
+    }
+}
+
+TEST_F(SpatialHashGridTest, BuildFromRegistryShouldUseLiveHandles) {
+    // Arrange
+    Registry registry;
+    JobSystem jobs(2);
+    Entity near = registry.Create();
+    Entity far = registry.Create();
+    Entity removed = registry.Create();
+    registry.Get(near)->AddComponent<Transform>(1.0f, 1.0f);
+    registry.Get(far)->AddComponent<Transform>(100.0f, 100.0f);
+    registry.Get(removed)->AddComponent<Transform>(2.0f, 2.0f);
+    registry.Destroy(removed);
+    Entity reused = registry.Create();
+    registry.Get(reused)->AddComponent<Transform>(3.0f, 3.0f);
+
+    // Act
+    grid.Build(registry, &jobs);
+    std::vector<Entity> result = CollectRadius(0.0f, 0.0f, 10.0f);
+
+    // Assert
+    EXPECT_EQ(grid.Size(), 3u);
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0], near);
+    EXPECT_EQ(result[1], reused);
+    EXPECT_TRUE(registry.IsAlive(result[1]));
+}
+
+TEST_F(SpatialHashGridTest, RebuildShouldReflectMovedPoints) {
+    // Arrange
+    Registry registry;
+    Entity entity = registry.Create();
+    registry.Get(entity)->AddComponent<Transform>(0.0f, 0.0f);
+    grid.Build(registry);
+
+    // Act
+    registry.Get(entity)->GetComponent<Transform>()->mX = 200.0f;
+    grid.Build(registry);
+
+    // Assert
+    EXPECT_TRUE(CollectRadius(0.0f, 0.0f, 10.0f).empty());
+    EXPECT_EQ(CollectRadius(200.0f, 0.0f, 10.0f).size(), 1u);
+}
+
+TEST_F(SpatialHashGridTest, BuildShouldNotCreateMissingPools) {
+    // Arrange
+    Registry registry;
+    grid.Build(registry);
+    Entity entity = registry.Create();
+    registry.Get(entity)->AddComponent<Transform>(0.0f, 0.0f);
+
+    // Act
+    grid.Build(registry);
+
+    // Assert
+    EXPECT_EQ(grid.Size(), 1u);
+    EXPECT_EQ(registry.Store().FindPool<WorldTransform>(), nullptr);
+}
+
+TEST_F(SpatialHashGridTest, NonPositiveCellSizeShouldThrow) {
+    // Act & Assert
+    EXPECT_THROW(SpatialHashGrid(0.0f), std::runtime_error);
+}
+
+TEST_F(SpatialHashGridTest, UnboundedQueriesShouldVisitEveryPointOnce) {
+    // Arrange
+    const float infinity = std::numeric_limits<float>::infinity();
+    grid.Insert(Entity{0, 0}, 0.0f, 0.0f);
+    grid.Insert(Entity{1, 0}, 1.0e30f, -1.0e30f);
+    grid.Insert(Entity{2, 0}, -infinity, 5.0f);
+    grid.Build();
+
+    // Act
+    std::vector<Entity> box;
+    grid.ForEachInBox(-infinity, -infinity, infinity, infinity, [&box](Entity entity) { box.push_back(entity); });
+    std::sort(box.begin(), box.end(), ByIndex);
+    std::vector<Entity> wide = CollectRadius(0.0f, 0.0f, 1.0e15f);
+
+    // Assert
+    EXPECT_EQ(box, (std::vector<Entity>{Entity{0, 0}, Entity{1, 0}, Entity{2, 0}}));
+    EXPECT_EQ(wide, (std::vector<Entity>{Entity{0, 0}}));
+}
+
+TEST_F(SpatialHashGridTest, NonFiniteQueryShouldReturnNothing) {
+    // Arrange
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    grid.Insert(Entity{0, 0}, 0.0f, 0.0f);
+    grid.Build();
+
+    // Act
+    std::vector<Entity> result = CollectRadius(nan, 0.0f, 5.0f);
+
+    // Assert
+    EXPECT_TRUE(result.empty());
+}
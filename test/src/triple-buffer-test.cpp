@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "triple-buffer.h"
+
+// Test fixture for TripleBuffer tests
+class TripleBufferTest : public ::testing::Test {
+protected:
+    TripleBuffer<int> buffer;
+};
+
+TEST_F(TripleBufferTest, AcquireShouldReturnFalseBeforeAnyPublish) {
+    // Arrange
+    buffer.Back() = 5;
+
+    // Act
+    bool acquired = buffer.Acquire();
+
+    // Assert
+    EXPECT_FALSE(acquired);
+    EXPECT_NE(buffer.Front(), 5);
+}
+
+TEST_F(TripleBufferTest, AcquireShouldReturnLatestPublishedValueOnce) {
+    // Arrange
+    buffer.Back() = 1;
+    buffer.Publish();
+    buffer.Back() = 2;
+    buffer.Publish();
+
+    // Act
+    bool first = buffer.Acquire();
+    bool second = buffer.Acquire();
+
+    // Assert
+    EXPECT_TRUE(first);
+    EXPECT_FALSE(second);
+    EXPECT_EQ(buffer.Front(), 2);
+}
+
+TEST_F(TripleBufferTest, WriterAndReaderShouldNeverShareASlot) {
+    // Arrange
+    buffer.Back() = 1;
+    buffer.Publish();
+    ASSERT_TRUE(buffer.Acquire());
+
+    // Act
+    buffer.Back() = 2;
+    buffer.Publish();
+    buffer.Back() = 3;
+
+    // Assert
+    EXPECT_EQ(buffer.Front(), 1);
+    ASSERT_TRUE(buffer.Acquire());
+    EXPECT_EQ(buffer.Front(), 2);
+}
+
+TEST(TripleBufferThreadTest, ReaderShouldOnlySeeCompleteAndIncreasingValues) {
+    // Arrange
+    struct Payload {
+        std::array<uint64_t, 16> mWords{};
+    };
+    TripleBuffer<Payload> buffer;
+    constexpr uint64_t kCount = 200000;
+    std::atomic<bool> done{false};
+
+    // Act
+    std::thread writer([&]() {
+        for (uint64_t value = 1; value <= kCount; value++) {
+            buffer.Back().mWords.fill(value);
+            buffer.Publish();
+        }
+        done = true;
+    });
+
+    uint64_t last = 0;
+    bool torn = false;
+    bool decreasing = false;
+    auto check = [&]() {
+        const Payload& payload = buffer.Front();
+        for (uint64_t word : payload.mWords) {
+            torn |= word != payload.mWords[0];
+        }
+        decreasing |= payload.mWords[0] < last;
+        last = payload.mWords[0];
+    };
+    while (!done) {
+        if (buffer.Acquire()) {
+            check();
+        }
+    }
+    writer.join();
+    if (buffer.Acquire()) {
+        check();
+    }
+
+    // Assert
+    EXPECT_FALSE(torn);
+    EXPECT_FALSE(decreasing);
+    EXPECT_EQ(last, kCount);
+}
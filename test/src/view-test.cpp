@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "component-store.h"
+#include "registry.h"
+#include "view.h"
+
+// Test fixture for View tests
+class ViewTest : public ::testing::Test {
+protected:
+    ComponentStore store;
+
+    std::vector<ObjectId> Collect(const View<Transform, Velocity>& view) {
+        std::vector<ObjectId> ids;
+        view.ForEach([&ids](ObjectId id, Transform&, Velocity&) { ids.push_back(id); });
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+};
+
+TEST_F(ViewTest, ViewShouldYieldOnlyObjectsWithAllComponents) {
+    // Arrange
+    ObjectId both = store.CreateObject();
+    ObjectId onlyTransform = store.CreateObject();
+    ObjectId onlyVelocity = store.CreateObject();
+    store.Add<Transform>(both, 1.0f, 2.0f);
+    store.Add<Velocity>(both, 3.0f, 4.0f);
+    store.Add<Transform>(onlyTransform);
+    store.Add<Velocity>(onlyVelocity);
+
+    // Act
+    View<Transform, Velocity> view(store);
+
+    // Assert
+    ASSERT_EQ(view.Size(), 1u);
+    view.ForEach([](Transform& transform, Velocity& velocity) {
+        EXPECT_FLOAT_EQ(transform.mX, 1.0f);
+        EXPECT_FLOAT_EQ(velocity.mVy, 4.0f);
+    });
+    EXPECT_EQ(view.IdAt(0), both);
+}
+
+TEST_F(ViewTest, MatchListShouldFollowComponentChanges) {
+    // Arrange
+    View<Transform, Velocity> view(store);
+    ObjectId first = store.CreateObject();
+    ObjectId second = store.CreateObject();
+
+    // Act & Assert
+    store.Add<Transform>(first);
+    EXPECT_EQ(view.Size(), 0u);
+
+    store.Add<Velocity>(first);
+    store.Add<Transform>(second);
+    store.Add<Velocity>(second);
+    EXPECT_EQ(Collect(view), (std::vector<ObjectId>{first, second}));
+
+    store.Remove<Velocity>(first);
+    EXPECT_EQ(Collect(view), (std::vector<ObjectId>{second}));
+
+    store.DestroyObject(second);
+    EXPECT_TRUE(view.Empty());
+}
+
+TEST_F(ViewTest, ViewsOverTheSameMaskShouldShareTheCachedList) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    store.Add<Transform>(id);
+    store.Add<Velocity>(id);
+
+    // Act
+    const MatchList& first = store.Match(ComponentMaskOf<Transform>() | ComponentMaskOf<Velocity>());
+    const MatchList& second = store.Match(ComponentMaskOf<Velocity>() | ComponentMaskOf<Transform>());
+
+    // Assert
+    EXPECT_EQ(&first, &second);
+    EXPECT_TRUE(first.Contains(id));
+}
+
+TEST_F(ViewTest, ForEachRangeShouldVisitOnlyGivenSlice) {
+    // Arrange
+    for (int i = 0; i < 10; i++) {
+        ObjectId id = store.CreateObject();
+        store.Add<Transform>(id);
+        store.Add<Velocity>(id);
+    }
+    View<Transform, Velocity> view(store);
+
+    // Act
+    int visited = 0;
+    view.ForEach(2, 7, [&visited](Transform& transform, Velocity&) {
+        transform.mX = 1.0f;
+        visited++;
+    });
+
+    // Assert
+    EXPECT_EQ(visited, 5);
+    EXPECT_FLOAT_EQ(view.Get<Transform>(view.IdAt(2)).mX, 1.0f);
+    EXPECT_FLOAT_EQ(view.Get<Transform>(view.IdAt(7)).mX, 0.0f);
+}
+
+TEST(RegistryQueryTest, QueryShouldSkipDestroyedEntities) {
+    // Arrange
+    Registry registry;
+    Entity kept = registry.Create();
+    Entity destroyed = registry.Create();
+    registry.Get(kept)->AddComponent<Transform>(5.0f, 5.0f);
+    registry.Get(destroyed)->AddComponent<Transform>();
+
+    // Act
+    registry.Destroy(destroyed);
+    auto view = registry.Query<Transform>();
+
+    // Assert
+    ASSERT_EQ(view.Size(), 1u);
+    EXPECT_EQ(view.IdAt(0), kept.mIndex);
+}
+
+TEST_F(ViewTest, ExcludedComponentsShouldRemoveObjectsFromView) {
+    // Arrange
+    ObjectId plain = store.CreateObject();
+    ObjectId excluded = store.CreateObject();
+    for (ObjectId id : {plain, excluded}) {
+        store.Add<Transform>(id);
+        store.Add<Velocity>(id);
+    }
+    store.Add<RenderComponent>(excluded, nullptr);
+    View<Transform, Velocity> view(store, ComponentMaskOf<RenderComponent>());
+
+    // Act & Assert
+    EXPECT_EQ(Collect(view), (std::vector<ObjectId>{plain}));
+
+    store.Remove<RenderComponent>(excluded);
+    EXPECT_EQ(Collect(view), (std::vector<ObjectId>{plain, excluded}));
+
+    store.Add<RenderComponent>(plain, nullptr);
+    EXPECT_EQ(Collect(view), (std::vector<ObjectId>{excluded}));
+    EXPECT_EQ((View<Transform, Velocity>(store).Size()), 2u);
+}
+
+TEST_F(ViewTest, ViewsBuiltConcurrentlyShouldShareOneListPerMask) {
+    // Arrange
+    ObjectId id = store.CreateObject();
+    store.Add<Transform>(id);
+    store.Add<Velocity>(id);
+    constexpr int kThreadCount = 8;
+    std::vector<const MatchList*> lists(kThreadCount * 2);
+
+    // Act
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreadCount; i++) {
+        threads.emplace_back([this, &lists, i]() {
+            lists[i * 2] = &store.Match(ComponentMaskOf<Transform>() | ComponentMaskOf<Velocity>());
+            lists[i * 2 + 1] = &store.Match(ComponentMaskOf<Transform>(), ComponentMaskOf<Velocity>());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    for (int i = 1; i < kThreadCount; i++) {
+        EXPECT_EQ(lists[i * 2], lists[0]);
+        EXPECT_EQ(lists[i * 2 + 1], lists[1]);
+    }
+    EXPECT_TRUE(lists[0]->Contains(id));
+    EXPECT_FALSE(lists[1]->Contains(id));
+}
+
+TEST_F(ViewTest, ViewsBuiltConcurrentlyShouldNotCreateMissingPools) {
+    // Arrange
+    store.CreateObject();
+    constexpr int kThreadCount = 8;
+    std::vector<size_t> sizes(kThreadCount, 1);
+    std::vector<char> poolFound(kThreadCount, 1);
+
+    // Act
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreadCount; i++) {
+        threads.emplace_back([this, &sizes, &poolFound, i]() {
+            const View<Transform, Velocity> view(store);
+            sizes[i] = view.Size();
+            view.ForEach([](Transform&, Velocity&) { ADD_FAILURE(); });
+            poolFound[i] = store.FindPool<Transform>() != nullptr;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    for (int i = 0; i < kThreadCount; i++) {
+        EXPECT_EQ(sizes[i], 0u);
+        EXPECT_FALSE(poolFound[i]);
+    }
+    EXPECT_EQ(store.FindPool<Transform>(), nullptr);
+    EXPECT_EQ(store.FindPool<Velocity>(), nullptr);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "registry.h"
+#include "render-strategies.h"
+#include "viewport-culler.h"
+
+// Test fixture for ViewportCuller tests
+class ViewportCullerTest : public ::testing::Test {
+protected:
+    Registry registry;
+    ViewportCuller culler{0.0f};
+    const Aabb viewport{0.0f, 0.0f, 800.0f, 600.0f};
+
+    Entity Create(const Prefab& prefab, float x, float y) {
+        return GraphicalObjectFactory::Spawn(registry, prefab, x, y);
+    }
+
+    bool IsVisible(Entity entity) {
+        for (ObjectId id : culler.Query(viewport)) {
+            if (id == entity.mIndex) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(ViewportCullerTest, OnlyObjectsOverlappingViewportShouldBeReturned) {
+    // Arrange
+    Entity inside = Create(GraphicalObjectFactory::RectanglePrefab(), 400.0f, 300.0f);
+    Entity outside = Create(GraphicalObjectFactory::CirclePrefab(), 5000.0f, 300.0f);
+    Entity straddling = Create(GraphicalObjectFactory::TrianglePrefab(), -20.0f, 300.0f);
+
+    // Act
+    culler.Update(registry);
+
+    // Assert
+    EXPECT_EQ(culler.ProxyCount(), 3u);
+    EXPECT_TRUE(IsVisible(inside));
+    EXPECT_FALSE(IsVisible(outside));
+    EXPECT_TRUE(IsVisible(straddling));
+}
+
+TEST_F(ViewportCullerTest, BoundsShouldFollowStrategySizeAndScale) {
+    // Arrange
+    Transform transform(100.0f, 100.0f);
+    transform.mScaleX = 2.0f;
+    transform.mScaleY = 0.5f;
+    RectangleRenderer rectangle(SDL_Color{}, 50, 40);
+
+    // Act
+    Aabb box = ViewportCuller::ComputeBounds(rectangle.GetShape(), transform);
+
+    // Assert
+    EXPECT_FLOAT_EQ(box.mMinX, 50.0f);
+    EXPECT_FLOAT_EQ(box.mMaxX, 150.0f);
+    EXPECT_FLOAT_EQ(box.mMinY, 90.0f);
+    EXPECT_FLOAT_EQ(box.mMaxY, 110.0f);
+}
+
+TEST_F(ViewportCullerTest, VerticallyStretchedCircleShouldStayVisibleWhileReachingViewport) {
+    // Arrange
+    Entity entity = Create(GraphicalObjectFactory::CirclePrefab(), 400.0f, -40.0f);
+    auto* transform = registry.Get(entity)->GetComponent<Transform>();
+    transform->mScaleY = 2.0f;
+    transform->Teleport();
+
+    // Act
+    culler.Update(registry);
+
+    // Assert
+    EXPECT_TRUE(IsVisible(entity));
+}
+
+TEST_F(ViewportCullerTest, MovedObjectShouldEnterAndLeaveViewport) {
+    // Arrange
+    Entity entity = Create(GraphicalObjectFactory::RectanglePrefab(), -500.0f, 300.0f);
+    culler.Update(registry);
+    ASSERT_FALSE(IsVisible(entity));
+    auto* transform = registry.Get(entity)->GetComponent<Transform>();
+
+    // Act
+    transform->Teleport();
+    transform->mX = 400.0f;
+    transform->Teleport();
+    culler.Update(registry);
+    const bool visibleAfterEntering = IsVisible(entity);
+    transform->mX = 3000.0f;
+    transform->Teleport();
+    culler.Update(registry);
+
+    // Assert
+    EXPECT_TRUE(visibleAfterEntering);
+    EXPECT_FALSE(IsVisible(entity));
+}
+
+TEST_F(ViewportCullerTest, DestroyedObjectsShouldBeRemovedFromTree) {
+    // Arrange
+    Entity first = Create(GraphicalObjectFactory::RectanglePrefab(), 100.0f, 100.0f);
+    Entity second = Create(GraphicalObjectFactory::CirclePrefab(), 200.0f, 100.0f);
+    culler.Update(registry);
+
+    // Act
+    registry.Destroy(first);
+    culler.Update(registry);
+
+    // Assert
+    EXPECT_EQ(culler.ProxyCount(), 1u);
+    EXPECT_EQ(culler.Query(viewport), (std::vector<ObjectId>{second.mIndex}));
+}
+
+TEST_F(ViewportCullerTest, OnlyNotifiedWritesShouldMoveProxies) {
+    // Arrange
+    Entity silent = Create(GraphicalObjectFactory::RectanglePrefab(), 100.0f, 100.0f);
+    Entity notified = Create(GraphicalObjectFactory::RectanglePrefab(), 200.0f, 100.0f);
+    culler.Update(registry);
+
+    // Act
+    for (Entity entity : {silent, notified}) {
+        auto* transform = registry.Get(entity)->GetComponent<Transform>();
+        transform->mX = transform->mPrevX = 5000.0f;
+    }
+    registry.Store().MarkChanged<Transform>(notified.mIndex);
+    culler.Update(registry);
+
+    // Assert
+    EXPECT_TRUE(IsVisible(silent));
+    EXPECT_FALSE(IsVisible(notified));
+}
+
+TEST_F(ViewportCullerTest, ObjectWithoutStrategyShouldLeaveTree) {
+    // Arrange
+    Entity entity = Create(GraphicalObjectFactory::RectanglePrefab(), 100.0f, 100.0f);
+    culler.Update(registry);
+
+    // Act
+    registry.Get(entity)->GetComponent<RenderComponent>()->SetStrategy(nullptr);
+    culler.Update(registry);
+
+    // Assert
+    EXPECT_EQ(culler.ProxyCount(), 0u);
+    EXPECT_FALSE(IsVisible(entity));
+}
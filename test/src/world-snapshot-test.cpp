@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "collision.h"
+#include "registry.h"
+#include "render-strategies.h"
+#include "world-snapshot.h"
+
+// Test fixture for WorldSnapshot tests
+class WorldSnapshotTest : public ::testing::Test {
+protected:
+    Registry registry;
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "world-snapshot-test.sdlw";
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    // Dosyanın offset konumundaki 32 bitlik değeri değiştirir
+    void PatchUint32(std::streamoff offset, uint32_t value) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+};
+
+TEST_F(WorldSnapshotTest, RoundTripShouldRestoreComponentsAndShareStrategies) {
+    // Arrange
+    std::vector<SDL_FPoint> positions{{10.0f, 20.0f}, {30.0f, 40.0f}};
+    GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::CirclePrefab(), 2, positions);
+    Entity rectangle = GraphicalObjectFactory::CreateRectangle(registry, 400.0f, 300.0f);
+    auto* transform = registry.Get(rectangle)->GetComponent<Transform>();
+    transform->mRotation = 0.5f;
+    transform->mScaleX = 2.0f;
+    transform->mPrevX = 390.0f;
+    registry.Get(rectangle)->AddComponent<Collider>(ShapeDesc{ShapeType::Rectangle, 50.0f, 50.0f}, 2u, 6u);
+
+    // Act
+    WorldSnapshot::Save(registry, path.string());
+    Registry loaded;
+    std::vector<Entity> entities = WorldSnapshot::Load(loaded, path.string());
+
+    // Assert
+    ASSERT_EQ(entities.size(), 3u);
+    GraphicalObject* first = loaded.Get(entities[0]);
+    GraphicalObject* second = loaded.Get(entities[1]);
+    GraphicalObject* third = loaded.Get(entities[2]);
+    EXPECT_FLOAT_EQ(second->GetComponent<Transform>()->mX, 30.0f);
+    EXPECT_FLOAT_EQ(second->GetComponent<Velocity>()->mVx, 100.0f);
+    EXPECT_EQ(first->GetComponent<RenderComponent>()->GetStrategy(), second->GetComponent<RenderComponent>()->GetStrategy());
+    EXPECT_EQ(first->GetComponent<RenderComponent>()->GetStrategy()->GetShape().mType, ShapeType::Circle);
+    EXPECT_EQ(first->GetComponent<RenderComponent>()->GetBoundTransform(), first->GetComponent<Transform>());
+    EXPECT_EQ(first->GetComponent<Transform>()->mOwner, first);
+
+    const Transform* restored = third->GetComponent<Transform>();
+    EXPECT_FLOAT_EQ(restored->mRotation, 0.5f);
+    EXPECT_FLOAT_EQ(restored->mScaleX, 2.0f);
+    EXPECT_FLOAT_EQ(restored->mPrevX, 390.0f);
+    EXPECT_FLOAT_EQ(third->GetComponent<RenderComponent>()->GetStrategy()->GetColor().g, 1.0f);
+    ASSERT_NE(third->GetComponent<Collider>(), nullptr);
+    EXPECT_EQ(third->GetComponent<Collider>()->mLayer, 2u);
+    EXPECT_EQ(third->GetComponent<Collider>()->mMask, 6u);
+    EXPECT_EQ(first->GetComponent<Collider>(), nullptr);
+}
+
+TEST_F(WorldSnapshotTest, LoadedStrategiesShouldComeFromTheirPool) {
+    // Arrange
+    GraphicalObjectFactory::CreateCircle(registry, 10.0f, 20.0f);
+    WorldSnapshot::Save(registry, path.string());
+    const size_t before = CircleRenderer::GetPoolStats().mInUse;
+
+    // Act
+    auto loaded = std::make_unique<Registry>();
+    WorldSnapshot::Load(*loaded, path.string());
+    const size_t afterLoad = CircleRenderer::GetPoolStats().mInUse;
+    loaded.reset();
+
+    // Assert
+    EXPECT_EQ(afterLoad, before + 1);
+    EXPECT_EQ(CircleRenderer::GetPoolStats().mInUse, before);
+}
+
+TEST_F(WorldSnapshotTest, HierarchyShouldBeRestored) {
+    // Arrange
+    Entity parent = GraphicalObjectFactory::CreateRectangle(registry, 100.0f, 100.0f);
+    Entity child = GraphicalObjectFactory::CreateCircle(registry, 10.0f, 0.0f);
+    registry.Destroy(GraphicalObjectFactory::CreateTriangle(registry, 0.0f, 0.0f));
+    registry.SetParent(child, parent);
+
+    // Act
+    WorldSnapshot::Save(registry, path.string());
+    Registry loaded;
+    std::vector<Entity> entities = WorldSnapshot::Load(loaded, path.string());
+
+    // Assert
+    ASSERT_EQ(entities.size(), 2u);
+    EXPECT_EQ(loaded.GetParent(entities[1]), entities[0]);
+    EXPECT_NE(loaded.Get(entities[1])->GetComponent<WorldTransform>(), nullptr);
+}
+
+TEST_F(WorldSnapshotTest, RenderLayersShouldBeRestored) {
+    // Arrange
+    Entity background = GraphicalObjectFactory::CreateRectangle(registry, 0.0f, 0.0f);
+    Entity foreground = GraphicalObjectFactory::CreateCircle(registry, 10.0f, 0.0f);
+    registry.Get(foreground)->GetComponent<RenderComponent>()->SetLayer(3);
+
+    // Act
+    WorldSnapshot::Save(registry, path.string());
+    Registry loaded;
+    std::vector<Entity> entities = WorldSnapshot::Load(loaded, path.string());
+
+    // Assert
+    ASSERT_EQ(entities.size(), 2u);
+    EXPECT_EQ(loaded.Get(entities[0])->GetComponent<RenderComponent>()->GetLayer(),
+              registry.Get(background)->GetComponent<RenderComponent>()->GetLayer());
+    EXPECT_EQ(loaded.Get(entities[1])->GetComponent<RenderComponent>()->GetLayer(), 3);
+}
+
+TEST_F(WorldSnapshotTest, VersionOneFileShouldStillLoad) {
+    // Arrange
+    GraphicalObjectFactory::CreateRectangle(registry, 0.0f, 0.0f);
+    WorldSnapshot::Save(registry, path.string());
+    PatchUint32(12, 1);
+    Registry loaded;
+
+    // Act
+    std::vector<Entity> entities = WorldSnapshot::Load(loaded, path.string());
+
+    // Assert
+    ASSERT_EQ(entities.size(), 1u);
+    EXPECT_EQ(loaded.Get(entities[0])->GetComponent<RenderComponent>()->GetLayer(), 0);
+}
+
+TEST_F(WorldSnapshotTest, TruncatedFileShouldThrowWithoutAddingObjects) {
+    // Arrange
+    GraphicalObjectFactory::SpawnMany(registry, GraphicalObjectFactory::RectanglePrefab(), 100);
+    WorldSnapshot::Save(registry, path.string());
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    Registry loaded;
+
+    // Act & Assert
+    EXPECT_THROW(WorldSnapshot::Load(loaded, path.string()), std::runtime_error);
+    EXPECT_EQ(loaded.Size(), 0u);
+}
+
+TEST_F(WorldSnapshotTest, NewerVersionShouldBeRejected) {
+    // Arrange
+    GraphicalObjectFactory::CreateRectangle(registry, 0.0f, 0.0f);
+    WorldSnapshot::Save(registry, path.string());
+
+    // Version alanı 8 baytlık imza ve 4 baytlık bayt sırası etiketinden sonra gelir
+    PatchUint32(12, WorldSnapshot::kVersion + 1);
+    Registry loaded;
+
+    // Act & Assert
+    EXPECT_THROW(WorldSnapshot::Load(loaded, path.string()), std::runtime_error);
+    EXPECT_EQ(loaded.Size(), 0u);
+}
+
+TEST_F(WorldSnapshotTest, MissingFileShouldThrow) {
+    // Act & Assert
+    EXPECT_THROW(WorldSnapshot::Load(registry, (path.parent_path() / "missing-world.sdlw").string()), std::runtime_error);
+}